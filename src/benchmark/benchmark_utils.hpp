@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdlib>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Chunk size of the tables generated for the benchmarks
+constexpr auto BENCHMARK_CHUNK_SIZE = uint32_t{100'000};
+
+// Number of rows the benchmarks work on. Defaults to one million and can be changed by setting the environment
+// variable HYRISE_BENCHMARK_ROWS, e.g. to run the suite quickly on a laptop or to exceed the caches of a server.
+inline size_t benchmark_row_count() {
+  const auto* rows = std::getenv("HYRISE_BENCHMARK_ROWS");
+  return rows ? std::stoul(rows) : size_t{1'000'000};
+}
+
+}  // namespace opossum
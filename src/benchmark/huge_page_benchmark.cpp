@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <boost/container/pmr/global_resource.hpp>
+
+#include <memory>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "storage/huge_page_memory_resource.hpp"
+#include "storage/value_column.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Materializes the values of a PosList with random offsets into a ValueColumn, which is what happens when the
+ * result of a TableScan is consumed. For columns much larger than the TLB's reach, almost every access is a TLB miss
+ * when the column is backed by 4 KB pages. The column size (number of int32_t values) is the benchmark's argument.
+ */
+static void materialize_random_pos_list(benchmark::State& state,
+                                        boost::container::pmr::memory_resource* memory_resource) {
+  const auto column_size = static_cast<size_t>(state.range(0));
+  constexpr auto pos_list_size = size_t{1'000'000};
+
+  pmr_vector<int32_t> values(column_size, PolymorphicAllocator<int32_t>(memory_resource));
+  std::iota(values.begin(), values.end(), 0);
+  const auto column = std::make_shared<ValueColumn<int32_t>>(std::move(values));
+
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<ChunkOffset> distribution(0, static_cast<ChunkOffset>(column_size - 1));
+  PosList pos_list(pos_list_size);
+  for (auto& row_id : pos_list) row_id = RowID{ChunkID{0}, distribution(generator)};
+
+  std::vector<int32_t> materialized_values(pos_list_size);
+  for (auto _ : state) {
+    const auto& column_values = column->values();
+    for (size_t i = 0; i < pos_list_size; ++i) {
+      materialized_values[i] = column_values[pos_list[i].chunk_offset];
+    }
+    benchmark::DoNotOptimize(materialized_values.data());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * pos_list_size);
+}
+
+BENCHMARK_CAPTURE(materialize_random_pos_list, DefaultPages, boost::container::pmr::get_default_resource())
+    ->RangeMultiplier(4)
+    ->Range(1 << 16, 1 << 26);
+
+BENCHMARK_CAPTURE(materialize_random_pos_list, TransparentHugePages,
+                  HugePageMemoryResource::get(HugePageMode::Transparent))
+    ->RangeMultiplier(4)
+    ->Range(1 << 16, 1 << 26);
+
+BENCHMARK_CAPTURE(materialize_random_pos_list, ExplicitHugePages, HugePageMemoryResource::get(HugePageMode::Explicit))
+    ->RangeMultiplier(4)
+    ->Range(1 << 16, 1 << 26);
+
+}  // namespace opossum
@@ -0,0 +1,47 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "benchmark_utils.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+#include "utils/table_generator.hpp"
+
+namespace opossum {
+
+/**
+ * Loads a .tbl file with an int, a float, and a string column and benchmark_row_count() / 10 rows, as the tests do
+ * for their fixtures. The file is written to the temporary directory before the benchmark and removed afterwards.
+ */
+static void load_table_from_file(benchmark::State& state) {
+  const auto row_count = benchmark_row_count() / 10;
+  const auto file_name = (std::filesystem::temp_directory_path() / "hyrise_load_table_benchmark.tbl").string();
+
+  {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int32_t> distribution(0, 999);
+
+    std::ofstream file(file_name);
+    file << "a|b|c\nint|float|string\n";
+    for (size_t row = 0; row < row_count; ++row) {
+      file << distribution(generator) << '|' << distribution(generator) / 10.0f << '|'
+           << TableGenerator::generated_value<std::string>(distribution(generator)) << '\n';
+    }
+  }
+
+  for (auto _ : state) {
+    const auto table = load_table(file_name, BENCHMARK_CHUNK_SIZE);
+    benchmark::DoNotOptimize(table.get());
+  }
+
+  std::filesystem::remove(file_name);
+  state.SetItemsProcessed(state.iterations() * row_count);
+}
+
+BENCHMARK(load_table_from_file);
+
+}  // namespace opossum
@@ -0,0 +1,178 @@
+#include <benchmark/benchmark.h>
+
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+#include "operators/materialize.hpp"
+#include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/value_column.hpp"
+#include "types.hpp"
+#include "utils/table_generator.hpp"
+
+namespace opossum {
+
+/**
+ * Appends benchmark_row_count() values to an empty ValueColumn, one AllTypeVariant at a time, as load_table and
+ * Table::append do.
+ */
+template <typename T>
+static void value_column_append(benchmark::State& state) {
+  const auto row_count = static_cast<size_t>(state.range(0));
+
+  std::vector<AllTypeVariant> values(row_count);
+  for (size_t i = 0; i < row_count; ++i) values[i] = TableGenerator::generated_value<T>(i % 1'000);
+
+  for (auto _ : state) {
+    ValueColumn<T> column;
+    for (const auto& value : values) column.append(value);
+    benchmark::DoNotOptimize(column.values().data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * row_count);
+}
+
+BENCHMARK_TEMPLATE(value_column_append, int32_t)->Arg(benchmark_row_count());
+BENCHMARK_TEMPLATE(value_column_append, double)->Arg(benchmark_row_count());
+BENCHMARK_TEMPLATE(value_column_append, std::string)->Arg(benchmark_row_count());
+
+/**
+ * Dictionary-compresses a ValueColumn of BENCHMARK_CHUNK_SIZE values. The number of distinct values, which determines
+ * the size of the dictionary and the width of the attribute vector, is the benchmark's argument.
+ */
+static void dictionary_column_construction(benchmark::State& state, const std::string& type) {
+  const auto distribution = ColumnDataDistribution::make_uniform_config(static_cast<size_t>(state.range(0)));
+  const auto table = TableGenerator{}.generate_table({{"a", type, distribution}}, BENCHMARK_CHUNK_SIZE, 0);
+  const auto column = table->get_chunk(ChunkID{0})->get_column(ColumnID{0});
+
+  for (auto _ : state) {
+    const auto dictionary_column = make_shared_by_column_type<BaseColumn, DictionaryColumn>(type, column);
+    benchmark::DoNotOptimize(dictionary_column.get());
+  }
+
+  state.SetItemsProcessed(state.iterations() * BENCHMARK_CHUNK_SIZE);
+}
+
+BENCHMARK_CAPTURE(dictionary_column_construction, int, "int")->RangeMultiplier(100)->Range(10, 100'000);
+BENCHMARK_CAPTURE(dictionary_column_construction, double, "double")->RangeMultiplier(100)->Range(10, 100'000);
+BENCHMARK_CAPTURE(dictionary_column_construction, string, "string")->RangeMultiplier(100)->Range(10, 100'000);
+
+/**
+ * Sums the ValueIDs of an attribute vector, once through the virtual BaseAttributeVector::get() and once through
+ * FittedAttributeVector::values(). The difference is the cost of a virtual call per value and of the missed
+ * vectorization.
+ */
+template <typename uintX_t>
+static std::shared_ptr<FittedAttributeVector<uintX_t>> generate_attribute_vector(const size_t size) {
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<uint32_t> distribution(0, std::numeric_limits<uintX_t>::max());
+
+  pmr_vector<uintX_t> value_ids(size);
+  for (auto& value_id : value_ids) value_id = static_cast<uintX_t>(distribution(generator));
+  return std::make_shared<FittedAttributeVector<uintX_t>>(std::move(value_ids));
+}
+
+template <typename uintX_t>
+static void attribute_vector_virtual_get(benchmark::State& state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  const std::shared_ptr<const BaseAttributeVector> attribute_vector = generate_attribute_vector<uintX_t>(size);
+
+  for (auto _ : state) {
+    auto sum = uint64_t{0};
+    for (size_t i = 0; i < size; ++i) sum += attribute_vector->get(i);
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * size);
+}
+
+template <typename uintX_t>
+static void attribute_vector_values(benchmark::State& state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  const auto attribute_vector = generate_attribute_vector<uintX_t>(size);
+
+  for (auto _ : state) {
+    auto sum = uint64_t{0};
+    for (const auto value_id : attribute_vector->values()) sum += value_id;
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetItemsProcessed(state.iterations() * size);
+}
+
+BENCHMARK_TEMPLATE(attribute_vector_virtual_get, uint8_t)->Arg(benchmark_row_count());
+BENCHMARK_TEMPLATE(attribute_vector_virtual_get, uint16_t)->Arg(benchmark_row_count());
+BENCHMARK_TEMPLATE(attribute_vector_virtual_get, uint32_t)->Arg(benchmark_row_count());
+BENCHMARK_TEMPLATE(attribute_vector_values, uint8_t)->Arg(benchmark_row_count());
+BENCHMARK_TEMPLATE(attribute_vector_values, uint16_t)->Arg(benchmark_row_count());
+BENCHMARK_TEMPLATE(attribute_vector_values, uint32_t)->Arg(benchmark_row_count());
+
+/**
+ * Materializes a ReferenceColumn that points to a random, sorted selection of the rows of a generated int column.
+ * The selectivity in percent is the benchmark's argument. The naive variant reads every value through
+ * ReferenceColumn::operator[], the other one uses the Materialize operator.
+ */
+static std::shared_ptr<TableWrapper> generate_reference_table(const int32_t selectivity_percent,
+                                                              const bool compressed) {
+  const auto table = TableGenerator{}.generate_table({{"a", "int"}}, benchmark_row_count(), BENCHMARK_CHUNK_SIZE,
+                                                     compressed);
+
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int32_t> distribution(0, 99);
+
+  auto pos_list = std::make_shared<PosList>();
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    for (ChunkOffset chunk_offset{0}; chunk_offset < table->get_chunk(chunk_id)->size(); ++chunk_offset) {
+      if (distribution(generator) < selectivity_percent) pos_list->emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+
+  auto reference_table = std::make_shared<Table>();
+  reference_table->add_column_definition("a", "int");
+  Chunk chunk;
+  chunk.add_column(std::make_shared<ReferenceColumn>(table, ColumnID{0}, pos_list));
+  reference_table->emplace_chunk(std::move(chunk));
+
+  auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  table_wrapper->execute();
+  return table_wrapper;
+}
+
+static void reference_column_subscript(benchmark::State& state) {
+  const auto table_wrapper = generate_reference_table(static_cast<int32_t>(state.range(0)), false);
+  const auto& column = *table_wrapper->get_output()->get_chunk(ChunkID{0})->get_column(ColumnID{0});
+
+  for (auto _ : state) {
+    std::vector<AllTypeVariant> values(column.size());
+    for (size_t i = 0; i < column.size(); ++i) values[i] = column[i];
+    benchmark::DoNotOptimize(values.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * column.size());
+}
+
+static void reference_column_materialize(benchmark::State& state, const bool compressed) {
+  const auto table_wrapper = generate_reference_table(static_cast<int32_t>(state.range(0)), compressed);
+
+  for (auto _ : state) {
+    auto materialize = std::make_shared<Materialize>(table_wrapper);
+    materialize->execute();
+    benchmark::DoNotOptimize(materialize->get_output().get());
+  }
+
+  state.SetItemsProcessed(state.iterations() * table_wrapper->get_output()->row_count());
+}
+
+BENCHMARK(reference_column_subscript)->Arg(1)->Arg(10)->Arg(50)->Arg(100);
+BENCHMARK_CAPTURE(reference_column_materialize, ValueColumn, false)->Arg(1)->Arg(10)->Arg(50)->Arg(100);
+BENCHMARK_CAPTURE(reference_column_materialize, DictionaryColumn, true)->Arg(1)->Arg(10)->Arg(50)->Arg(100);
+
+}  // namespace opossum
@@ -0,0 +1,248 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/index_scan.hpp"
+#include "operators/table_index_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "resolve_type.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/table_generator.hpp"
+
+namespace opossum {
+
+// The scanned columns hold values drawn uniformly from this many distinct values
+constexpr auto TABLE_SCAN_DISTINCT_VALUES = int32_t{1'000};
+
+/**
+ * Returns the search value (as an index into the distinct values) for which a scan of the given type matches roughly
+ * selectivity_percent of the rows. OpEquals and OpNotEquals always match 0.1 % and 99.9 % of the rows.
+ */
+static int32_t search_value_for_selectivity(const ScanType scan_type, const int32_t selectivity_percent) {
+  const auto matching_values = TABLE_SCAN_DISTINCT_VALUES * selectivity_percent / 100;
+  switch (scan_type) {
+    case ScanType::OpEquals:
+    case ScanType::OpNotEquals:
+      return TABLE_SCAN_DISTINCT_VALUES / 2;
+    case ScanType::OpLessThan:
+      return matching_values;
+    case ScanType::OpLessThanEquals:
+      return matching_values - 1;
+    case ScanType::OpGreaterThan:
+      return TABLE_SCAN_DISTINCT_VALUES - 1 - matching_values;
+    case ScanType::OpGreaterThanEquals:
+      return TABLE_SCAN_DISTINCT_VALUES - matching_values;
+    case ScanType::OpIsNull:
+    case ScanType::OpIsNotNull:
+    case ScanType::OpLike:
+    case ScanType::OpNotLike:
+      break;
+  }
+  Fail("Unknown scan type");
+  return 0;
+}
+
+/**
+ * Scans a generated column of benchmark_row_count() rows. The first argument is the ScanType, the second one the
+ * selectivity in percent. Whether the column is dictionary-compressed is captured.
+ */
+static void table_scan(benchmark::State& state, const std::string& type, const bool compressed) {
+  const auto scan_type = static_cast<ScanType>(state.range(0));
+  const auto selectivity_percent = static_cast<int32_t>(state.range(1));
+
+  const auto distribution = ColumnDataDistribution::make_uniform_config(TABLE_SCAN_DISTINCT_VALUES);
+  const auto table = TableGenerator{}.generate_table({{"a", type, distribution}}, benchmark_row_count(),
+                                                     BENCHMARK_CHUNK_SIZE, compressed);
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  AllTypeVariant search_value;
+  resolve_data_type(type, [&](auto data_type) {
+    using ColumnDataType = typename decltype(data_type)::type;
+    search_value =
+        TableGenerator::generated_value<ColumnDataType>(search_value_for_selectivity(scan_type, selectivity_percent));
+  });
+
+  for (auto _ : state) {
+    auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, search_value);
+    table_scan->execute();
+    benchmark::DoNotOptimize(table_scan->get_output().get());
+  }
+
+  state.SetItemsProcessed(state.iterations() * table->row_count());
+}
+
+/**
+ * Same as table_scan on a dictionary-compressed column, but the rows are selected by an IndexScan using an index of
+ * type index_type on every chunk.
+ */
+static void index_scan(benchmark::State& state, const std::string& type, const ColumnIndexType index_type) {
+  const auto scan_type = static_cast<ScanType>(state.range(0));
+  const auto selectivity_percent = static_cast<int32_t>(state.range(1));
+
+  const auto distribution = ColumnDataDistribution::make_uniform_config(TABLE_SCAN_DISTINCT_VALUES);
+  const auto table =
+      TableGenerator{}.generate_table({{"a", type, distribution}}, benchmark_row_count(), BENCHMARK_CHUNK_SIZE, true);
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    if (index_type == ColumnIndexType::GroupKey) {
+      table->get_chunk(chunk_id)->create_index<GroupKeyIndex>({ColumnID{0}});
+    } else {
+      table->get_chunk(chunk_id)->create_index<AdaptiveRadixTreeIndex>({ColumnID{0}});
+    }
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  AllTypeVariant search_value;
+  resolve_data_type(type, [&](auto data_type) {
+    using ColumnDataType = typename decltype(data_type)::type;
+    search_value =
+        TableGenerator::generated_value<ColumnDataType>(search_value_for_selectivity(scan_type, selectivity_percent));
+  });
+
+  for (auto _ : state) {
+    auto index_scan = std::make_shared<IndexScan>(table_wrapper, index_type,
+                                                  std::vector<ColumnID>{ColumnID{0}}, scan_type,
+                                                  std::vector<AllTypeVariant>{search_value});
+    index_scan->execute();
+    benchmark::DoNotOptimize(index_scan->get_output().get());
+  }
+
+  state.SetItemsProcessed(state.iterations() * table->row_count());
+}
+
+/**
+ * Looks up a single key in a table of benchmark_row_count() rows with (almost) unique values, split into small chunks
+ * of 1,000 rows. The key is found with a TableScan, an IndexScan on GroupKeyIndexes (which probes every chunk), or a
+ * TableIndexScan on a table index.
+ */
+static void key_lookup(benchmark::State& state, const std::string& method) {
+  const auto row_count = benchmark_row_count();
+  const auto distribution = ColumnDataDistribution::make_uniform_config(row_count);
+  const auto table = TableGenerator{}.generate_table({{"a", "int", distribution}}, row_count, 1'000, true);
+  if (method == "IndexScan") {
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      table->get_chunk(chunk_id)->create_index<GroupKeyIndex>({ColumnID{0}});
+    }
+  } else if (method == "TableIndexScan") {
+    table->create_table_index(ColumnID{0});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto search_value = AllTypeVariant{TableGenerator::generated_value<int32_t>(row_count / 2)};
+
+  if (method == "TableIndexLookup") {
+    table->create_table_index(ColumnID{0});
+    for (auto _ : state) benchmark::DoNotOptimize(table->get_table_index(ColumnID{0})->point_lookup(search_value));
+    return;
+  }
+
+  for (auto _ : state) {
+    auto scan = std::shared_ptr<AbstractOperator>{};
+    if (method == "TableScan") {
+      scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, search_value);
+    } else if (method == "IndexScan") {
+      scan = std::make_shared<IndexScan>(table_wrapper, ColumnIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}},
+                                         ScanType::OpEquals, std::vector<AllTypeVariant>{search_value});
+    } else {
+      scan = std::make_shared<TableIndexScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, search_value);
+    }
+    scan->execute();
+    benchmark::DoNotOptimize(scan->get_output().get());
+  }
+}
+
+/**
+ * Same as table_scan on an uncompressed int column of an MVCC table, whose rows are filtered by a Validate either
+ * before or after the scan. The argument is the selectivity of the scan in percent.
+ */
+static void validated_table_scan(benchmark::State& state, const bool validate_first) {
+  const auto selectivity_percent = static_cast<int32_t>(state.range(0));
+
+  const auto distribution = ColumnDataDistribution::make_uniform_config(TABLE_SCAN_DISTINCT_VALUES);
+  const auto generated_table = TableGenerator{}.generate_table({{"a", "int", distribution}}, benchmark_row_count(),
+                                                               BENCHMARK_CHUNK_SIZE, false);
+  const auto table = std::make_shared<Table>(BENCHMARK_CHUNK_SIZE, PolymorphicAllocator<size_t>{}, UseMvcc::Yes);
+  table->add_column_definition("a", "int");
+  for (ChunkID chunk_id{0}; chunk_id < generated_table->chunk_count(); ++chunk_id) {
+    Chunk chunk;
+    chunk.add_column(generated_table->get_chunk(chunk_id)->get_column(ColumnID{0}));
+    table->emplace_chunk(std::move(chunk));
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto search_value = AllTypeVariant{TableGenerator::generated_value<int32_t>(
+      search_value_for_selectivity(ScanType::OpLessThan, selectivity_percent))};
+  const auto context = TransactionManager::get().new_transaction_context();
+
+  for (auto _ : state) {
+    auto output = std::shared_ptr<const Table>{};
+    if (validate_first) {
+      auto validate = std::make_shared<Validate>(table_wrapper);
+      validate->set_transaction_context(context);
+      validate->execute();
+      auto table_scan = std::make_shared<TableScan>(validate, ColumnID{0}, ScanType::OpLessThan, search_value);
+      table_scan->execute();
+      output = table_scan->get_output();
+    } else {
+      auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, search_value);
+      table_scan->execute();
+      auto validate = std::make_shared<Validate>(table_scan);
+      validate->set_transaction_context(context);
+      validate->execute();
+      output = validate->get_output();
+    }
+    benchmark::DoNotOptimize(output.get());
+  }
+
+  state.SetItemsProcessed(state.iterations() * table->row_count());
+}
+
+// Range scans are run with different selectivities, (not) equals scans once
+static void table_scan_arguments(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"scan_type", "selectivity"});
+  benchmark->Args({static_cast<int64_t>(ScanType::OpEquals), 0});
+  benchmark->Args({static_cast<int64_t>(ScanType::OpNotEquals), 100});
+  for (const auto scan_type : {ScanType::OpLessThan, ScanType::OpLessThanEquals, ScanType::OpGreaterThan,
+                               ScanType::OpGreaterThanEquals}) {
+    for (const auto selectivity_percent : {1, 10, 50, 90}) {
+      benchmark->Args({static_cast<int64_t>(scan_type), selectivity_percent});
+    }
+  }
+}
+
+BENCHMARK_CAPTURE(table_scan, IntValueColumn, "int", false)->Apply(table_scan_arguments);
+BENCHMARK_CAPTURE(table_scan, IntDictionaryColumn, "int", true)->Apply(table_scan_arguments);
+BENCHMARK_CAPTURE(table_scan, FloatValueColumn, "float", false)->Apply(table_scan_arguments);
+BENCHMARK_CAPTURE(table_scan, FloatDictionaryColumn, "float", true)->Apply(table_scan_arguments);
+BENCHMARK_CAPTURE(table_scan, StringValueColumn, "string", false)->Apply(table_scan_arguments);
+BENCHMARK_CAPTURE(table_scan, StringDictionaryColumn, "string", true)->Apply(table_scan_arguments);
+BENCHMARK_CAPTURE(index_scan, IntGroupKeyIndex, "int", ColumnIndexType::GroupKey)->Apply(table_scan_arguments);
+BENCHMARK_CAPTURE(index_scan, StringGroupKeyIndex, "string", ColumnIndexType::GroupKey)->Apply(table_scan_arguments);
+BENCHMARK_CAPTURE(index_scan, IntAdaptiveRadixTreeIndex, "int", ColumnIndexType::AdaptiveRadixTree)
+    ->Apply(table_scan_arguments);
+BENCHMARK_CAPTURE(index_scan, StringAdaptiveRadixTreeIndex, "string", ColumnIndexType::AdaptiveRadixTree)
+    ->Apply(table_scan_arguments);
+BENCHMARK_CAPTURE(key_lookup, TableScan, "TableScan");
+BENCHMARK_CAPTURE(key_lookup, IndexScan, "IndexScan");
+BENCHMARK_CAPTURE(key_lookup, TableIndexScan, "TableIndexScan");
+BENCHMARK_CAPTURE(key_lookup, TableIndexLookup, "TableIndexLookup");
+BENCHMARK_CAPTURE(validated_table_scan, ValidateFirst, true)->ArgName("selectivity")->Arg(1)->Arg(10)->Arg(50)->Arg(90);
+BENCHMARK_CAPTURE(validated_table_scan, ScanFirst, false)->ArgName("selectivity")->Arg(1)->Arg(10)->Arg(50)->Arg(90);
+
+}  // namespace opossum
@@ -0,0 +1,307 @@
+#include "benchmark_runner.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "operators/abstract_operator.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+double to_milliseconds(const std::chrono::nanoseconds duration) {
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+// returns the smallest latency that is at least as high as the given fraction of all latencies (nearest rank)
+std::chrono::nanoseconds percentile(const std::vector<std::chrono::nanoseconds>& sorted_latencies,
+                                    const double fraction) {
+  const auto rank = static_cast<size_t>(std::ceil(fraction * static_cast<double>(sorted_latencies.size())));
+  return sorted_latencies[std::max(rank, size_t{1}) - 1];
+}
+
+// writes the latency percentiles as a JSON object, the mean is computed from the duration
+void write_latencies(std::ostream& out, std::vector<std::chrono::nanoseconds> latencies,
+                     const std::chrono::nanoseconds duration, const std::string& indent) {
+  std::sort(latencies.begin(), latencies.end());
+
+  out << "{\n";
+  if (!latencies.empty()) {
+    out << indent << "  \"min\": " << to_milliseconds(latencies.front()) << ",\n";
+    out << indent << "  \"mean\": " << to_milliseconds(duration) / static_cast<double>(latencies.size()) << ",\n";
+    out << indent << "  \"p50\": " << to_milliseconds(percentile(latencies, 0.5)) << ",\n";
+    out << indent << "  \"p90\": " << to_milliseconds(percentile(latencies, 0.9)) << ",\n";
+    out << indent << "  \"p99\": " << to_milliseconds(percentile(latencies, 0.99)) << ",\n";
+    out << indent << "  \"p99.9\": " << to_milliseconds(percentile(latencies, 0.999)) << ",\n";
+    out << indent << "  \"max\": " << to_milliseconds(latencies.back()) << "\n";
+  }
+  out << indent << "}";
+}
+
+// quotes the value, escaping quotes, backslashes, and control characters as JSON requires
+std::string json_string(const std::string& value) {
+  std::ostringstream out;
+  out << '"';
+  for (const auto character : value) {
+    switch (character) {
+      case '"':
+        out << "\\\"";
+        break;
+      case '\\':
+        out << "\\\\";
+        break;
+      case '\n':
+        out << "\\n";
+        break;
+      case '\r':
+        out << "\\r";
+        break;
+      case '\t':
+        out << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(character) < 0x20) {
+          out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(character) << std::dec;
+        } else {
+          out << character;
+        }
+    }
+  }
+  out << '"';
+  return out.str();
+}
+
+}  // namespace
+
+BenchmarkRunner::BenchmarkRunner(std::vector<BenchmarkQuery> queries, const BenchmarkConfig& config)
+    : _queries(std::move(queries)), _config(config) {
+  Assert(_config.runs > 0, "Every query has to be run at least once");
+}
+
+std::vector<BenchmarkQuery> BenchmarkRunner::select_queries(std::vector<BenchmarkQuery> queries,
+                                                            const std::vector<std::string>& names) {
+  if (names.empty()) return queries;
+
+  for (const auto& name : names) {
+    const auto has_name = [&](const BenchmarkQuery& query) { return query.name == name; };
+    Assert(std::any_of(queries.cbegin(), queries.cend(), has_name), "Unknown query name " + name);
+  }
+
+  auto selected_queries = std::vector<BenchmarkQuery>{};
+  for (auto& query : queries) {
+    if (std::find(names.cbegin(), names.cend(), query.name) != names.cend()) {
+      selected_queries.emplace_back(std::move(query));
+    }
+  }
+  return selected_queries;
+}
+
+std::shared_ptr<const Table> BenchmarkRunner::execute_plan(const QueryPlan& plan) {
+  Assert(!plan.empty(), "Query plan is empty");
+  for (const auto& op : plan) op->execute();
+  return plan.back()->get_output();
+}
+
+void BenchmarkRunner::add_context(const std::string& key, const AllTypeVariant& value) {
+  _context.emplace_back(key, value);
+}
+
+void BenchmarkRunner::run(std::ostream& progress_out) {
+  _results.clear();
+
+  for (const auto& query : _queries) {
+    progress_out << "- " << query.name << ": " << query.description << std::endl;
+
+    for (size_t run = 0; run < _config.warmup_runs; ++run) execute_plan(query.build_plan());
+
+    auto result = QueryResult{};
+    while (result.latencies.size() < _config.runs && result.duration < _config.max_duration_per_query) {
+      // building the plan is not measured, it only creates the operator objects
+      const auto plan = query.build_plan();
+
+      const auto begin = std::chrono::steady_clock::now();
+      const auto output = execute_plan(plan);
+      const auto latency = std::chrono::steady_clock::now() - begin;
+
+      result.latencies.emplace_back(latency);
+      result.duration += latency;
+      result.result_row_count = output->row_count();
+    }
+
+    progress_out << "  " << result.latencies.size() << " runs, "
+                 << to_milliseconds(result.duration) / static_cast<double>(result.latencies.size())
+                 << " ms on average, " << result.result_row_count << " rows" << std::endl;
+    _results.emplace_back(std::move(result));
+  }
+}
+
+void BenchmarkRunner::run_concurrently(std::ostream& progress_out) {
+  _concurrent_results.clear();
+
+  for (const auto client_count : _config.client_counts) {
+    Assert(client_count > 0, "At least one client is needed");
+    progress_out << "- " << client_count << " clients" << std::endl;
+
+    // every client records its own results, so that the clients do not synchronize during the measurement
+    std::vector<std::vector<QueryResult>> client_results(client_count, std::vector<QueryResult>(_queries.size()));
+    std::atomic_bool failed{false};
+    std::exception_ptr exception;
+    std::mutex exception_mutex;
+
+    const auto begin = std::chrono::steady_clock::now();
+    const auto end = begin + _config.duration_per_client_count;
+
+    const auto client = [&](const size_t client_id) {
+      // the clients start with different queries, so that they do not run the same query at the same time
+      for (auto query_index = client_id % _queries.size(); std::chrono::steady_clock::now() < end && !failed;
+           query_index = (query_index + 1) % _queries.size()) {
+        try {
+          const auto plan = _queries[query_index].build_plan();
+
+          const auto query_begin = std::chrono::steady_clock::now();
+          const auto output = execute_plan(plan);
+          const auto latency = std::chrono::steady_clock::now() - query_begin;
+
+          auto& result = client_results[client_id][query_index];
+          result.latencies.emplace_back(latency);
+          result.duration += latency;
+          result.result_row_count = output->row_count();
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(exception_mutex);
+          if (!failed) exception = std::current_exception();
+          failed = true;
+        }
+      }
+    };
+
+    std::vector<std::thread> clients;
+    for (size_t client_id = 0; client_id < client_count; ++client_id) clients.emplace_back(client, client_id);
+    for (auto& client_thread : clients) client_thread.join();
+
+    if (exception) std::rethrow_exception(exception);
+
+    auto concurrent_result = ConcurrentResult{client_count, std::chrono::steady_clock::now() - begin,
+                                              std::vector<QueryResult>(_queries.size())};
+    auto query_count = size_t{0};
+    for (const auto& results : client_results) {
+      for (size_t query_index = 0; query_index < _queries.size(); ++query_index) {
+        auto& query_result = concurrent_result.query_results[query_index];
+        const auto& client_result = results[query_index];
+        query_result.latencies.insert(query_result.latencies.end(), client_result.latencies.cbegin(),
+                                      client_result.latencies.cend());
+        query_result.duration += client_result.duration;
+        query_result.result_row_count = std::max(query_result.result_row_count, client_result.result_row_count);
+        query_count += client_result.latencies.size();
+      }
+    }
+
+    progress_out << "  " << query_count << " queries, "
+                 << static_cast<double>(query_count) / to_milliseconds(concurrent_result.duration) * 1'000
+                 << " queries per second" << std::endl;
+    _concurrent_results.emplace_back(std::move(concurrent_result));
+  }
+}
+
+void BenchmarkRunner::write_report(std::ostream& out) const {
+  Assert(!_results.empty() || !_concurrent_results.empty(), "The benchmark has not been run");
+
+  // the caller's number format is restored at the end
+  const auto flags = out.flags();
+  const auto precision = out.precision();
+  out << std::setprecision(6) << std::fixed;
+  out << "{\n  \"context\": {";
+  for (size_t context_index = 0; context_index < _context.size(); ++context_index) {
+    const auto& [key, value] = _context[context_index];
+    out << (context_index == 0 ? "\n" : ",\n") << "    " << json_string(key) << ": ";
+    if (value.type() == typeid(std::string)) {
+      out << json_string(type_cast<std::string>(value));
+    } else {
+      out << value;
+    }
+  }
+  out << "\n  }";
+
+  if (!_results.empty()) {
+    out << ",\n  \"benchmarks\": [";
+    for (size_t query_index = 0; query_index < _queries.size(); ++query_index) {
+      const auto& query = _queries[query_index];
+      const auto& result = _results[query_index];
+      const auto run_count = static_cast<double>(result.latencies.size());
+
+      out << (query_index == 0 ? "\n" : ",\n");
+      out << "    {\n";
+      out << "      \"name\": " << json_string(query.name) << ",\n";
+      out << "      \"description\": " << json_string(query.description) << ",\n";
+      out << "      \"runs\": " << result.latencies.size() << ",\n";
+      out << "      \"result_row_count\": " << result.result_row_count << ",\n";
+      out << "      \"latency_ms\": ";
+      write_latencies(out, result.latencies, result.duration, "      ");
+      out << ",\n";
+      out << "      \"queries_per_second\": " << run_count / to_milliseconds(result.duration) * 1'000 << "\n";
+      out << "    }";
+    }
+    out << "\n  ]";
+  }
+
+  if (!_concurrent_results.empty()) {
+    out << ",\n  \"concurrent\": [";
+    for (size_t result_index = 0; result_index < _concurrent_results.size(); ++result_index) {
+      const auto& concurrent_result = _concurrent_results[result_index];
+      const auto duration_ms = to_milliseconds(concurrent_result.duration);
+
+      auto all_latencies = std::vector<std::chrono::nanoseconds>{};
+      auto all_duration = std::chrono::nanoseconds{0};
+      for (const auto& query_result : concurrent_result.query_results) {
+        all_latencies.insert(all_latencies.end(), query_result.latencies.cbegin(), query_result.latencies.cend());
+        all_duration += query_result.duration;
+      }
+
+      out << (result_index == 0 ? "\n" : ",\n");
+      out << "    {\n";
+      out << "      \"clients\": " << concurrent_result.client_count << ",\n";
+      out << "      \"duration_ms\": " << duration_ms << ",\n";
+      out << "      \"queries\": " << all_latencies.size() << ",\n";
+      out << "      \"queries_per_second\": " << static_cast<double>(all_latencies.size()) / duration_ms * 1'000
+          << ",\n";
+      out << "      \"latency_ms\": ";
+      write_latencies(out, all_latencies, all_duration, "      ");
+      out << ",\n      \"benchmarks\": [";
+
+      for (size_t query_index = 0; query_index < _queries.size(); ++query_index) {
+        const auto& query_result = concurrent_result.query_results[query_index];
+
+        out << (query_index == 0 ? "\n" : ",\n");
+        out << "        {\n";
+        out << "          \"name\": " << json_string(_queries[query_index].name) << ",\n";
+        out << "          \"runs\": " << query_result.latencies.size() << ",\n";
+        out << "          \"queries_per_second\": "
+            << static_cast<double>(query_result.latencies.size()) / duration_ms * 1'000 << ",\n";
+        out << "          \"latency_ms\": ";
+        write_latencies(out, query_result.latencies, query_result.duration, "          ");
+        out << "\n        }";
+      }
+      out << "\n      ]\n    }";
+    }
+    out << "\n  ]";
+  }
+
+  out << "\n}\n";
+  out.flags(flags);
+  out.precision(precision);
+}
+
+}  // namespace opossum
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Table;
+
+// A query plan as a list of operators in execution order, i.e., every operator comes after its inputs. The last
+// operator produces the result.
+using QueryPlan = std::vector<std::shared_ptr<AbstractOperator>>;
+
+struct BenchmarkQuery {
+  std::string name;
+  std::string description;
+  // builds a new plan for every run, as operators can only be executed once
+  std::function<QueryPlan()> build_plan;
+};
+
+struct BenchmarkConfig {
+  // number of measured runs per query
+  size_t runs = 10;
+  // number of unmeasured runs per query before the measurement
+  size_t warmup_runs = 1;
+  // a query is not run again once its measured runs took longer than this
+  std::chrono::milliseconds max_duration_per_query{60'000};
+  // numbers of concurrent clients that run_concurrently measures, one after the other
+  std::vector<size_t> client_counts{1};
+  // time that run_concurrently spends on each number of clients
+  std::chrono::milliseconds duration_per_client_count{60'000};
+};
+
+/**
+ * The BenchmarkRunner measures the latency percentiles and the throughput of the queries of a benchmark and reports
+ * them as JSON. It has two modes:
+ *  - run() executes every query config.runs times, one run after the other.
+ *  - run_concurrently() starts the given numbers of client threads, each of which builds and executes the queries in
+ *    a round-robin fashion until the time is up. This exposes contention (e.g., in the StorageManager, the
+ *    BufferManager, allocators, or the ChunkScheduler's threads) that does not show with a single query at a time.
+ */
+class BenchmarkRunner {
+ public:
+  BenchmarkRunner(std::vector<BenchmarkQuery> queries, const BenchmarkConfig& config);
+
+  // returns the queries with the given names in the order of queries, or all queries if names is empty. A name may
+  // be given more than once, but the query is still only returned once. Throws if a name does not match any query.
+  static std::vector<BenchmarkQuery> select_queries(std::vector<BenchmarkQuery> queries,
+                                                    const std::vector<std::string>& names);
+
+  // executes the operators of the plan in order and returns the output of the last one
+  static std::shared_ptr<const Table> execute_plan(const QueryPlan& plan);
+
+  // adds an entry to the "context" object of the report, e.g., the scale factor
+  void add_context(const std::string& key, const AllTypeVariant& value);
+
+  // runs all queries one after the other, printing the progress to progress_out
+  void run(std::ostream& progress_out = std::cerr);
+
+  // runs the queries with every number of clients in config.client_counts
+  void run_concurrently(std::ostream& progress_out = std::cerr);
+
+  void write_report(std::ostream& out) const;
+
+ protected:
+  struct QueryResult {
+    std::vector<std::chrono::nanoseconds> latencies;
+    std::chrono::nanoseconds duration{0};
+    uint64_t result_row_count = 0;
+  };
+
+  struct ConcurrentResult {
+    size_t client_count;
+    std::chrono::nanoseconds duration;
+    // one per query, the duration is the sum of the latencies
+    std::vector<QueryResult> query_results;
+  };
+
+  const std::vector<BenchmarkQuery> _queries;
+  const BenchmarkConfig _config;
+  std::vector<std::pair<std::string, AllTypeVariant>> _context;
+  std::vector<QueryResult> _results;
+  std::vector<ConcurrentResult> _concurrent_results;
+};
+
+}  // namespace opossum
@@ -0,0 +1,71 @@
+#include "tpch_benchmark_options.hpp"
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+const char* const TPCH_BENCHMARK_USAGE =
+    "Usage: hyriseTpchBenchmark [options]\n"
+    "  --scale <factor>        TPC-H scale factor, 1 means 6 million lineitems (default: 0.1)\n"
+    "  --chunk_size <rows>     chunk size of the generated tables (default: 100000)\n"
+    "  --no_compression        keep the generated chunks uncompressed\n"
+    "  --runs <count>          measured runs per query (default: 10)\n"
+    "  --warmup <count>        unmeasured runs per query before the measurement (default: 1)\n"
+    "  --time <seconds>        maximum time spent on the measured runs of a query, or on each number of clients\n"
+    "                          with --clients (default: 60)\n"
+    "  --clients <1,2,4,...>   run the queries concurrently with these numbers of client threads instead of one\n"
+    "                          after the other and report the throughput and tail latencies for each of them\n"
+    "  --queries <Q1,Q6,...>   comma-separated list of the queries to run (default: all)\n"
+    "  --output <file>         file the JSON report is written to (default: standard output)\n";
+
+TpchBenchmarkOptions parse_tpch_benchmark_options(const std::vector<std::string>& args) {
+  auto options = TpchBenchmarkOptions{};
+
+  for (size_t arg_index = 0; arg_index < args.size(); ++arg_index) {
+    const auto& arg = args[arg_index];
+    const auto next_value = [&]() {
+      Assert(arg_index + 1 < args.size(), "Missing value for " + arg);
+      return args[++arg_index];
+    };
+
+    if (arg == "--scale") {
+      options.scale_factor = std::stof(next_value());
+    } else if (arg == "--chunk_size") {
+      options.chunk_size = static_cast<uint32_t>(std::stoul(next_value()));
+    } else if (arg == "--no_compression") {
+      options.compress = false;
+    } else if (arg == "--runs") {
+      options.config.runs = std::stoul(next_value());
+    } else if (arg == "--warmup") {
+      options.config.warmup_runs = std::stoul(next_value());
+    } else if (arg == "--time") {
+      options.config.max_duration_per_query = std::chrono::seconds{std::stoul(next_value())};
+      options.config.duration_per_client_count = options.config.max_duration_per_query;
+    } else if (arg == "--queries") {
+      std::istringstream names(next_value());
+      for (std::string name; std::getline(names, name, ',');) options.query_names.emplace_back(name);
+    } else if (arg == "--clients") {
+      options.concurrent = true;
+      options.config.client_counts.clear();
+      std::istringstream client_counts(next_value());
+      for (std::string count; std::getline(client_counts, count, ',');) {
+        options.config.client_counts.emplace_back(std::stoul(count));
+      }
+    } else if (arg == "--output") {
+      options.output_file = next_value();
+    } else if (arg == "--help") {
+      options.show_help = true;
+    } else {
+      Fail("Unknown option " + arg);
+    }
+  }
+
+  return options;
+}
+
+}  // namespace opossum
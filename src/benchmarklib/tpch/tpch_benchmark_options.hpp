@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "benchmark_runner.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+extern const char* const TPCH_BENCHMARK_USAGE;
+
+// The command line options of hyriseTpchBenchmark, see TPCH_BENCHMARK_USAGE
+struct TpchBenchmarkOptions {
+  float scale_factor = 0.1f;
+  uint32_t chunk_size = 100'000;
+  bool compress = true;
+  BenchmarkConfig config;
+  // empty means all queries
+  std::vector<std::string> query_names;
+  // run the queries with BenchmarkRunner::run_concurrently instead of BenchmarkRunner::run
+  bool concurrent = false;
+  // empty means standard output
+  std::string output_file;
+  bool show_help = false;
+};
+
+// parses the arguments without the program name, throws std::logic_error (or std::invalid_argument for non-numeric
+// values) if they are invalid
+TpchBenchmarkOptions parse_tpch_benchmark_options(const std::vector<std::string>& args);
+
+}  // namespace opossum
@@ -0,0 +1,123 @@
+#include "tpch_queries.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "operators/get_table.hpp"
+#include "operators/limit.hpp"
+#include "operators/materialize.hpp"
+#include "operators/projection.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/top_k.hpp"
+#include "storage/storage_manager.hpp"
+#include "tpch_table_generator.hpp"
+
+namespace opossum {
+
+namespace {
+
+ColumnID column_id(const std::string& table_name, const std::string& column_name) {
+  return StorageManager::get().get_table(table_name)->column_id_by_name(column_name);
+}
+
+// Q1 (pricing summary report): the shipped lineitems, sorted by the grouping columns instead of being aggregated
+QueryPlan q1() {
+  const auto get_table = std::make_shared<GetTable>("lineitem");
+  const auto scan = std::make_shared<TableScan>(get_table, column_id("lineitem", "l_shipdate"),
+                                                ScanType::OpLessThanEquals, TPCH_DATE_1998_09_02);
+  const auto projection = std::make_shared<Projection>(
+      scan, std::vector<ColumnID>{column_id("lineitem", "l_returnflag"), column_id("lineitem", "l_linestatus"),
+                                  column_id("lineitem", "l_quantity"), column_id("lineitem", "l_extendedprice"),
+                                  column_id("lineitem", "l_discount"), column_id("lineitem", "l_tax")});
+  const auto sort = std::make_shared<Sort>(
+      projection, std::vector<SortColumnDefinition>{{ColumnID{0}, OrderByMode::Ascending},
+                                                    {ColumnID{1}, OrderByMode::Ascending}});
+  return {get_table, scan, projection, sort};
+}
+
+// Q3 (shipping priority): the ten most expensive orders placed before 1995-03-15, without the join with customer and
+// lineitem
+QueryPlan q3() {
+  const auto get_table = std::make_shared<GetTable>("orders");
+  const auto scan = std::make_shared<TableScan>(get_table, column_id("orders", "o_orderdate"), ScanType::OpLessThan,
+                                                TPCH_DATE_1995_03_15);
+  const auto top_k = std::make_shared<TopK>(
+      scan, SortColumnDefinition{column_id("orders", "o_totalprice"), OrderByMode::Descending}, 10);
+  return {get_table, scan, top_k};
+}
+
+// Q6 (forecasting revenue change): the materialized prices and discounts of the qualifying lineitems, without the sum
+QueryPlan q6() {
+  const auto get_table = std::make_shared<GetTable>("lineitem");
+  const auto shipdate_from = std::make_shared<TableScan>(get_table, column_id("lineitem", "l_shipdate"),
+                                                         ScanType::OpGreaterThanEquals, TPCH_DATE_1994_01_01);
+  const auto shipdate_to = std::make_shared<TableScan>(shipdate_from, column_id("lineitem", "l_shipdate"),
+                                                       ScanType::OpLessThan, TPCH_DATE_1995_01_01);
+  const auto discount_from = std::make_shared<TableScan>(shipdate_to, column_id("lineitem", "l_discount"),
+                                                         ScanType::OpGreaterThanEquals, 5.0f);
+  const auto discount_to = std::make_shared<TableScan>(discount_from, column_id("lineitem", "l_discount"),
+                                                       ScanType::OpLessThanEquals, 7.0f);
+  const auto quantity = std::make_shared<TableScan>(discount_to, column_id("lineitem", "l_quantity"),
+                                                    ScanType::OpLessThan, 24);
+  const auto projection = std::make_shared<Projection>(
+      quantity,
+      std::vector<ColumnID>{column_id("lineitem", "l_extendedprice"), column_id("lineitem", "l_discount")});
+  const auto materialize = std::make_shared<Materialize>(projection);
+  return {get_table, shipdate_from, shipdate_to, discount_from, discount_to, quantity, projection, materialize};
+}
+
+// Q10 (returned item reporting): the 20 most expensive orders of the fourth quarter of 1993, found by a full sort
+// instead of the aggregation over the joined lineitems
+QueryPlan q10() {
+  const auto get_table = std::make_shared<GetTable>("orders");
+  const auto orderdate_from = std::make_shared<TableScan>(get_table, column_id("orders", "o_orderdate"),
+                                                          ScanType::OpGreaterThanEquals, TPCH_DATE_1993_10_01);
+  const auto orderdate_to = std::make_shared<TableScan>(orderdate_from, column_id("orders", "o_orderdate"),
+                                                        ScanType::OpLessThan, TPCH_DATE_1994_01_01);
+  const auto sort = std::make_shared<Sort>(
+      orderdate_to,
+      std::vector<SortColumnDefinition>{{column_id("orders", "o_totalprice"), OrderByMode::Descending}});
+  const auto limit = std::make_shared<Limit>(sort, 20);
+  return {get_table, orderdate_from, orderdate_to, sort, limit};
+}
+
+// Q18 (large volume customer): the first 100 lineitems with a large quantity by order key, without the aggregation
+// and the joins
+QueryPlan q18() {
+  const auto get_table = std::make_shared<GetTable>("lineitem");
+  const auto scan = std::make_shared<TableScan>(get_table, column_id("lineitem", "l_quantity"),
+                                                ScanType::OpGreaterThan, 45);
+  const auto projection = std::make_shared<Projection>(
+      scan, std::vector<ColumnID>{column_id("lineitem", "l_orderkey"), column_id("lineitem", "l_quantity")});
+  const auto sort = std::make_shared<Sort>(projection, std::vector<SortColumnDefinition>{{ColumnID{0}}});
+  const auto limit = std::make_shared<Limit>(sort, 100);
+  return {get_table, scan, projection, sort, limit};
+}
+
+// Q22 (global sales opportunity): the 100 customers of one market segment with the highest positive account balance,
+// without the subqueries
+QueryPlan q22() {
+  const auto get_table = std::make_shared<GetTable>("customer");
+  const auto segment = std::make_shared<TableScan>(get_table, column_id("customer", "c_mktsegment"),
+                                                   ScanType::OpEquals, std::string{"b"});
+  const auto balance = std::make_shared<TableScan>(segment, column_id("customer", "c_acctbal"),
+                                                   ScanType::OpGreaterThan, 0.0f);
+  const auto top_k = std::make_shared<TopK>(
+      balance, SortColumnDefinition{column_id("customer", "c_acctbal"), OrderByMode::Descending}, 100);
+  return {get_table, segment, balance, top_k};
+}
+
+}  // namespace
+
+std::vector<BenchmarkQuery> tpch_queries() {
+  return {{"Q1", "scan, projection, and sort of lineitem", q1},
+          {"Q3", "scan and top-k of orders", q3},
+          {"Q6", "five scans, projection, and materialization of lineitem", q6},
+          {"Q10", "two scans, sort, and limit of orders", q10},
+          {"Q18", "scan, projection, sort, and limit of lineitem", q18},
+          {"Q22", "two scans and top-k of customer", q22}};
+}
+
+}  // namespace opossum
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <vector>
+
+#include "benchmark_runner.hpp"
+
+namespace opossum {
+
+/**
+ * Returns query plans modelled after TPC-H queries, to be run on the tables of TpchTableGenerator. As there are no
+ * join and aggregate operators yet, the plans only contain the scans, projections, and sorts of the original queries,
+ * and aggregations are replaced by sorting on the grouping columns. Each query's description names its adaptation.
+ * The plans look up the tables and column ids in the StorageManager when they are built.
+ */
+std::vector<BenchmarkQuery> tpch_queries();
+
+}  // namespace opossum
@@ -0,0 +1,70 @@
+#include "tpch_table_generator.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/table_generator.hpp"
+
+namespace opossum {
+
+TpchTableGenerator::TpchTableGenerator(const float scale_factor, const uint32_t chunk_size, const bool compress)
+    : _scale_factor(scale_factor), _chunk_size(chunk_size), _compress(compress) {}
+
+std::map<std::string, std::shared_ptr<Table>> TpchTableGenerator::generate_all_tables() const {
+  const auto customer_count = _row_count(150'000);
+  const auto order_count = _row_count(1'500'000);
+  const auto lineitem_count = _row_count(6'000'000);
+  const auto part_count = _row_count(200'000);
+
+  using Distribution = ColumnDataDistribution;
+  const auto table_generator = TableGenerator{};
+
+  std::map<std::string, std::shared_ptr<Table>> tables;
+
+  tables["customer"] = table_generator.generate_table(
+      {{"c_custkey", "int", Distribution::make_sorted_config(customer_count)},
+       {"c_nationkey", "int", Distribution::make_uniform_config(25)},
+       {"c_acctbal", "float", Distribution::make_uniform_config(11'000)},
+       {"c_mktsegment", "string", Distribution::make_uniform_config(5), 1}},
+      customer_count, _chunk_size, _compress);
+
+  tables["orders"] = table_generator.generate_table(
+      {{"o_orderkey", "int", Distribution::make_sorted_config(order_count)},
+       {"o_custkey", "int", Distribution::make_zipf_config(customer_count)},
+       {"o_orderstatus", "string", Distribution::make_uniform_config(3), 1},
+       {"o_totalprice", "float", Distribution::make_uniform_config(500'000)},
+       {"o_orderdate", "int", Distribution::make_uniform_config(2'406)},
+       {"o_orderpriority", "string", Distribution::make_uniform_config(5), 1}},
+      order_count, _chunk_size, _compress);
+
+  // lineitems are stored in the order of their orders, as dbgen generates them
+  tables["lineitem"] = table_generator.generate_table(
+      {{"l_orderkey", "int", Distribution::make_sorted_config(order_count)},
+       {"l_partkey", "int", Distribution::make_uniform_config(part_count)},
+       {"l_quantity", "int", Distribution::make_uniform_config(50)},
+       {"l_extendedprice", "float", Distribution::make_uniform_config(100'000)},
+       {"l_discount", "float", Distribution::make_uniform_config(11)},
+       {"l_tax", "float", Distribution::make_uniform_config(9)},
+       {"l_returnflag", "string", Distribution::make_uniform_config(3), 1},
+       {"l_linestatus", "string", Distribution::make_uniform_config(2), 1},
+       {"l_shipdate", "int", Distribution::make_uniform_config(2'526)}},
+      lineitem_count, _chunk_size, _compress);
+
+  return tables;
+}
+
+void TpchTableGenerator::generate_and_store() const {
+  for (const auto& [name, table] : generate_all_tables()) {
+    StorageManager::get().add_table(name, table);
+  }
+}
+
+size_t TpchTableGenerator::_row_count(const size_t row_count_at_scale_factor_1) const {
+  return std::max(size_t{1}, static_cast<size_t>(static_cast<double>(row_count_at_scale_factor_1) * _scale_factor));
+}
+
+}  // namespace opossum
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Days since 1992-01-01, which is how the TPC-H dates are stored in the generated tables
+constexpr auto TPCH_DATE_1993_10_01 = int32_t{639};
+constexpr auto TPCH_DATE_1994_01_01 = int32_t{731};
+constexpr auto TPCH_DATE_1995_01_01 = int32_t{1096};
+constexpr auto TPCH_DATE_1995_03_15 = int32_t{1169};
+constexpr auto TPCH_DATE_1998_09_02 = int32_t{2436};
+
+/**
+ * Generates the tables customer, orders, and lineitem with the sizes, keys, and value domains of the TPC-H tables of
+ * the same name at the given scale factor (scale factor 1 means 6 million lineitems). Only the columns that the
+ * queries in tpch_queries.hpp use are generated, and their values are synthetic (see TableGenerator):
+ *  - dates are ints that count the days since 1992-01-01,
+ *  - prices, discounts (in percent), and taxes (in percent) are floats,
+ *  - flags, statuses, priorities, and segments are strings of one letter ("a", "b", ...).
+ * The keys are dense and sorted, o_custkey follows a Zipf distribution so that some customers order much more than
+ * others.
+ */
+class TpchTableGenerator {
+ public:
+  explicit TpchTableGenerator(float scale_factor, uint32_t chunk_size = 100'000, bool compress = true);
+
+  std::map<std::string, std::shared_ptr<Table>> generate_all_tables() const;
+
+  // generates all tables and adds them to the StorageManager
+  void generate_and_store() const;
+
+ protected:
+  size_t _row_count(size_t row_count_at_scale_factor_1) const;
+
+  const float _scale_factor;
+  const uint32_t _chunk_size;
+  const bool _compress;
+};
+
+}  // namespace opossum
@@ -0,0 +1,61 @@
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark_runner.hpp"
+#include "tpch/tpch_benchmark_options.hpp"
+#include "tpch/tpch_queries.hpp"
+#include "tpch/tpch_table_generator.hpp"
+
+int main(int argc, char* argv[]) {
+  auto options = opossum::TpchBenchmarkOptions{};
+  auto queries = std::vector<opossum::BenchmarkQuery>{};
+
+  try {
+    options = opossum::parse_tpch_benchmark_options(std::vector<std::string>(argv + 1, argv + argc));
+    if (options.show_help) {
+      std::cout << opossum::TPCH_BENCHMARK_USAGE;
+      return 0;
+    }
+    queries = opossum::BenchmarkRunner::select_queries(opossum::tpch_queries(), options.query_names);
+  } catch (const std::exception& exception) {
+    std::cerr << exception.what() << "\n" << opossum::TPCH_BENCHMARK_USAGE;
+    return 1;
+  }
+
+  std::cerr << "Generating TPC-H tables with scale factor " << options.scale_factor << std::endl;
+  const auto generation_begin = std::chrono::steady_clock::now();
+  opossum::TpchTableGenerator(options.scale_factor, options.chunk_size, options.compress).generate_and_store();
+  const auto generation_duration = std::chrono::steady_clock::now() - generation_begin;
+
+  auto runner = opossum::BenchmarkRunner(std::move(queries), options.config);
+  runner.add_context("benchmark", std::string{"TPC-H"});
+  runner.add_context("scale_factor", options.scale_factor);
+  runner.add_context("chunk_size", static_cast<int64_t>(options.chunk_size));
+  runner.add_context("encoding", std::string{options.compress ? "Dictionary" : "Unencoded"});
+  runner.add_context("build_type", std::string{IS_DEBUG ? "debug" : "release"});
+  runner.add_context("table_generation_ms",
+                     std::chrono::duration<double, std::milli>(generation_duration).count());
+
+  if (options.concurrent) {
+    std::cerr << "Running the queries concurrently for " << options.config.duration_per_client_count.count() / 1'000
+              << " s per number of clients" << std::endl;
+    runner.run_concurrently();
+  } else {
+    std::cerr << "Running " << options.config.runs << " runs per query" << std::endl;
+    runner.run();
+  }
+
+  if (options.output_file.empty()) {
+    runner.write_report(std::cout);
+  } else {
+    std::ofstream out(options.output_file);
+    runner.write_report(out);
+    std::cerr << "Report written to " << options.output_file << std::endl;
+  }
+
+  return 0;
+}
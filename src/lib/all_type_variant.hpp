@@ -15,6 +15,7 @@
 #include <boost/preprocessor/seq/transform.hpp>
 
 #include <cstdint>
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -24,6 +25,20 @@ namespace opossum {
 
 namespace hana = boost::hana;
 
+// The value of an AllTypeVariant that represents NULL. In contrast to SQL, NULL equals NULL and sorts before all other
+// values here, so that AllTypeVariants can be compared and sorted. Operators implement the SQL semantics instead, e.g.,
+// a TableScan never matches NULL unless it asks for it with ScanType::OpIsNull.
+struct NullValue {};
+
+inline bool operator==(const NullValue&, const NullValue&) { return true; }
+inline bool operator!=(const NullValue&, const NullValue&) { return false; }
+inline bool operator<(const NullValue&, const NullValue&) { return false; }
+inline bool operator<=(const NullValue&, const NullValue&) { return true; }
+inline bool operator>(const NullValue&, const NullValue&) { return false; }
+inline bool operator>=(const NullValue&, const NullValue&) { return true; }
+
+inline std::ostream& operator<<(std::ostream& stream, const NullValue&) { return stream << "NULL"; }
+
 namespace detail {
 
 #define EXPAND_TO_HANA_TYPE(s, data, elem) boost::hana::type_c<elem>
@@ -60,16 +75,25 @@ static constexpr auto column_types = hana::transform(column_types_as_tuples, to_
 // Converts tuple to mpl vector
 using TypesAsMplVector = decltype(hana::to<hana::ext::boost::mpl::vector_tag>(types));
 
+// Prepends NullValue, which is not a column type, to the mpl vector
+using TypesIncludingNull = typename boost::mpl::push_front<TypesAsMplVector, NullValue>::type;
+
 // Creates boost::variant from mpl vector
-using AllTypeVariant = typename boost::make_variant_over<detail::TypesAsMplVector>::type;
+using AllTypeVariant = typename boost::make_variant_over<detail::TypesIncludingNull>::type;
 
 }  // namespace detail
 
 static constexpr auto types = detail::types;
+static constexpr auto types_including_null = hana::prepend(detail::types, hana::type_c<NullValue>);
 static constexpr auto column_types = detail::column_types;
 
+// A default-constructed AllTypeVariant is NULL
 using AllTypeVariant = detail::AllTypeVariant;
 
+static const auto NULL_VALUE = AllTypeVariant{};
+
+inline bool variant_is_null(const AllTypeVariant& value) { return value.which() == 0; }
+
 /**
  * @defgroup Macros for explicitly instantiating template classes
  *
@@ -0,0 +1,247 @@
+#include "chunk_compactor.hpp"
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "operators/abstract_read_write_operator.hpp"
+#include "operators/delete.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/column_value_reader.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "transaction_context.hpp"
+#include "transaction_manager.hpp"
+#include "utils/assert.hpp"
+#include "utils/create_reference_table.hpp"
+
+namespace opossum {
+
+namespace {
+
+// appends the compacted chunk on behalf of the compaction's transaction (see Table::append_uncommitted_chunk)
+class InsertCompactedChunk : public AbstractReadWriteOperator {
+ public:
+  InsertCompactedChunk(std::shared_ptr<Table> table, Chunk chunk, const std::optional<ChunkID> released_chunk_id)
+      : _table(std::move(table)), _chunk(std::move(chunk)), _released_chunk_id(released_chunk_id) {}
+
+  const std::string name() const override { return "InsertCompactedChunk"; }
+
+  void commit_records(const CommitID commit_id) override {
+    for (ChunkOffset chunk_offset = 0; chunk_offset < _mvcc_columns->capacity(); ++chunk_offset) {
+      _mvcc_columns->begin_cids[chunk_offset] = commit_id;
+      _mvcc_columns->tids[chunk_offset] = INVALID_TRANSACTION_ID;
+    }
+  }
+
+  void rollback_records() override {
+    for (ChunkOffset chunk_offset = 0; chunk_offset < _mvcc_columns->capacity(); ++chunk_offset) {
+      _mvcc_columns->tids[chunk_offset] = INVALID_TRANSACTION_ID;
+    }
+    _mvcc_columns->invalid_row_count = _mvcc_columns->capacity();
+  }
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override {
+    const auto context = _register_with_transaction();
+    const auto chunk_id =
+        _table->append_uncommitted_chunk(std::move(_chunk), context->transaction_id(), _released_chunk_id);
+    _mvcc_columns = _table->get_chunk(chunk_id)->mvcc_columns();
+    return nullptr;
+  }
+
+  const std::shared_ptr<Table> _table;
+  Chunk _chunk;
+  const std::optional<ChunkID> _released_chunk_id;
+  std::shared_ptr<Chunk::MvccColumns> _mvcc_columns;
+};
+
+}  // namespace
+
+ChunkCompactor::ChunkCompactor(const float invalid_row_ratio_threshold)
+    : _invalid_row_ratio_threshold(invalid_row_ratio_threshold) {
+  Assert(invalid_row_ratio_threshold > 0.0f && invalid_row_ratio_threshold <= 1.0f,
+         "The threshold has to be in (0, 1]");
+}
+
+ChunkCompactor::~ChunkCompactor() { stop(); }
+
+size_t ChunkCompactor::compact_table(const std::string& table_name) {
+  std::lock_guard<std::mutex> lock(_compaction_mutex);
+
+  const auto table = StorageManager::get().get_table(table_name);
+  Assert(table->uses_mvcc(), "Only the chunks of MVCC tables can be compacted");
+
+  // compacted chunks are appended, which is why the chunk count is taken upfront
+  const auto chunk_count = table->chunk_count();
+  auto compacted_chunk_count = size_t{0};
+  for (ChunkID chunk_id{0}; chunk_id + 1u < chunk_count; ++chunk_id) {
+    // the row counts are known without loading a spilled chunk, only chunks that are compacted are loaded
+    const auto chunk = table->get_unpinned_chunk(chunk_id);
+    const auto chunk_size = chunk->size();
+    const auto invalid_row_count = chunk->invalid_row_count();
+
+    // chunks in which all rows are invalid already only have to be released
+    if (chunk_size == 0 || invalid_row_count == chunk_size) continue;
+    if (static_cast<float>(invalid_row_count) / chunk_size < _invalid_row_ratio_threshold) continue;
+
+    if (_compact_chunk(table_name, table, chunk_id)) ++compacted_chunk_count;
+  }
+
+  return compacted_chunk_count;
+}
+
+size_t ChunkCompactor::release_chunks(const std::string& table_name) {
+  std::lock_guard<std::mutex> lock(_compaction_mutex);
+
+  const auto table = StorageManager::get().get_table(table_name);
+  Assert(table->uses_mvcc(), "Only the chunks of MVCC tables can be released");
+
+  // the rows of a chunk that is fully invalidated for the oldest active snapshot are invisible to all transactions
+  const auto snapshot_commit_id = TransactionManager::get().lowest_active_snapshot_commit_id();
+  std::vector<ChunkID> chunk_ids;
+  for (ChunkID chunk_id{0}; chunk_id + 1u < table->chunk_count(); ++chunk_id) {
+    if (table->get_unpinned_chunk(chunk_id)->is_fully_invalidated(snapshot_commit_id)) chunk_ids.push_back(chunk_id);
+  }
+
+  table->release_chunks(chunk_ids);
+
+  // Transactions that started before the release ended may hold RowIDs of the released chunks. Their snapshots are
+  // not after the last commit at this point, so that the chunk ids can be reused once the lowest active snapshot is.
+  const auto release_commit_id = TransactionManager::get().last_commit_id();
+  auto& released_chunk_ids = _released_chunk_ids[table_name];
+  for (const auto& chunk_id : chunk_ids) released_chunk_ids.emplace_back(chunk_id, release_commit_id);
+
+  return chunk_ids.size();
+}
+
+void ChunkCompactor::run_once() {
+  for (const auto& table_name : StorageManager::get().table_names()) {
+    if (!StorageManager::get().get_table(table_name)->uses_mvcc()) continue;
+
+    release_chunks(table_name);
+    compact_table(table_name);
+  }
+}
+
+void ChunkCompactor::start(const std::chrono::milliseconds interval) {
+  Assert(!is_running(), "The ChunkCompactor is already running");
+
+  _stop_requested = false;
+  _thread = std::thread([this, interval]() {
+    std::unique_lock<std::mutex> lock(_thread_mutex);
+    while (!_stop_condition.wait_for(lock, interval, [this]() { return _stop_requested; })) {
+      lock.unlock();
+      run_once();
+      lock.lock();
+    }
+  });
+}
+
+void ChunkCompactor::stop() {
+  if (!is_running()) return;
+
+  {
+    std::lock_guard<std::mutex> lock(_thread_mutex);
+    _stop_requested = true;
+  }
+  _stop_condition.notify_all();
+  _thread.join();
+}
+
+bool ChunkCompactor::is_running() const { return _thread.joinable(); }
+
+bool ChunkCompactor::_compact_chunk(const std::string& table_name, const std::shared_ptr<Table>& table,
+                                    const ChunkID chunk_id) {
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto chunk = table->get_chunk(chunk_id);
+
+  // reference all rows of the chunk and keep the ones that are visible to the compaction's transaction
+  std::vector<ChunkOffset> chunk_offsets(chunk->size());
+  std::iota(chunk_offsets.begin(), chunk_offsets.end(), ChunkOffset{0});
+  auto chunk_rows = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < table->col_count(); ++column_id) {
+    chunk_rows->add_column_definition(table->column_name(column_id), table->column_type(column_id),
+                                      table->column_is_nullable(column_id));
+  }
+  chunk_rows->emplace_chunk(create_reference_chunk(table, chunk_id, chunk_offsets, chunk->get_allocator()));
+
+  auto table_wrapper = std::make_shared<TableWrapper>(chunk_rows);
+  table_wrapper->execute();
+  auto validate = std::make_shared<Validate>(table_wrapper);
+  validate->set_transaction_context(context);
+  validate->execute();
+
+  // locking the rows fails if another transaction modifies them at the same time
+  auto delete_operator = std::make_shared<Delete>(table_name, validate);
+  delete_operator->set_transaction_context(context);
+  delete_operator->execute();
+  if (delete_operator->execute_failed()) {
+    context->rollback();
+    return false;
+  }
+
+  const auto valid_rows = validate->get_output();
+  if (valid_rows->row_count() > 0) {
+    // like compress_chunk, the columns are built on the chunk's node
+    Chunk compacted_chunk(chunk->numa_node(), chunk->get_allocator());
+    Topology::get().run_on_node(chunk->numa_node(), [&]() {
+      for (ColumnID column_id{0}; column_id < table->col_count(); ++column_id) {
+        const auto& column_type = table->column_type(column_id);
+        resolve_data_type(column_type, [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          ColumnValueReader<ColumnDataType> reader(*valid_rows, column_id);
+
+          const auto nullable = table->column_is_nullable(column_id);
+          pmr_vector<ColumnDataType> values(chunk->get_allocator());
+          pmr_vector<bool> null_values(chunk->get_allocator());
+          values.reserve(valid_rows->row_count());
+          if (nullable) null_values.reserve(valid_rows->row_count());
+          for (ChunkID valid_chunk_id{0}; valid_chunk_id < valid_rows->chunk_count(); ++valid_chunk_id) {
+            const auto valid_chunk_size = valid_rows->get_chunk(valid_chunk_id)->size();
+            for (ChunkOffset chunk_offset = 0; chunk_offset < valid_chunk_size; ++chunk_offset) {
+              const auto row_id = RowID{valid_chunk_id, chunk_offset};
+              const auto is_null = nullable && reader.is_null(row_id);
+              values.push_back(is_null ? ColumnDataType{} : reader.get(row_id));
+              if (nullable) null_values.push_back(is_null);
+            }
+          }
+
+          const auto value_column =
+              nullable ? std::make_shared<ValueColumn<ColumnDataType>>(std::move(values), null_values)
+                       : std::make_shared<ValueColumn<ColumnDataType>>(std::move(values));
+          compacted_chunk.add_column(make_shared_by_column_type<BaseColumn, DictionaryColumn>(
+              column_type, value_column, chunk->get_allocator()));
+        });
+      }
+    });
+
+    // the chunk takes the place of a released chunk once no active transaction can hold RowIDs of it anymore
+    auto released_chunk_id = std::optional<ChunkID>{};
+    auto& released_chunk_ids = _released_chunk_ids[table_name];
+    if (!released_chunk_ids.empty() &&
+        released_chunk_ids.front().second < TransactionManager::get().lowest_active_snapshot_commit_id()) {
+      released_chunk_id = released_chunk_ids.front().first;
+      released_chunk_ids.pop_front();
+    }
+
+    auto insert = std::make_shared<InsertCompactedChunk>(table, std::move(compacted_chunk), released_chunk_id);
+    insert->set_transaction_context(context);
+    insert->execute();
+  }
+
+  context->commit();
+  return true;
+}
+
+}  // namespace opossum
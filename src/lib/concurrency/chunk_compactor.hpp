@@ -0,0 +1,77 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// The ChunkCompactor reclaims the rows of MVCC tables that were deleted (see Delete) or whose insertion was rolled
+// back. Such rows are only invalidated in place, so that without compaction, the tables of update-heavy workloads grow
+// forever and scans keep reading rows that no transaction sees.
+//
+// Reclaiming a chunk takes two steps:
+// 1. Compaction: Once the share of invalid rows of an immutable chunk reaches the threshold, a transaction deletes the
+//    remaining valid rows and appends them as a new compressed chunk (see Table::append_uncommitted_chunk). Both
+//    become visible with the same commit, so that every transaction sees either the old or the new rows. If another
+//    transaction modifies one of the rows in the meantime, the compaction is rolled back and retried later.
+// 2. Release: Once no active transaction started before the rows of a chunk were invalidated, the chunk is replaced
+//    by an empty one (see Table::release_chunks) and its memory is freed.
+// The RowIDs of the other rows stay the same, so that the table indexes and the PosLists of running operators remain
+// valid. The mutable chunk is never compacted. Once all transactions that were active at the release have ended, no
+// RowIDs of a released chunk are in use anymore, and a later compaction places its chunk there instead of appending it.
+//
+// run_once reclaims the chunks of all MVCC tables in the StorageManager. start runs it periodically in a background
+// thread. Tables must not be added to or dropped from the StorageManager in the meantime.
+class ChunkCompactor : private Noncopyable {
+ public:
+  // chunks are compacted once invalid rows / rows >= invalid_row_ratio_threshold
+  explicit ChunkCompactor(float invalid_row_ratio_threshold = 0.5f);
+
+  // stops the background thread if it is running
+  ~ChunkCompactor();
+
+  // compacts the immutable chunks of the table whose ratio of invalid rows reaches the threshold and returns how many
+  // of them were compacted
+  size_t compact_table(const std::string& table_name);
+
+  // releases the chunks of the table whose rows are invisible to all transactions and returns how many there were
+  size_t release_chunks(const std::string& table_name);
+
+  // releases and compacts the chunks of all MVCC tables in the StorageManager
+  void run_once();
+
+  // starts a thread that calls run_once every interval until stop is called
+  void start(std::chrono::milliseconds interval);
+  void stop();
+  bool is_running() const;
+
+ protected:
+  // moves the valid rows of the chunk into a new chunk, returns false if the transaction had to be rolled back
+  bool _compact_chunk(const std::string& table_name, const std::shared_ptr<Table>& table, ChunkID chunk_id);
+
+  const float _invalid_row_ratio_threshold;
+
+  // serializes compactions, so that a chunk is not compacted twice at the same time
+  std::mutex _compaction_mutex;
+
+  // the chunks released by release_chunks per table, together with the last CommitID after their release
+  std::map<std::string, std::deque<std::pair<ChunkID, CommitID>>> _released_chunk_ids;
+
+  std::thread _thread;
+  bool _stop_requested = false;
+  std::mutex _thread_mutex;
+  std::condition_variable _stop_condition;
+};
+
+}  // namespace opossum
@@ -0,0 +1,74 @@
+#include "transaction_context.hpp"
+
+#include <exception>
+#include <memory>
+#include <utility>
+
+#include "operators/abstract_read_write_operator.hpp"
+#include "transaction_manager.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TransactionContext::TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id)
+    : _transaction_id(transaction_id), _snapshot_commit_id(snapshot_commit_id) {}
+
+TransactionContext::~TransactionContext() {
+  if (_phase != TransactionPhase::Active) return;
+
+  // Destructors must not throw, so that the operators are rolled back one by one and their errors are dropped. The
+  // rows of an operator that could not be rolled back stay invisible to other transactions, as they are not committed.
+  for (const auto& read_write_operator : _read_write_operators) {
+    try {
+      read_write_operator->rollback_records();
+    } catch (const std::exception&) {
+    }
+  }
+  _phase = TransactionPhase::RolledBack;
+
+  try {
+    TransactionManager::get()._end_transaction(_snapshot_commit_id);
+  } catch (const std::exception&) {
+  }
+}
+
+TransactionID TransactionContext::transaction_id() const { return _transaction_id; }
+
+CommitID TransactionContext::snapshot_commit_id() const { return _snapshot_commit_id; }
+
+CommitID TransactionContext::commit_id() const { return _commit_id; }
+
+TransactionPhase TransactionContext::phase() const { return _phase; }
+
+void TransactionContext::register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> read_write_operator) {
+  Assert(_phase == TransactionPhase::Active, "Operators can only be added to active transactions");
+  _read_write_operators.push_back(std::move(read_write_operator));
+}
+
+void TransactionContext::commit() {
+  Assert(_phase == TransactionPhase::Active, "Only active transactions can be committed");
+  for (const auto& read_write_operator : _read_write_operators) {
+    Assert(!read_write_operator->execute_failed(), "Transactions with failed operators have to be rolled back");
+  }
+
+  TransactionManager::get()._commit([&](const CommitID commit_id) {
+    _commit_id = commit_id;
+    for (const auto& read_write_operator : _read_write_operators) {
+      read_write_operator->commit_records(commit_id);
+    }
+  });
+  _phase = TransactionPhase::Committed;
+  TransactionManager::get()._end_transaction(_snapshot_commit_id);
+}
+
+void TransactionContext::rollback() {
+  Assert(_phase == TransactionPhase::Active, "Only active transactions can be rolled back");
+
+  for (const auto& read_write_operator : _read_write_operators) {
+    read_write_operator->rollback_records();
+  }
+  _phase = TransactionPhase::RolledBack;
+  TransactionManager::get()._end_transaction(_snapshot_commit_id);
+}
+
+}  // namespace opossum
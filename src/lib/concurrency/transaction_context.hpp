@@ -0,0 +1,60 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractReadWriteOperator;
+
+enum class TransactionPhase { Active, Committed, RolledBack };
+
+// A TransactionContext holds the state of a transaction that was started by the TransactionManager. Operators that are
+// executed as part of the transaction get it via AbstractOperator::set_transaction_context. Validate uses it to decide
+// which rows are visible, operators that modify tables (e.g., Insert) register with it, so that their changes are
+// committed or rolled back together.
+//
+// Example:
+//   auto context = TransactionManager::get().new_transaction_context();
+//   auto insert = std::make_shared<Insert>("table", values);
+//   insert->set_transaction_context(context);
+//   insert->execute();
+//   context->commit();
+class TransactionContext : private Noncopyable {
+ public:
+  TransactionContext(TransactionID transaction_id, CommitID snapshot_commit_id);
+
+  // rolls back the transaction if it is still active, ignoring operators whose rollback fails
+  ~TransactionContext();
+
+  TransactionID transaction_id() const;
+
+  // the transaction sees the rows of all commits up to and including this one
+  CommitID snapshot_commit_id() const;
+
+  // returns the CommitID that the transaction got when it committed, MAX_COMMIT_ID before
+  CommitID commit_id() const;
+
+  TransactionPhase phase() const;
+
+  // called by operators that modify tables during their execution
+  void register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> read_write_operator);
+
+  // Makes the changes of the registered operators visible to transactions that start afterwards. Transactions in
+  // which an operator failed (see AbstractReadWriteOperator::execute_failed) cannot commit.
+  void commit();
+
+  // undoes the changes of the registered operators
+  void rollback();
+
+ protected:
+  const TransactionID _transaction_id;
+  const CommitID _snapshot_commit_id;
+  CommitID _commit_id = MAX_COMMIT_ID;
+  TransactionPhase _phase = TransactionPhase::Active;
+  std::vector<std::shared_ptr<AbstractReadWriteOperator>> _read_write_operators;
+};
+
+}  // namespace opossum
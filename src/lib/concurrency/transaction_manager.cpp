@@ -0,0 +1,59 @@
+#include "transaction_manager.hpp"
+
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "transaction_context.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TransactionManager& TransactionManager::get() {
+  static TransactionManager instance;
+  return instance;
+}
+
+std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context() {
+  std::lock_guard<std::mutex> lock(_active_transactions_mutex);
+  const auto snapshot_commit_id = _last_commit_id.load();
+  _active_snapshot_commit_ids.insert(snapshot_commit_id);
+  return std::make_shared<TransactionContext>(_next_transaction_id++, snapshot_commit_id);
+}
+
+CommitID TransactionManager::last_commit_id() const { return _last_commit_id; }
+
+CommitID TransactionManager::lowest_active_snapshot_commit_id() const {
+  std::lock_guard<std::mutex> lock(_active_transactions_mutex);
+  if (_active_snapshot_commit_ids.empty()) return _last_commit_id;
+  return *_active_snapshot_commit_ids.begin();
+}
+
+void TransactionManager::reset() {
+  auto& transaction_manager = get();
+  std::lock_guard<std::mutex> lock(transaction_manager._commit_mutex);
+  std::lock_guard<std::mutex> active_transactions_lock(transaction_manager._active_transactions_mutex);
+
+  transaction_manager._next_transaction_id = INVALID_TRANSACTION_ID + 1;
+  transaction_manager._last_commit_id = 0;
+  transaction_manager._active_snapshot_commit_ids.clear();
+}
+
+void TransactionManager::_commit(const std::function<void(CommitID)>& commit_records) {
+  std::lock_guard<std::mutex> lock(_commit_mutex);
+
+  const auto commit_id = _last_commit_id + 1;
+  Assert(commit_id != MAX_COMMIT_ID, "Ran out of CommitIDs");
+
+  commit_records(commit_id);
+  _last_commit_id = commit_id;
+}
+
+void TransactionManager::_end_transaction(const CommitID snapshot_commit_id) {
+  std::lock_guard<std::mutex> lock(_active_transactions_mutex);
+  // transactions that started before reset() are not tracked anymore
+  const auto it = _active_snapshot_commit_ids.find(snapshot_commit_id);
+  if (it != _active_snapshot_commit_ids.end()) _active_snapshot_commit_ids.erase(it);
+}
+
+}  // namespace opossum
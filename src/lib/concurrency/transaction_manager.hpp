@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class TransactionContext;
+
+// The TransactionManager is a singleton that hands out TransactionIDs and CommitIDs.
+//
+// A transaction sees the rows of all transactions that committed before it started (its snapshot), and its own
+// changes. Commits are serialized: a committing transaction gets the next CommitID, its operators stamp their rows with
+// it, and only then the CommitID is published as last_commit_id. Transactions that start in the meantime therefore
+// either see all rows of a commit or none of them.
+class TransactionManager : private Noncopyable {
+ public:
+  static TransactionManager& get();
+
+  // starts a transaction whose snapshot contains all commits so far
+  std::shared_ptr<TransactionContext> new_transaction_context();
+
+  // returns the CommitID of the last commit, 0 if no transaction committed yet
+  CommitID last_commit_id() const;
+
+  // Returns the lowest snapshot CommitID of the transactions that are still active, or last_commit_id() if there are
+  // none. Rows that were deleted up to this commit are invisible to all current and future transactions (see
+  // ChunkCompactor).
+  CommitID lowest_active_snapshot_commit_id() const;
+
+  // resets the TransactionIDs and CommitIDs, used especially in tests
+  static void reset();
+
+  TransactionManager(TransactionManager&&) = delete;
+
+ protected:
+  friend class TransactionContext;
+
+  TransactionManager() = default;
+
+  // assigns the next CommitID, lets commit_records stamp the rows with it, and publishes it
+  void _commit(const std::function<void(CommitID)>& commit_records);
+
+  // called once a transaction with the given snapshot has committed or rolled back
+  void _end_transaction(CommitID snapshot_commit_id);
+
+  std::atomic<TransactionID> _next_transaction_id{INVALID_TRANSACTION_ID + 1};
+  std::atomic<CommitID> _last_commit_id{0};
+  std::mutex _commit_mutex;
+
+  // the snapshots of the active transactions. Taking a snapshot and adding it happen under the same lock, so that
+  // lowest_active_snapshot_commit_id never misses a transaction that is just starting.
+  std::multiset<CommitID> _active_snapshot_commit_ids;
+  mutable std::mutex _active_transactions_mutex;
+};
+
+}  // namespace opossum
@@ -1,20 +1,98 @@
 #include "abstract_operator.hpp"
 
+#include <boost/container/pmr/global_resource.hpp>
+
+#include <time.h>
+
 #include <chrono>
+#include <iomanip>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
+#include "storage/base_column.hpp"
+#include "storage/chunk.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+namespace {
+
+std::chrono::nanoseconds process_cpu_time() {
+  timespec time;
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time);
+  return std::chrono::seconds{time.tv_sec} + std::chrono::nanoseconds{time.tv_nsec};
+}
+
+std::string format_duration(const std::chrono::nanoseconds duration) {
+  std::ostringstream stream;
+  stream << std::fixed << std::setprecision(2) << std::chrono::duration<double, std::milli>(duration).count() << " ms";
+  return stream.str();
+}
+
+}  // namespace
+
+std::string OperatorPerformanceData::to_string() const {
+  std::ostringstream stream;
+  stream << format_duration(walltime) << " (CPU " << format_duration(cpu_time) << "), " << input_row_count
+         << " rows in " << input_chunk_count << " chunks -> " << output_row_count << " rows in " << output_chunk_count
+         << " chunks, " << allocated_bytes << " bytes";
+  return stream.str();
+}
+
 AbstractOperator::AbstractOperator(const std::shared_ptr<const AbstractOperator> left,
                                    const std::shared_ptr<const AbstractOperator> right)
-    : _input_left(left), _input_right(right) {}
+    : _input_left(left), _input_right(right), _memory_resource(boost::container::pmr::get_default_resource()) {}
 
-void AbstractOperator::execute() { _output = _on_execute(); }
+void AbstractOperator::execute() {
+  const auto walltime_begin = std::chrono::steady_clock::now();
+  const auto cpu_time_begin = process_cpu_time();
+
+  _output = _on_execute();
+
+  _performance_data = OperatorPerformanceData{};
+  _performance_data.walltime = std::chrono::steady_clock::now() - walltime_begin;
+  _performance_data.cpu_time = process_cpu_time() - cpu_time_begin;
+
+  // Columns that are forwarded from an input were not allocated by this operator. The chunks are inspected without
+  // pinning them, so that the bookkeeping neither loads spilled chunks nor touches chunks that, e.g., a Limit skipped.
+  // Spilled chunks hold no columns and cannot have been forwarded.
+  std::unordered_set<const BaseColumn*> input_columns;
+  for (const auto& input : {_input_left, _input_right}) {
+    if (!input || !input->get_output()) continue;
+
+    const auto& input_table = *input->get_output();
+    _performance_data.input_row_count += input_table.row_count();
+    _performance_data.input_chunk_count += input_table.chunk_count();
+    if (!_forwards_input_columns()) continue;
+
+    for (ChunkID chunk_id{0}; chunk_id < input_table.chunk_count(); ++chunk_id) {
+      const auto chunk = input_table.get_unpinned_chunk(chunk_id);
+      for (ColumnID column_id{0}; column_id < chunk->col_count(); ++column_id) {
+        if (const auto column = chunk->get_column_if_loaded(column_id)) input_columns.insert(column.get());
+      }
+    }
+  }
+
+  if (!_output) return;
+  _performance_data.output_row_count = _output->row_count();
+  _performance_data.output_chunk_count = _output->chunk_count();
+
+  // operators without inputs (e.g., GetTable) only hand out existing tables
+  if (!_input_left) return;
+  for (ChunkID chunk_id{0}; chunk_id < _output->chunk_count(); ++chunk_id) {
+    const auto chunk = _output->get_unpinned_chunk(chunk_id);
+    for (ColumnID column_id{0}; column_id < chunk->col_count(); ++column_id) {
+      const auto column = chunk->get_column_if_loaded(column_id);
+      if (column && !input_columns.count(column.get())) {
+        _performance_data.allocated_bytes += column->estimate_memory_usage();
+      }
+    }
+  }
+}
 
 std::shared_ptr<const Table> AbstractOperator::get_output() const {
   // TODO(anyone): You should place some meaningful checks here
@@ -22,8 +100,52 @@ std::shared_ptr<const Table> AbstractOperator::get_output() const {
   return _output;
 }
 
+std::shared_ptr<const AbstractOperator> AbstractOperator::input_left() const { return _input_left; }
+
+std::shared_ptr<const AbstractOperator> AbstractOperator::input_right() const { return _input_right; }
+
+const std::string AbstractOperator::description() const { return name(); }
+
+const OperatorPerformanceData& AbstractOperator::performance_data() const { return _performance_data; }
+
+void AbstractOperator::set_memory_resource(boost::container::pmr::memory_resource* memory_resource) {
+  DebugAssert(!_output, "The memory resource has to be set before the operator is executed");
+  _memory_resource = memory_resource;
+}
+
+boost::container::pmr::memory_resource* AbstractOperator::memory_resource() const { return _memory_resource; }
+
+void AbstractOperator::set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  DebugAssert(!_output, "The transaction context has to be set before the operator is executed");
+  _transaction_context = transaction_context;
+}
+
+std::shared_ptr<TransactionContext> AbstractOperator::transaction_context() const {
+  return _transaction_context.lock();
+}
+
 std::shared_ptr<const Table> AbstractOperator::_input_table_left() const { return _input_left->get_output(); }
 
 std::shared_ptr<const Table> AbstractOperator::_input_table_right() const { return _input_right->get_output(); }
 
+PolymorphicAllocator<size_t> AbstractOperator::_get_allocator() const {
+  return PolymorphicAllocator<size_t>(_memory_resource);
+}
+
+bool AbstractOperator::is_pipelineable() const { return false; }
+
+bool AbstractOperator::_forwards_input_columns() const { return false; }
+
+std::shared_ptr<Table> AbstractOperator::_create_output_table(const Table&) const {
+  Fail("Operator is not pipelineable");
+  return nullptr;
+}
+
+Chunk AbstractOperator::_on_execute_chunk(const std::shared_ptr<const Table>&, ChunkID, size_t) const {
+  Fail("Operator is not pipelineable");
+  return Chunk{};
+}
+
+bool AbstractOperator::_is_exhausted(size_t) const { return false; }
+
 }  // namespace opossum
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -8,7 +11,30 @@
 
 namespace opossum {
 
+class Chunk;
 class Table;
+class TransactionContext;
+
+// Measurements that AbstractOperator::execute takes for every operator. Operators that run as part of a Pipeline do
+// not execute on their own and thus do not record any.
+struct OperatorPerformanceData {
+  // time spent in _on_execute, not including the execution of the inputs
+  std::chrono::nanoseconds walltime{0};
+  // CPU time that the process spent in the meantime. It includes the ChunkScheduler's workers, but also other
+  // threads that happened to run at the same time.
+  std::chrono::nanoseconds cpu_time{0};
+
+  uint64_t input_row_count = 0;
+  uint64_t input_chunk_count = 0;
+  uint64_t output_row_count = 0;
+  uint64_t output_chunk_count = 0;
+
+  // estimated memory usage of the output columns that the operator created, i.e., that are not forwarded from an input
+  size_t allocated_bytes = 0;
+
+  // e.g., "1.24 ms (CPU 2.10 ms), 1000 rows in 4 chunks -> 20 rows in 4 chunks, 312 bytes"
+  std::string to_string() const;
+};
 
 // AbstractOperator is the abstract super class for all operators.
 // All operators have up to two input tables and one output table.
@@ -45,7 +71,35 @@ class AbstractOperator : private Noncopyable {
   std::shared_ptr<const AbstractOperator> input_left() const;
   std::shared_ptr<const AbstractOperator> input_right() const;
 
+  // name of the operator, e.g., "TableScan"
+  virtual const std::string name() const = 0;
+
+  // name of the operator with its most important parameters, e.g., "TableScan (#0 >= 5)"
+  virtual const std::string description() const;
+
+  // measurements of the last execution, see OperatorPerformanceData
+  const OperatorPerformanceData& performance_data() const;
+
+  // Sets the memory resource that the operator allocates its output from (must be called before execute).
+  // When all operators of a query share a monotonic buffer resource, their intermediate results can be freed at once
+  // by releasing the resource after the query. The resource has to outlive every table that the operators produce.
+  void set_memory_resource(boost::container::pmr::memory_resource* memory_resource);
+  boost::container::pmr::memory_resource* memory_resource() const;
+
+  // Sets the transaction that the operator is executed in (must be called before execute). Operators that read MVCC
+  // tables (Validate) or modify them (e.g., Insert) need one. The operator does not keep the transaction alive.
+  void set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context);
+
+  // returns the transaction context, or nullptr if there is none (anymore)
+  std::shared_ptr<TransactionContext> transaction_context() const;
+
+  // Returns whether the operator can process its input one chunk at a time. Chains of such operators can be executed
+  // as a Pipeline, which passes every chunk through all of them before it reads the next one.
+  virtual bool is_pipelineable() const;
+
  protected:
+  friend class Pipeline;
+
   // abstract method to actually execute the operator
   // execute and get_output are split into two methods to allow for easier
   // asynchronous execution
@@ -54,12 +108,39 @@ class AbstractOperator : private Noncopyable {
   std::shared_ptr<const Table> _input_table_left() const;
   std::shared_ptr<const Table> _input_table_right() const;
 
+  // allocator that operators should use for the PosLists and columns of their output
+  PolymorphicAllocator<size_t> _get_allocator() const;
+
+  // Returns whether the output may contain columns of the inputs (e.g., Projection). Only then, execute looks at the
+  // columns of the inputs to find out which output columns it must not count as allocated, which would otherwise make
+  // the bookkeeping of, e.g., a key lookup proportional to the number of input chunks.
+  virtual bool _forwards_input_columns() const;
+
+  // The following methods have to be implemented by pipelineable operators.
+
+  // creates an empty table with the columns of the operator's output for an input with the columns of input_table
+  virtual std::shared_ptr<Table> _create_output_table(const Table& input_table) const;
+
+  // Processes the chunk chunk_id of input_table and returns the corresponding (possibly empty) output chunk.
+  // emitted_row_count is the number of rows that the operator has produced for the previous chunks.
+  virtual Chunk _on_execute_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id,
+                                  size_t emitted_row_count) const;
+
+  // returns whether the operator will not produce any more rows, so that the rest of the input can be skipped
+  virtual bool _is_exhausted(size_t emitted_row_count) const;
+
   // Shared pointers to input operators, can be nullptr.
   std::shared_ptr<const AbstractOperator> _input_left;
   std::shared_ptr<const AbstractOperator> _input_right;
 
   // Is nullptr until the operator is executed
   std::shared_ptr<const Table> _output;
+
+  boost::container::pmr::memory_resource* _memory_resource;
+
+  std::weak_ptr<TransactionContext> _transaction_context;
+
+  OperatorPerformanceData _performance_data;
 };
 
 }  // namespace opossum
@@ -0,0 +1,21 @@
+#include "abstract_read_write_operator.hpp"
+
+#include <memory>
+
+#include "concurrency/transaction_context.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+bool AbstractReadWriteOperator::execute_failed() const { return _execute_failed; }
+
+std::shared_ptr<TransactionContext> AbstractReadWriteOperator::_register_with_transaction() {
+  const auto context = transaction_context();
+  Assert(context && context->phase() == TransactionPhase::Active,
+         name() + " has to be executed in an active transaction");
+
+  context->register_read_write_operator(shared_from_this());
+  return context;
+}
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_operator.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// AbstractReadWriteOperator is the super class of operators that modify MVCC tables (e.g., Insert). Their changes are
+// invisible to other transactions until the TransactionContext that they registered with commits. Such operators have
+// to be created with std::make_shared, because they register themselves during their execution.
+class AbstractReadWriteOperator : public AbstractOperator,
+                                  public std::enable_shared_from_this<AbstractReadWriteOperator> {
+ public:
+  using AbstractOperator::AbstractOperator;
+
+  // Makes the changes visible to the transactions whose snapshot includes commit_id. Called by
+  // TransactionContext::commit while no other transaction commits.
+  virtual void commit_records(CommitID commit_id) = 0;
+
+  // undoes the changes, so that no transaction sees them. Called by TransactionContext::rollback.
+  virtual void rollback_records() = 0;
+
+  // Returns whether the operator could not make its changes because another transaction modified the same rows
+  // (e.g., Delete). The transaction cannot commit anymore and has to be rolled back.
+  bool execute_failed() const;
+
+ protected:
+  // returns the active transaction context that the operator is executed in after registering with it
+  std::shared_ptr<TransactionContext> _register_with_transaction();
+
+  // Calls functor with the MVCC columns and the chunk offset of every row, looking up each chunk only once. As the
+  // MVCC columns stay in memory while a chunk is spilled, spilled chunks are not loaded, which matters for
+  // commit_records: it runs while the TransactionManager serializes all commits.
+  template <typename Functor>
+  static void _for_each_mvcc_row(const Table& table, const PosList& row_ids, const Functor& functor) {
+    std::shared_ptr<Chunk::MvccColumns> mvcc_columns;
+    for (size_t row_index = 0; row_index < row_ids.size(); ++row_index) {
+      const auto& row_id = row_ids[row_index];
+      if (row_index == 0 || row_id.chunk_id != row_ids[row_index - 1].chunk_id) {
+        mvcc_columns = table.get_unpinned_chunk(row_id.chunk_id)->mvcc_columns();
+      }
+      functor(*mvcc_columns, row_id.chunk_offset);
+    }
+  }
+
+  bool _execute_failed = false;
+};
+
+}  // namespace opossum
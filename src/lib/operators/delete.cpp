@@ -0,0 +1,101 @@
+#include "delete.hpp"
+
+#include <memory>
+#include <string>
+
+#include "concurrency/transaction_context.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Delete::Delete(const std::string& table_name, const std::shared_ptr<const AbstractOperator>& rows_to_delete)
+    : AbstractReadWriteOperator(rows_to_delete), _table_name(table_name) {}
+
+const std::string Delete::name() const { return "Delete"; }
+
+const std::string Delete::description() const { return "Delete (" + _table_name + ")"; }
+
+const std::string& Delete::table_name() const { return _table_name; }
+
+std::shared_ptr<const Table> Delete::_on_execute() {
+  const auto context = _register_with_transaction();
+
+  _table = StorageManager::get().get_table(_table_name);
+  Assert(_table->uses_mvcc(), "Delete: Table " + _table_name + " does not use MVCC");
+
+  const auto input_table = _input_table_left();
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count() && !_execute_failed; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    // an empty table's chunk might be missing actual columns
+    if (chunk->size() == 0) continue;
+
+    // all columns of a chunk reference the same rows, so that the first one tells which rows they are
+    const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(chunk->get_column(ColumnID{0}));
+    Assert(reference_column && reference_column->referenced_table() == _table,
+           "Delete: The input has to reference table " + _table_name);
+
+    const auto& pos_list = *reference_column->pos_list();
+    std::shared_ptr<Chunk::MvccColumns> mvcc_columns;
+    for (ChunkOffset chunk_offset = 0; chunk_offset < pos_list.size(); ++chunk_offset) {
+      const auto& row_id = pos_list[chunk_offset];
+      if (chunk_offset == 0 || row_id.chunk_id != pos_list[chunk_offset - 1].chunk_id) {
+        // the MVCC columns stay in memory while a chunk is spilled, so the chunk does not have to be loaded
+        mvcc_columns = _table->get_unpinned_chunk(row_id.chunk_id)->mvcc_columns();
+      }
+
+      if (!_lock_row(*mvcc_columns, row_id.chunk_offset, context->transaction_id(), context->snapshot_commit_id())) {
+        _execute_failed = true;
+        break;
+      }
+      _deleted_row_ids.push_back(row_id);
+    }
+  }
+
+  return nullptr;
+}
+
+bool Delete::_lock_row(Chunk::MvccColumns& mvcc_columns, const ChunkOffset chunk_offset, const TransactionID our_tid,
+                       const CommitID snapshot_commit_id) {
+  // Rows that the transaction inserted itself are already locked by it and invisible to others. An end CommitID other
+  // than MAX_COMMIT_ID hides them from the transaction as well (see Validate::is_row_visible).
+  if (mvcc_columns.tids[chunk_offset] == our_tid && mvcc_columns.begin_cids[chunk_offset] == MAX_COMMIT_ID) {
+    auto expected_end_cid = MAX_COMMIT_ID;
+    return mvcc_columns.end_cids[chunk_offset].compare_exchange_strong(expected_end_cid, 0);
+  }
+
+  auto expected_tid = INVALID_TRANSACTION_ID;
+  if (!mvcc_columns.tids[chunk_offset].compare_exchange_strong(expected_tid, our_tid)) return false;
+
+  // The row might have been deleted by a transaction that committed after our snapshot was taken, or might not have
+  // been visible in the first place.
+  if (mvcc_columns.end_cids[chunk_offset] != MAX_COMMIT_ID ||
+      mvcc_columns.begin_cids[chunk_offset] > snapshot_commit_id) {
+    mvcc_columns.tids[chunk_offset] = INVALID_TRANSACTION_ID;
+    return false;
+  }
+
+  return true;
+}
+
+void Delete::commit_records(const CommitID commit_id) {
+  _for_each_mvcc_row(*_table, _deleted_row_ids, [&](Chunk::MvccColumns& mvcc_columns, const ChunkOffset offset) {
+    mvcc_columns.end_cids[offset] = commit_id;
+    mvcc_columns.tids[offset] = INVALID_TRANSACTION_ID;
+    ++mvcc_columns.invalid_row_count;
+    // commits are serialized, so that commit_id is the highest end CommitID so far
+    mvcc_columns.max_end_cid = commit_id;
+  });
+}
+
+void Delete::rollback_records() {
+  // Rows that the transaction inserted itself are released (and invalidated) by the Insert's rollback as well
+  _for_each_mvcc_row(*_table, _deleted_row_ids, [&](Chunk::MvccColumns& mvcc_columns, const ChunkOffset offset) {
+    mvcc_columns.end_cids[offset] = MAX_COMMIT_ID;
+    mvcc_columns.tids[offset] = INVALID_TRANSACTION_ID;
+  });
+}
+
+}  // namespace opossum
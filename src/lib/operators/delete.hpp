@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_read_write_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Operator that deletes the rows of the MVCC table with the given name that its input references, e.g., the output of
+// a TableScan and a Validate on the table. The rows are invalidated in place: Delete locks them by setting their
+// TransactionID, and the commit sets their end CommitIDs, which hides them from transactions that start afterwards.
+// If another transaction is modifying one of the rows or has deleted it in the meantime, the operator fails (see
+// execute_failed). Delete has no output.
+class Delete : public AbstractReadWriteOperator {
+ public:
+  Delete(const std::string& table_name, const std::shared_ptr<const AbstractOperator>& rows_to_delete);
+
+  const std::string name() const override;
+  const std::string description() const override;
+
+  const std::string& table_name() const;
+
+  void commit_records(CommitID commit_id) override;
+  void rollback_records() override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // locks the row for deletion and returns whether that was possible
+  static bool _lock_row(Chunk::MvccColumns& mvcc_columns, ChunkOffset chunk_offset, TransactionID our_tid,
+                        CommitID snapshot_commit_id);
+
+  const std::string _table_name;
+  std::shared_ptr<Table> _table;
+  // the rows that the operator has locked
+  PosList _deleted_row_ids;
+};
+
+}  // namespace opossum
@@ -13,9 +13,15 @@ class GetTable : public AbstractOperator {
  public:
   explicit GetTable(const std::string& name);
 
+  const std::string name() const override;
+  const std::string description() const override;
+
   const std::string& table_name() const;
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
+
+  // name of the table to retrieve
+  const std::string _name;
 };
 }  // namespace opossum
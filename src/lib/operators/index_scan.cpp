@@ -0,0 +1,153 @@
+#include "index_scan.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "pipeline.hpp"
+#include "storage/table.hpp"
+#include "table_scan.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/create_reference_table.hpp"
+
+namespace opossum {
+
+IndexScan::IndexScan(const std::shared_ptr<const AbstractOperator> in, const ColumnIndexType index_type,
+                     const std::vector<ColumnID>& column_ids, const ScanType scan_type,
+                     const std::vector<AllTypeVariant>& search_values)
+    : AbstractOperator(in),
+      _index_type(index_type),
+      _column_ids(column_ids),
+      _scan_type(scan_type),
+      _search_values(search_values) {
+  Assert(!_column_ids.empty(), "IndexScan needs at least one column");
+  Assert(_column_ids.size() == _search_values.size(), "IndexScan needs one search value per column");
+}
+
+const std::string IndexScan::name() const { return "IndexScan"; }
+
+const std::string IndexScan::description() const {
+  auto description = std::string{"IndexScan ("};
+  for (size_t column_index = 0; column_index < _column_ids.size(); ++column_index) {
+    const auto is_last_column = column_index + 1 == _column_ids.size();
+    const auto is_null_scan = is_last_column && is_null_scan_type(_scan_type);
+    description += "#" + std::to_string(_column_ids[column_index]) + " " +
+                   (is_last_column ? to_string(_scan_type) : std::string{"="}) +
+                   (is_null_scan ? "" : " " + type_cast<std::string>(_search_values[column_index])) +
+                   (is_last_column ? ")" : " AND ");
+  }
+  return description;
+}
+
+ColumnIndexType IndexScan::index_type() const { return _index_type; }
+
+const std::vector<ColumnID>& IndexScan::column_ids() const { return _column_ids; }
+
+ScanType IndexScan::scan_type() const { return _scan_type; }
+
+const std::vector<AllTypeVariant>& IndexScan::search_values() const { return _search_values; }
+
+bool IndexScan::is_pipelineable() const { return true; }
+
+std::shared_ptr<const Table> IndexScan::_on_execute() { return Pipeline(_input_table_left(), {this}).execute(); }
+
+std::shared_ptr<Table> IndexScan::_create_output_table(const Table& input_table) const {
+  for (const auto& column_id : _column_ids) {
+    Assert(column_id < input_table.col_count(), "IndexScan: Column " + std::to_string(column_id) + " does not exist");
+  }
+
+  auto output_table = std::make_shared<Table>(input_table.chunk_size(), _get_allocator());
+  for (ColumnID column_id{0}; column_id < input_table.col_count(); ++column_id) {
+    output_table->add_column_definition(input_table.column_name(column_id), input_table.column_type(column_id),
+                                        input_table.column_is_nullable(column_id));
+  }
+  return output_table;
+}
+
+Chunk IndexScan::_on_execute_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                                   size_t) const {
+  // the indexes do not hold NULL values, so that predicates on NULL are evaluated on the columns. So are LIKE
+  // predicates, which do not select a range of the index unless the pattern is a prefix.
+  const auto scans_columns = is_null_scan_type(_scan_type) || is_like_scan_type(_scan_type) ||
+                             std::any_of(_search_values.cbegin(), _search_values.cend(), variant_is_null);
+  const auto index = scans_columns ? nullptr : input_table->get_chunk(chunk_id)->get_index(_index_type, _column_ids);
+  const auto matches = index ? _scan_index(*index) : _scan_columns(input_table, chunk_id);
+  return create_reference_chunk(input_table, chunk_id, matches, _get_allocator());
+}
+
+std::vector<ChunkOffset> IndexScan::_scan_index(const BaseIndex& index) const {
+  // All matching rows share the prefix of the search values that is compared for equality. Within the range of the
+  // index that holds this prefix, the rows are ordered by the last column, so that the predicate on the last column
+  // selects a subrange - or two subranges for OpNotEquals.
+  const auto prefix = std::vector<AllTypeVariant>(_search_values.cbegin(), _search_values.cend() - 1);
+  const auto prefix_begin = index.lower_bound(prefix);
+  const auto prefix_end = index.upper_bound(prefix);
+  const auto value_begin = index.lower_bound(_search_values);
+  const auto value_end = index.upper_bound(_search_values);
+
+  auto ranges = std::vector<std::pair<BaseIndex::Iterator, BaseIndex::Iterator>>{};
+  switch (_scan_type) {
+    case ScanType::OpEquals:
+      ranges.emplace_back(value_begin, value_end);
+      break;
+    case ScanType::OpNotEquals:
+      ranges.emplace_back(prefix_begin, value_begin);
+      ranges.emplace_back(value_end, prefix_end);
+      break;
+    case ScanType::OpLessThan:
+      ranges.emplace_back(prefix_begin, value_begin);
+      break;
+    case ScanType::OpLessThanEquals:
+      ranges.emplace_back(prefix_begin, value_end);
+      break;
+    case ScanType::OpGreaterThan:
+      ranges.emplace_back(value_end, prefix_end);
+      break;
+    case ScanType::OpGreaterThanEquals:
+      ranges.emplace_back(value_begin, prefix_end);
+      break;
+    default:
+      Fail("Unsupported scan type");
+  }
+
+  auto matches = std::vector<ChunkOffset>{};
+  for (const auto& range : ranges) {
+    matches.insert(matches.end(), range.first, range.second);
+  }
+
+  // the index orders the rows by value, the output keeps the order of the chunk
+  std::sort(matches.begin(), matches.end());
+  return matches;
+}
+
+std::vector<ChunkOffset> IndexScan::_scan_columns(const std::shared_ptr<const Table>& table,
+                                                  const ChunkID chunk_id) const {
+  _reader_caches.resize(_column_ids.size());
+
+  auto matches = std::vector<ChunkOffset>{};
+  for (size_t column_index = 0; column_index < _column_ids.size(); ++column_index) {
+    const auto is_last_column = column_index + 1 == _column_ids.size();
+    const auto scan_type = is_last_column ? _scan_type : ScanType::OpEquals;
+    auto column_matches =
+        TableScan::scan_chunk(table, chunk_id, _column_ids[column_index], scan_type, _search_values[column_index],
+                              _reader_caches[column_index]);
+
+    if (column_index == 0) {
+      matches = std::move(column_matches);
+    } else {
+      auto intersection = std::vector<ChunkOffset>{};
+      std::set_intersection(matches.cbegin(), matches.cend(), column_matches.cbegin(), column_matches.cend(),
+                            std::back_inserter(intersection));
+      matches = std::move(intersection);
+    }
+
+    if (matches.empty()) break;
+  }
+  return matches;
+}
+
+}  // namespace opossum
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "storage/column_value_reader.hpp"
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that selects rows using the chunks' indexes of type index_type over column_ids (see Chunk::create_index).
+ * A row matches if its values in all but the last of the columns equal the corresponding search values and its value
+ * in the last column compares to the last search value as specified by scan_type, e.g.,
+ *
+ *   IndexScan(in, ColumnIndexType::CompositeGroupKey, {a, b}, ScanType::OpLessThan, {1, 5})
+ *
+ * selects the rows with a = 1 AND b < 5. For indexed chunks, the matching rows form one or two ranges of the index,
+ * which are located with lower_bound and upper_bound instead of looking at every row. Chunks without such an index
+ * (e.g., uncompressed chunks or chunks of ReferenceColumns) are scanned like in the TableScan. As the indexes do not
+ * hold NULL values, so are all chunks if the predicate involves NULL or is a LIKE predicate.
+ *
+ * The output consists of ReferenceColumns whose rows keep the order of the input.
+ */
+class IndexScan : public AbstractOperator {
+ public:
+  IndexScan(const std::shared_ptr<const AbstractOperator> in, ColumnIndexType index_type,
+            const std::vector<ColumnID>& column_ids, const ScanType scan_type,
+            const std::vector<AllTypeVariant>& search_values);
+
+  const std::string name() const override;
+  const std::string description() const override;
+
+  ColumnIndexType index_type() const;
+  const std::vector<ColumnID>& column_ids() const;
+  ScanType scan_type() const;
+  const std::vector<AllTypeVariant>& search_values() const;
+
+  bool is_pipelineable() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<Table> _create_output_table(const Table& input_table) const override;
+  Chunk _on_execute_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id,
+                          size_t emitted_row_count) const override;
+
+  // returns the sorted offsets of the matching rows using the index
+  std::vector<ChunkOffset> _scan_index(const BaseIndex& index) const;
+
+  // returns the sorted offsets of the matching rows by scanning every column
+  std::vector<ChunkOffset> _scan_columns(const std::shared_ptr<const Table>& table, ChunkID chunk_id) const;
+
+  const ColumnIndexType _index_type;
+  const std::vector<ColumnID> _column_ids;
+  const ScanType _scan_type;
+  const std::vector<AllTypeVariant> _search_values;
+
+  // one per column, kept across the chunks of an execution (see TableScan)
+  mutable std::vector<ColumnValueReaderCache> _reader_caches;
+};
+
+}  // namespace opossum
@@ -0,0 +1,74 @@
+#include "insert.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "resolve_type.hpp"
+#include "storage/column_value_reader.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Insert::Insert(const std::string& target_table_name, const std::shared_ptr<const AbstractOperator>& values_to_insert)
+    : AbstractReadWriteOperator(values_to_insert), _target_table_name(target_table_name) {}
+
+const std::string Insert::name() const { return "Insert"; }
+
+const std::string Insert::description() const { return "Insert (" + _target_table_name + ")"; }
+
+const std::string& Insert::target_table_name() const { return _target_table_name; }
+
+std::shared_ptr<const Table> Insert::_on_execute() {
+  const auto context = _register_with_transaction();
+
+  _target_table = StorageManager::get().get_table(_target_table_name);
+  const auto input_table = _input_table_left();
+  Assert(input_table->col_count() == _target_table->col_count(),
+         "Insert: Column count does not match the target table");
+  for (ColumnID column_id{0}; column_id < input_table->col_count(); ++column_id) {
+    Assert(input_table->column_type(column_id) == _target_table->column_type(column_id),
+           "Insert: Type of column " + std::to_string(column_id) + " does not match the target table");
+  }
+
+  std::vector<std::vector<AllTypeVariant>> rows(input_table->row_count(),
+                                                std::vector<AllTypeVariant>(input_table->col_count()));
+  for (ColumnID column_id{0}; column_id < input_table->col_count(); ++column_id) {
+    resolve_data_type(input_table->column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      ColumnValueReader<ColumnDataType> reader(*input_table, column_id);
+
+      auto row_index = size_t{0};
+      for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+        const auto chunk_size = input_table->get_chunk(chunk_id)->size();
+        for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+          const auto row_id = RowID{chunk_id, chunk_offset};
+          rows[row_index++][column_id] = reader.is_null(row_id) ? NULL_VALUE : AllTypeVariant{reader.get(row_id)};
+        }
+      }
+    });
+  }
+
+  _inserted_row_ids = _target_table->append_uncommitted(rows, context->transaction_id());
+  return nullptr;
+}
+
+void Insert::commit_records(const CommitID commit_id) {
+  _for_each_mvcc_row(*_target_table, _inserted_row_ids, [&](auto& mvcc_columns, const ChunkOffset offset) {
+    mvcc_columns.begin_cids[offset] = commit_id;
+    mvcc_columns.tids[offset] = INVALID_TRANSACTION_ID;
+  });
+}
+
+void Insert::rollback_records() {
+  // the rows keep MAX_COMMIT_ID as begin CommitID and thus stay invisible
+  _for_each_mvcc_row(*_target_table, _inserted_row_ids, [&](auto& mvcc_columns, const ChunkOffset offset) {
+    mvcc_columns.tids[offset] = INVALID_TRANSACTION_ID;
+    ++mvcc_columns.invalid_row_count;
+  });
+}
+
+}  // namespace opossum
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_read_write_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Operator that appends the rows of its input to the MVCC table with the given name (see Table::append_uncommitted).
+// The rows are visible to the operator's transaction right away and to other transactions once it has committed. The
+// input needs the same column types as the table. Insert has no output.
+class Insert : public AbstractReadWriteOperator {
+ public:
+  Insert(const std::string& target_table_name, const std::shared_ptr<const AbstractOperator>& values_to_insert);
+
+  const std::string name() const override;
+  const std::string description() const override;
+
+  const std::string& target_table_name() const;
+
+  void commit_records(CommitID commit_id) override;
+  void rollback_records() override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::string _target_table_name;
+  std::shared_ptr<Table> _target_table;
+  PosList _inserted_row_ids;
+};
+
+}  // namespace opossum
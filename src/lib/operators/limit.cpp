@@ -0,0 +1,50 @@
+#include "limit.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "pipeline.hpp"
+#include "storage/table.hpp"
+#include "utils/create_reference_table.hpp"
+
+namespace opossum {
+
+Limit::Limit(const std::shared_ptr<const AbstractOperator> in, const size_t num_rows)
+    : AbstractOperator(in), _num_rows(num_rows) {}
+
+const std::string Limit::name() const { return "Limit"; }
+
+const std::string Limit::description() const { return "Limit (" + std::to_string(_num_rows) + ")"; }
+
+size_t Limit::num_rows() const { return _num_rows; }
+
+bool Limit::is_pipelineable() const { return true; }
+
+std::shared_ptr<const Table> Limit::_on_execute() { return Pipeline(_input_table_left(), {this}).execute(); }
+
+std::shared_ptr<Table> Limit::_create_output_table(const Table& input_table) const {
+  auto output_table = std::make_shared<Table>(input_table.chunk_size(), _get_allocator());
+  for (ColumnID column_id{0}; column_id < input_table.col_count(); ++column_id) {
+    output_table->add_column_definition(input_table.column_name(column_id), input_table.column_type(column_id),
+                                        input_table.column_is_nullable(column_id));
+  }
+  return output_table;
+}
+
+Chunk Limit::_on_execute_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                               const size_t emitted_row_count) const {
+  const auto chunk_size = input_table->get_unpinned_chunk(chunk_id)->size();
+  const auto row_count = std::min(static_cast<size_t>(chunk_size), _num_rows - emitted_row_count);
+
+  std::vector<ChunkOffset> chunk_offsets(row_count);
+  for (ChunkOffset chunk_offset = 0; chunk_offset < row_count; ++chunk_offset) {
+    chunk_offsets[chunk_offset] = chunk_offset;
+  }
+  return create_reference_chunk(input_table, chunk_id, chunk_offsets, _get_allocator());
+}
+
+bool Limit::_is_exhausted(const size_t emitted_row_count) const { return emitted_row_count >= _num_rows; }
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that forwards the first num_rows rows of its input as ReferenceColumns.
+ * Chunks after the one that completes the limit are never accessed, also when the Limit is part of a Pipeline.
+ */
+class Limit : public AbstractOperator {
+ public:
+  Limit(const std::shared_ptr<const AbstractOperator> in, const size_t num_rows);
+
+  const std::string name() const override;
+  const std::string description() const override;
+
+  size_t num_rows() const;
+
+  bool is_pipelineable() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<Table> _create_output_table(const Table& input_table) const override;
+  Chunk _on_execute_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id,
+                          size_t emitted_row_count) const override;
+  bool _is_exhausted(size_t emitted_row_count) const override;
+
+  const size_t _num_rows;
+};
+
+}  // namespace opossum
@@ -0,0 +1,195 @@
+#include "materialize.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/chunk_scheduler.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// returns whether all positions point into the same chunk
+bool references_single_chunk(const PosList& pos_list) {
+  for (const auto& row_id : pos_list) {
+    if (row_id.chunk_id != pos_list.front().chunk_id) return false;
+  }
+  return true;
+}
+
+template <typename uintX_t>
+std::shared_ptr<BaseAttributeVector> gather_attribute_vector(const BaseAttributeVector& attribute_vector,
+                                                             const PosList& pos_list,
+                                                             const PolymorphicAllocator<size_t>& alloc) {
+  const auto fitted_attribute_vector = dynamic_cast<const FittedAttributeVector<uintX_t>*>(&attribute_vector);
+  Assert(fitted_attribute_vector, "Only FittedAttributeVectors can be materialized");
+
+  const auto& value_ids = fitted_attribute_vector->values();
+  pmr_vector<uintX_t> gathered_value_ids(pos_list.size(), alloc);
+  for (size_t i = 0; i < pos_list.size(); ++i) {
+    if (i + Materialize::PREFETCH_DISTANCE < pos_list.size()) {
+      __builtin_prefetch(&value_ids[pos_list[i + Materialize::PREFETCH_DISTANCE].chunk_offset]);
+    }
+    gathered_value_ids[i] = value_ids[pos_list[i].chunk_offset];
+  }
+  return std::make_shared<FittedAttributeVector<uintX_t>>(std::move(gathered_value_ids));
+}
+
+template <typename T>
+std::shared_ptr<BaseColumn> materialize_dictionary_column(const DictionaryColumn<T>& column, const PosList& pos_list,
+                                                          const PolymorphicAllocator<size_t>& alloc) {
+  const auto& attribute_vector = *column.attribute_vector();
+
+  std::shared_ptr<BaseAttributeVector> gathered_attribute_vector;
+  switch (attribute_vector.width()) {
+    case 1:
+      gathered_attribute_vector = gather_attribute_vector<uint8_t>(attribute_vector, pos_list, alloc);
+      break;
+    case 2:
+      gathered_attribute_vector = gather_attribute_vector<uint16_t>(attribute_vector, pos_list, alloc);
+      break;
+    case 4:
+      gathered_attribute_vector = gather_attribute_vector<uint32_t>(attribute_vector, pos_list, alloc);
+      break;
+    default:
+      Fail("Unsupported attribute vector width");
+  }
+
+  return std::make_shared<DictionaryColumn<T>>(column.dictionary(), std::move(gathered_attribute_vector));
+}
+
+template <typename T>
+std::shared_ptr<BaseColumn> materialize_value_column(const ReferenceColumn& column, const bool nullable,
+                                                     const PolymorphicAllocator<size_t>& alloc) {
+  const auto& pos_list = *column.pos_list();
+  const auto& referenced_table = *column.referenced_table();
+
+  // Referenced chunks are looked up once, because Table::get_chunk has to consult the BufferManager. The handles pin
+  // the chunks until the gather is done, so that the BufferManager does not spill them while other workers load
+  // chunks, and keep the columns alive.
+  std::vector<std::shared_ptr<const Chunk>> referenced_chunks(referenced_table.chunk_count());
+  std::vector<const ValueColumn<T>*> value_columns(referenced_table.chunk_count(), nullptr);
+  std::vector<const DictionaryColumn<T>*> dictionary_columns(referenced_table.chunk_count(), nullptr);
+
+  const auto resolve_chunk = [&](const ChunkID chunk_id) {
+    if (referenced_chunks[chunk_id]) return;
+
+    referenced_chunks[chunk_id] = referenced_table.get_chunk(chunk_id);
+    const auto referenced_column = referenced_chunks[chunk_id]->get_column(column.referenced_column_id());
+    value_columns[chunk_id] = dynamic_cast<const ValueColumn<T>*>(referenced_column.get());
+    dictionary_columns[chunk_id] = dynamic_cast<const DictionaryColumn<T>*>(referenced_column.get());
+    DebugAssert(value_columns[chunk_id] || dictionary_columns[chunk_id],
+                "ReferenceColumns must reference ValueColumns or DictionaryColumns of the same type");
+  };
+
+  pmr_vector<T> values(alloc);
+  pmr_vector<bool> null_values(alloc);
+  values.reserve(pos_list.size());
+  if (nullable) null_values.reserve(pos_list.size());
+  for (size_t i = 0; i < pos_list.size(); ++i) {
+    if (i + Materialize::PREFETCH_DISTANCE < pos_list.size()) {
+      const auto& prefetched_row_id = pos_list[i + Materialize::PREFETCH_DISTANCE];
+      const auto prefetched_column = value_columns[prefetched_row_id.chunk_id];
+      if (prefetched_column) __builtin_prefetch(&prefetched_column->values()[prefetched_row_id.chunk_offset]);
+    }
+
+    const auto& row_id = pos_list[i];
+    resolve_chunk(row_id.chunk_id);
+
+    if (const auto value_column = value_columns[row_id.chunk_id]) {
+      values.push_back(value_column->values()[row_id.chunk_offset]);
+      if (nullable) null_values.push_back(value_column->is_null(row_id.chunk_offset));
+    } else {
+      const auto dictionary_column = dictionary_columns[row_id.chunk_id];
+      const auto is_null = dictionary_column->is_null(row_id.chunk_offset);
+      values.push_back(is_null ? T{} : dictionary_column->get(row_id.chunk_offset));
+      if (nullable) null_values.push_back(is_null);
+    }
+  }
+
+  if (nullable) return std::make_shared<ValueColumn<T>>(std::move(values), null_values);
+  return std::make_shared<ValueColumn<T>>(std::move(values));
+}
+
+std::shared_ptr<BaseColumn> materialize_column(const std::string& type, const bool nullable,
+                                               const std::shared_ptr<BaseColumn>& column,
+                                               const PolymorphicAllocator<size_t>& alloc) {
+  const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column);
+  if (!reference_column) return column;
+
+  std::shared_ptr<BaseColumn> materialized_column;
+  resolve_data_type(type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto& pos_list = *reference_column->pos_list();
+    if (!pos_list.empty() && references_single_chunk(pos_list)) {
+      // the handle pins the referenced chunk for the duration of the gather
+      const auto referenced_chunk = reference_column->referenced_table()->get_chunk(pos_list.front().chunk_id);
+      const auto referenced_column = referenced_chunk->get_column(reference_column->referenced_column_id());
+      const auto dictionary_column =
+          std::dynamic_pointer_cast<const DictionaryColumn<ColumnDataType>>(referenced_column);
+      if (dictionary_column) {
+        materialized_column = materialize_dictionary_column(*dictionary_column, pos_list, alloc);
+        return;
+      }
+    }
+
+    materialized_column = materialize_value_column<ColumnDataType>(*reference_column, nullable, alloc);
+  });
+
+  Assert(static_cast<bool>(materialized_column), "Unknown column type " + type);
+  return materialized_column;
+}
+
+}  // namespace
+
+Materialize::Materialize(const std::shared_ptr<const AbstractOperator> in) : AbstractOperator(in) {}
+
+const std::string Materialize::name() const { return "Materialize"; }
+
+std::shared_ptr<const Table> Materialize::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto alloc = _get_allocator();
+
+  auto output_table = std::make_shared<Table>(input_table->chunk_size(), alloc);
+  for (ColumnID column_id{0}; column_id < input_table->col_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id),
+                                        input_table->column_is_nullable(column_id));
+  }
+
+  std::vector<Chunk> output_chunks;
+  output_chunks.reserve(input_table->chunk_count());
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    output_chunks.emplace_back(input_table->chunk_numa_node(chunk_id), alloc);
+  }
+
+  ChunkScheduler::schedule_per_chunk_and_wait(*input_table, [&](const ChunkID chunk_id) {
+    const auto input_chunk = input_table->get_chunk(chunk_id);
+
+    // an empty table's chunk might be missing actual columns
+    if (input_chunk->size() == 0) return;
+
+    for (ColumnID column_id{0}; column_id < input_chunk->col_count(); ++column_id) {
+      output_chunks[chunk_id].add_column(materialize_column(input_table->column_type(column_id),
+                                                            input_table->column_is_nullable(column_id),
+                                                            input_chunk->get_column(column_id), alloc));
+    }
+  });
+
+  for (auto& output_chunk : output_chunks) {
+    if (output_chunk.size() > 0) output_table->emplace_chunk(std::move(output_chunk));
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
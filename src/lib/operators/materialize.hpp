@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that replaces the ReferenceColumns of its input by columns that hold the referenced values.
+ *
+ * Every access to a ReferenceColumn has to go through the referenced table, which is expensive if the result is
+ * scanned repeatedly. Materialize gathers the values once so that later passes can stream over them sequentially.
+ * If all positions of a ReferenceColumn point into the same DictionaryColumn, the output is a DictionaryColumn that
+ * shares the dictionary of the referenced column and only gathers the ValueIDs. Otherwise, the output is a
+ * ValueColumn. Columns that are not ReferenceColumns are forwarded.
+ *
+ * Chunks are gathered in parallel (see ChunkScheduler).
+ */
+class Materialize : public AbstractOperator {
+ public:
+  explicit Materialize(const std::shared_ptr<const AbstractOperator> in);
+
+  const std::string name() const override;
+
+  // number of positions that the referenced values are prefetched ahead of the gather
+  static constexpr size_t PREFETCH_DISTANCE = 16;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
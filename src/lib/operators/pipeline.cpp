@@ -0,0 +1,121 @@
+#include "pipeline.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::vector<const AbstractOperator*> collect_pipelineable_operators(
+    const std::shared_ptr<const AbstractOperator>& root) {
+  std::vector<const AbstractOperator*> operators;
+  for (auto op = root; op && op->is_pipelineable(); op = op->input_left()) {
+    operators.push_back(op.get());
+  }
+  std::reverse(operators.begin(), operators.end());
+  return operators;
+}
+
+std::shared_ptr<const Table> find_pipeline_input(const std::shared_ptr<const AbstractOperator>& root) {
+  auto op = root;
+  while (op->is_pipelineable()) {
+    op = op->input_left();
+    Assert(static_cast<bool>(op), "Pipelineable operators need an input");
+  }
+  Assert(static_cast<bool>(op->get_output()), "The input of a pipeline has to be executed first");
+  return op->get_output();
+}
+
+}  // namespace
+
+Pipeline::Pipeline(const std::shared_ptr<const AbstractOperator>& root)
+    : Pipeline(find_pipeline_input(root), collect_pipelineable_operators(root)) {}
+
+Pipeline::Pipeline(const std::shared_ptr<const Table>& input_table,
+                   const std::vector<const AbstractOperator*>& operators)
+    : _input_table(input_table), _operators(operators), _emitted_row_counts(operators.size(), 0) {
+  Assert(!_operators.empty(), "A pipeline needs at least one operator");
+
+  _input_definitions.push_back(_input_table);
+  for (size_t operator_id = 0; operator_id + 1 < _operators.size(); ++operator_id) {
+    _intermediate_tables.push_back(_operators[operator_id]->_create_output_table(*_input_definitions.back()));
+    _input_definitions.push_back(_intermediate_tables.back());
+  }
+}
+
+std::optional<Chunk> Pipeline::next_chunk() {
+  while (_next_input_chunk_id < _input_table->chunk_count()) {
+    for (size_t operator_id = 0; operator_id < _operators.size(); ++operator_id) {
+      if (_operators[operator_id]->_is_exhausted(_emitted_row_counts[operator_id])) {
+        _next_input_chunk_id = _input_table->chunk_count();
+        return std::nullopt;
+      }
+    }
+
+    const auto input_chunk_id = _next_input_chunk_id;
+    ++_next_input_chunk_id;
+
+    // an empty table's chunk might be missing actual columns. The size is known without loading a spilled chunk.
+    if (_input_table->get_unpinned_chunk(input_chunk_id)->size() == 0) continue;
+
+    // Empty chunks are passed on as well, so that the last operator can produce an empty chunk with all its columns.
+    auto chunk_table = _input_table;
+    auto chunk_id = input_chunk_id;
+    std::optional<Chunk> chunk;
+
+    for (size_t operator_id = 0; operator_id < _operators.size(); ++operator_id) {
+      const auto op = _operators[operator_id];
+      chunk = op->_on_execute_chunk(chunk_table, chunk_id, _emitted_row_counts[operator_id]);
+      _emitted_row_counts[operator_id] += chunk->size();
+
+      if (operator_id > 0) _release_intermediate_chunk(operator_id - 1, chunk_id);
+
+      if (operator_id + 1 < _operators.size()) {
+        const auto& intermediate_table = _intermediate_tables[operator_id];
+        intermediate_table->emplace_chunk(std::move(*chunk));
+        chunk_table = intermediate_table;
+        chunk_id = ChunkID{static_cast<ChunkID::base_type>(intermediate_table->chunk_count() - 1)};
+      }
+    }
+
+    if (chunk->size() > 0) return chunk;
+    if (!_empty_output_chunk) _empty_output_chunk = std::move(chunk);
+  }
+
+  return std::nullopt;
+}
+
+void Pipeline::_release_intermediate_chunk(const size_t operator_id, const ChunkID chunk_id) {
+  const auto& intermediate_table = _intermediate_tables[operator_id];
+  const auto chunk = intermediate_table->get_chunk(chunk_id);
+  for (ColumnID column_id{0}; column_id < chunk->col_count(); ++column_id) {
+    if (!std::dynamic_pointer_cast<const ReferenceColumn>(chunk->get_column(column_id))) return;
+  }
+  intermediate_table->release_chunks({chunk_id});
+}
+
+std::shared_ptr<Table> Pipeline::execute() {
+  auto output_table = _operators.back()->_create_output_table(*_input_definitions.back());
+
+  while (auto chunk = next_chunk()) {
+    output_table->emplace_chunk(std::move(*chunk));
+  }
+
+  if (output_table->row_count() == 0 && _empty_output_chunk) {
+    output_table->emplace_chunk(std::move(*_empty_output_chunk));
+    _empty_output_chunk = std::nullopt;
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
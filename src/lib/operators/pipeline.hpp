@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Table;
+
+/**
+ * A Pipeline executes a chain of pipelineable operators (see AbstractOperator::is_pipelineable) chunk by chunk.
+ * Every chunk of the input is passed through all operators before the next one is read, so that the chunk is still in
+ * the cache when the next operator processes it. Operators that are executed on their own materialize their entire
+ * output before their consumer starts.
+ *
+ * The output chunks of all operators but the last one are collected in one intermediate table per operator. Chunks
+ * that an operator forwards (e.g., a Projection that forwards DictionaryColumns) are thus referenced through the same
+ * table by all output chunks of the next operator, as Sort, TopK, and create_reference_table expect.
+ *
+ * Once the next operator has processed an intermediate chunk that consists of ReferenceColumns, the chunk is released
+ * (see Table::release_chunks), as the next operator's output references the tables that the ReferenceColumns
+ * reference instead. Peak memory is then proportional to one chunk. Intermediate chunks that hold forwarded
+ * DictionaryColumns are kept as long as the pipeline, because the output of the next operator may reference them.
+ *
+ * Example:
+ *   auto scan = std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpEquals, 42);
+ *   auto limit = std::make_shared<Limit>(scan, 100);
+ *   get_table->execute();
+ *
+ *   Pipeline pipeline(limit);
+ *   while (auto chunk = pipeline.next_chunk()) {
+ *     ...
+ *   }
+ *
+ * Once an operator is exhausted (e.g., a Limit has produced enough rows), no further input chunks are read.
+ */
+class Pipeline : private Noncopyable {
+ public:
+  // Creates a pipeline that consists of root and its left inputs as long as they are pipelineable. The first input
+  // that is not pipelineable provides the pipeline's input and has to be executed beforehand.
+  explicit Pipeline(const std::shared_ptr<const AbstractOperator>& root);
+
+  // Creates a pipeline that passes the chunks of input_table through the given operators, starting with the first one.
+  // The operators are not owned by the pipeline.
+  Pipeline(const std::shared_ptr<const Table>& input_table, const std::vector<const AbstractOperator*>& operators);
+
+  // returns the next non-empty output chunk or std::nullopt once the pipeline is done
+  std::optional<Chunk> next_chunk();
+
+  // runs the rest of the pipeline and collects the output chunks into a table
+  std::shared_ptr<Table> execute();
+
+ protected:
+  // releases the chunk of the operator's intermediate table once the next operator has processed it
+  void _release_intermediate_chunk(size_t operator_id, ChunkID chunk_id);
+
+  const std::shared_ptr<const Table> _input_table;
+  std::vector<const AbstractOperator*> _operators;
+
+  // the input table of every operator, which provides the column definitions
+  std::vector<std::shared_ptr<const Table>> _input_definitions;
+  // the output of every operator but the last one, which is the input of the next operator
+  std::vector<std::shared_ptr<Table>> _intermediate_tables;
+  std::vector<size_t> _emitted_row_counts;
+  ChunkID _next_input_chunk_id{0};
+
+  // An empty output chunk is kept so that a table without any output rows can still hold a chunk with all columns
+  std::optional<Chunk> _empty_output_chunk;
+};
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#include "projection.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "pipeline.hpp"
+#include "storage/base_dictionary_column.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Projection::Projection(const std::shared_ptr<const AbstractOperator> in, const std::vector<ColumnID>& column_ids)
+    : AbstractOperator(in), _column_ids(column_ids) {}
+
+const std::string Projection::name() const { return "Projection"; }
+
+const std::string Projection::description() const {
+  std::string description = "Projection (";
+  for (size_t i = 0; i < _column_ids.size(); ++i) {
+    if (i > 0) description += ", ";
+    description += "#" + std::to_string(_column_ids[i]);
+  }
+  return description + ")";
+}
+
+const std::vector<ColumnID>& Projection::column_ids() const { return _column_ids; }
+
+bool Projection::is_pipelineable() const { return true; }
+
+std::shared_ptr<const Table> Projection::_on_execute() { return Pipeline(_input_table_left(), {this}).execute(); }
+
+bool Projection::_forwards_input_columns() const { return true; }
+
+std::shared_ptr<Table> Projection::_create_output_table(const Table& input_table) const {
+  auto output_table = std::make_shared<Table>(input_table.chunk_size(), _get_allocator());
+  for (const auto& column_id : _column_ids) {
+    Assert(column_id < input_table.col_count(), "Projection: Column " + std::to_string(column_id) + " does not exist");
+    output_table->add_column_definition(input_table.column_name(column_id), input_table.column_type(column_id),
+                                        input_table.column_is_nullable(column_id));
+  }
+  return output_table;
+}
+
+Chunk Projection::_on_execute_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                                    size_t) const {
+  const auto input_chunk = input_table->get_chunk(chunk_id);
+
+  Chunk output_chunk(input_chunk->numa_node(), _get_allocator());
+
+  // ValueColumns may still be appended to, so they are referenced up to the current size of the chunk instead
+  std::shared_ptr<PosList> pos_list;
+  for (const auto& column_id : _column_ids) {
+    const auto column = input_chunk->get_column(column_id);
+    if (std::dynamic_pointer_cast<const ReferenceColumn>(column) ||
+        std::dynamic_pointer_cast<const BaseDictionaryColumn>(column)) {
+      output_chunk.add_column(column);
+      continue;
+    }
+
+    if (!pos_list) {
+      pos_list = std::make_shared<PosList>(_get_allocator());
+      const auto row_count = input_chunk->size();
+      pos_list->reserve(row_count);
+      for (ChunkOffset chunk_offset{0}; chunk_offset < row_count; ++chunk_offset) {
+        pos_list->emplace_back(RowID{chunk_id, chunk_offset});
+      }
+    }
+    output_chunk.add_column(std::make_shared<ReferenceColumn>(input_table, column_id, pos_list));
+  }
+  return output_chunk;
+}
+
+}  // namespace opossum
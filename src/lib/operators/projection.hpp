@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that selects and reorders the columns of its input without copying any data.
+ *
+ * The output shares the input's immutable columns: ReferenceColumns are forwarded as they are, so the output keeps
+ * referencing the base tables directly instead of creating ReferenceColumns that point to ReferenceColumns.
+ * DictionaryColumns are shared as well. ValueColumns may still grow, so they are wrapped in ReferenceColumns that
+ * reference the rows the chunk holds when it is projected; the columns of a chunk share one PosList. The cost of a
+ * projection thus only depends on the number of rows for chunks that have not been compressed yet.
+ */
+class Projection : public AbstractOperator {
+ public:
+  Projection(const std::shared_ptr<const AbstractOperator> in, const std::vector<ColumnID>& column_ids);
+
+  const std::string name() const override;
+  const std::string description() const override;
+
+  const std::vector<ColumnID>& column_ids() const;
+
+  bool is_pipelineable() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  bool _forwards_input_columns() const override;
+
+  std::shared_ptr<Table> _create_output_table(const Table& input_table) const override;
+  Chunk _on_execute_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id,
+                          size_t emitted_row_count) const override;
+
+  const std::vector<ColumnID> _column_ids;
+};
+
+}  // namespace opossum
@@ -0,0 +1,179 @@
+#include "sort.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/chunk_scheduler.hpp"
+#include "storage/column_value_reader.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/create_reference_table.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename Key>
+bool is_ordered(const Key& lhs, const Key& rhs, const OrderByMode order_by_mode) {
+  return order_by_mode == OrderByMode::Ascending ? lhs < rhs : rhs < lhs;
+}
+
+}  // namespace
+
+std::string to_string(const SortColumnDefinition& sort_definition) {
+  return "#" + std::to_string(sort_definition.column_id) +
+         (sort_definition.order_by_mode == OrderByMode::Ascending ? " ASC" : " DESC");
+}
+
+Sort::Sort(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const uint32_t output_chunk_size)
+    : AbstractOperator(in), _sort_definitions(sort_definitions), _output_chunk_size(output_chunk_size) {}
+
+const std::string Sort::name() const { return "Sort"; }
+
+const std::string Sort::description() const {
+  std::string description = "Sort (";
+  for (size_t i = 0; i < _sort_definitions.size(); ++i) {
+    if (i > 0) description += ", ";
+    description += to_string(_sort_definitions[i]);
+  }
+  return description + ")";
+}
+
+const std::vector<SortColumnDefinition>& Sort::sort_definitions() const { return _sort_definitions; }
+
+std::shared_ptr<const Table> Sort::_on_execute() {
+  const auto input_table = _input_table_left();
+
+  for (const auto& sort_definition : _sort_definitions) {
+    Assert(sort_definition.column_id < input_table->col_count(),
+           "Sort: Column " + std::to_string(sort_definition.column_id) + " does not exist");
+  }
+
+  // every non-empty input chunk forms one run that is sorted independently
+  PosList row_ids(_get_allocator());
+  row_ids.reserve(input_table->row_count());
+  std::vector<size_t> run_begins;
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    const auto chunk_size = input_table->get_chunk(chunk_id)->size();
+    if (chunk_size == 0) continue;
+
+    run_begins.push_back(row_ids.size());
+    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+      row_ids.push_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+
+  // sorting by the least significant key first and keeping the order of equal rows in every following pass yields
+  // the order of all keys
+  for (auto it = _sort_definitions.crbegin(); it != _sort_definitions.crend(); ++it) {
+    const auto& sort_definition = *it;
+    resolve_data_type(input_table->column_type(sort_definition.column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      _sort_by_column<ColumnDataType>(sort_definition, run_begins, row_ids);
+    });
+  }
+
+  return create_reference_table(input_table, row_ids, _output_chunk_size, _get_allocator());
+}
+
+template <typename T>
+void Sort::_sort_by_column(const SortColumnDefinition& sort_definition, const std::vector<size_t>& run_begins,
+                           PosList& row_ids) const {
+  const auto input_table = _input_table_left();
+  const auto order_by_mode = sort_definition.order_by_mode;
+  const auto compare_keys = [order_by_mode](const auto& lhs, const auto& rhs) {
+    return is_ordered(lhs.first, rhs.first, order_by_mode);
+  };
+
+  const auto run_end = [&](const size_t run_id) {
+    return run_id + 1 < run_begins.size() ? run_begins[run_id + 1] : row_ids.size();
+  };
+
+  // NULL is represented by std::nullopt, which sorts before all values
+  const auto nullable = input_table->column_is_nullable(sort_definition.column_id);
+  std::vector<std::pair<std::optional<T>, RowID>> keyed_row_ids(row_ids.size());
+
+  // sort the runs in parallel, preferably on the node that holds their first chunk
+  std::vector<NodeID> run_nodes(run_begins.size());
+  for (size_t run_id = 0; run_id < run_begins.size(); ++run_id) {
+    run_nodes[run_id] = input_table->chunk_numa_node(row_ids[run_begins[run_id]].chunk_id);
+  }
+
+  // readers are set up once per worker instead of once per run, because they cache the columns of all chunks
+  std::vector<std::unique_ptr<ColumnValueReader<T>>> readers(ChunkScheduler::max_worker_count());
+
+  ChunkScheduler::schedule_and_wait(run_nodes, [&](const size_t run_id, const size_t worker_id) {
+    const auto begin = run_begins[run_id];
+    const auto end = run_end(run_id);
+    auto& worker_reader = readers[worker_id];
+    if (!worker_reader) worker_reader = std::make_unique<ColumnValueReader<T>>(*input_table, sort_definition.column_id);
+    auto& reader = *worker_reader;
+
+    const auto chunk_id = row_ids[begin].chunk_id;
+    const auto single_chunk = std::all_of(row_ids.cbegin() + begin, row_ids.cbegin() + end,
+                                          [&](const RowID& row_id) { return row_id.chunk_id == chunk_id; });
+    const auto dictionary_column = single_chunk ? reader.dictionary_column(chunk_id) : nullptr;
+
+    if (dictionary_column) {
+      // The dictionary is sorted, so comparing the ValueIDs yields the same order as comparing the values. The
+      // ValueIDs are shifted by one, so that NULL, whose ValueID is behind the dictionary, becomes 0 and comes first.
+      const auto& attribute_vector = *dictionary_column->attribute_vector();
+      const auto null_value_id = dictionary_column->null_value_id();
+      std::vector<std::pair<ValueID::base_type, RowID>> value_ids(end - begin);
+      for (auto i = begin; i < end; ++i) {
+        const auto value_id = attribute_vector.get(row_ids[i].chunk_offset);
+        value_ids[i - begin] = {value_id == null_value_id ? 0 : value_id.t + 1, row_ids[i]};
+      }
+      std::stable_sort(value_ids.begin(), value_ids.end(), compare_keys);
+
+      const auto& dictionary = *dictionary_column->dictionary();
+      for (auto i = begin; i < end; ++i) {
+        const auto& value_id = value_ids[i - begin];
+        keyed_row_ids[i] = {value_id.first == 0 ? std::nullopt : std::optional<T>{dictionary[value_id.first - 1]},
+                            value_id.second};
+      }
+      return;
+    }
+
+    for (auto i = begin; i < end; ++i) {
+      const auto is_null = nullable && reader.is_null(row_ids[i]);
+      keyed_row_ids[i] = {is_null ? std::nullopt : std::optional<T>{reader.get(row_ids[i])}, row_ids[i]};
+    }
+    std::stable_sort(keyed_row_ids.begin() + begin, keyed_row_ids.begin() + end, compare_keys);
+  });
+
+  // merge neighbouring runs until only one is left. inplace_merge keeps rows of the left run first if keys are equal.
+  auto merged_run_begins = run_begins;
+  while (merged_run_begins.size() > 1) {
+    const auto merge_count = merged_run_begins.size() / 2;
+    const auto merged_run_end = [&](const size_t run_id) {
+      return run_id + 1 < merged_run_begins.size() ? merged_run_begins[run_id + 1] : row_ids.size();
+    };
+
+    ChunkScheduler::schedule_and_wait(std::vector<NodeID>(merge_count, 0), [&](const size_t merge_id) {
+      const auto begin = keyed_row_ids.begin() + merged_run_begins[2 * merge_id];
+      const auto middle = keyed_row_ids.begin() + merged_run_begins[2 * merge_id + 1];
+      const auto end = keyed_row_ids.begin() + merged_run_end(2 * merge_id + 1);
+      std::inplace_merge(begin, middle, end, compare_keys);
+    });
+
+    std::vector<size_t> next_run_begins;
+    for (size_t run_id = 0; run_id < merged_run_begins.size(); run_id += 2) {
+      next_run_begins.push_back(merged_run_begins[run_id]);
+    }
+    merged_run_begins = std::move(next_run_begins);
+  }
+
+  for (size_t i = 0; i < row_ids.size(); ++i) {
+    row_ids[i] = keyed_row_ids[i].second;
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+struct SortColumnDefinition {
+  ColumnID column_id;
+  OrderByMode order_by_mode = OrderByMode::Ascending;
+};
+
+// e.g., "#0 ASC"
+std::string to_string(const SortColumnDefinition& sort_definition);
+
+/**
+ * Operator that sorts its input by one or more columns. The first definition is the most significant one, rows with
+ * equal keys keep their input order. NULL values come first in ascending and last in descending order.
+ *
+ * The output consists of ReferenceColumns that point to the tables the input's columns reference (or to the input
+ * itself if it holds data columns), split into chunks of output_chunk_size rows (0 means a single chunk).
+ *
+ * The rows are sorted once per key, starting with the least significant one. For every key, the typed values are
+ * extracted into a (value, RowID) array whose ranges are sorted in parallel and merged afterwards. Ranges that lie
+ * within a single DictionaryColumn are sorted by ValueID, because the dictionary is ordered.
+ */
+class Sort : public AbstractOperator {
+ public:
+  Sort(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const uint32_t output_chunk_size = 0);
+
+  const std::string name() const override;
+  const std::string description() const override;
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // sorts row_ids by the given column, keeping the order of rows with equal values.
+  // row_ids is divided into runs that start at the given offsets and are sorted in parallel.
+  template <typename T>
+  void _sort_by_column(const SortColumnDefinition& sort_definition, const std::vector<size_t>& run_begins,
+                       PosList& row_ids) const;
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  const uint32_t _output_chunk_size;
+};
+
+}  // namespace opossum
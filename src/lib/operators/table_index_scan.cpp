@@ -0,0 +1,45 @@
+#include "table_index_scan.hpp"
+
+#include <memory>
+#include <string>
+
+#include "storage/index/table_index.hpp"
+#include "storage/table.hpp"
+#include "table_scan.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/create_reference_table.hpp"
+
+namespace opossum {
+
+TableIndexScan::TableIndexScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id,
+                               const ScanType scan_type, const AllTypeVariant search_value)
+    : AbstractOperator(in), _column_id(column_id), _scan_type(scan_type), _search_value(search_value) {
+  Assert(!is_null_scan_type(scan_type), "TableIndexScan: Table indexes do not index NULL values");
+  Assert(!is_like_scan_type(scan_type), "TableIndexScan: LIKE is not supported, use the TableScan");
+}
+
+const std::string TableIndexScan::name() const { return "TableIndexScan"; }
+
+const std::string TableIndexScan::description() const {
+  return "TableIndexScan (#" + std::to_string(_column_id) + " " + to_string(_scan_type) + " " +
+         type_cast<std::string>(_search_value) + ")";
+}
+
+ColumnID TableIndexScan::column_id() const { return _column_id; }
+
+ScanType TableIndexScan::scan_type() const { return _scan_type; }
+
+const AllTypeVariant& TableIndexScan::search_value() const { return _search_value; }
+
+std::shared_ptr<const Table> TableIndexScan::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto table_index = input_table->get_table_index(_column_id);
+  Assert(static_cast<bool>(table_index),
+         "TableIndexScan: Column " + std::to_string(_column_id) + " has no table index");
+
+  const auto row_ids = table_index->lookup(_scan_type, _search_value);
+  return create_reference_table(input_table, row_ids, input_table->chunk_size(), _get_allocator());
+}
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that selects the same rows as a TableScan, but looks them up in the table index over the column (see
+ * Table::create_table_index) instead of visiting the chunks. Its cost depends on the number of matching rows, not on
+ * the size of the table, which makes it the operator of choice for selective predicates such as key lookups.
+ *
+ * The input has to hold data columns and an index over the column. The output consists of ReferenceColumns with the
+ * rows in the order of the input, split into chunks of the input's chunk size.
+ * As NULL values are not indexed, OpIsNull and OpIsNotNull are not supported.
+ */
+class TableIndexScan : public AbstractOperator {
+ public:
+  TableIndexScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
+                 const AllTypeVariant search_value);
+
+  const std::string name() const override;
+  const std::string description() const override;
+
+  ColumnID column_id() const;
+  ScanType scan_type() const;
+  const AllTypeVariant& search_value() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
+};
+
+}  // namespace opossum
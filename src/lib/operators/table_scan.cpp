@@ -0,0 +1,421 @@
+#include "table_scan.hpp"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "pipeline.hpp"
+#include "resolve_type.hpp"
+#include "storage/column_value_reader.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/create_reference_table.hpp"
+#include "utils/like_matcher.hpp"
+
+namespace opossum {
+
+namespace {
+
+// calls functor with the comparison function object that corresponds to scan_type
+template <typename Functor>
+void with_comparator(const ScanType scan_type, const Functor& functor) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      functor(std::equal_to<>{});
+      return;
+    case ScanType::OpNotEquals:
+      functor(std::not_equal_to<>{});
+      return;
+    case ScanType::OpLessThan:
+      functor(std::less<>{});
+      return;
+    case ScanType::OpLessThanEquals:
+      functor(std::less_equal<>{});
+      return;
+    case ScanType::OpGreaterThan:
+      functor(std::greater<>{});
+      return;
+    case ScanType::OpGreaterThanEquals:
+      functor(std::greater_equal<>{});
+      return;
+    default:
+      Fail("Unsupported scan type");
+  }
+}
+
+// The loops are bounded by the chunk's size instead of the values' size, as rows may be appended concurrently (see
+// ValueColumn).
+template <typename T>
+void scan_value_column(const ValueColumn<T>& column, const ChunkOffset chunk_size, const ScanType scan_type,
+                       const T& search_value, std::vector<ChunkOffset>& matches) {
+  const auto& values = column.values();
+  with_comparator(scan_type, [&](auto comparator) {
+    if (!column.is_nullable()) {
+      for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+        if (comparator(values[chunk_offset], search_value)) matches.push_back(chunk_offset);
+      }
+      return;
+    }
+
+    // NULL never compares true
+    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+      if (!column.is_null(chunk_offset) && comparator(values[chunk_offset], search_value)) {
+        matches.push_back(chunk_offset);
+      }
+    }
+  });
+}
+
+// calls functor with the ValueIDs of the attribute vector
+template <typename Functor>
+void with_value_ids(const BaseAttributeVector& attribute_vector, const Functor& functor) {
+  const auto resolve = [&](auto fitted_attribute_vector) {
+    Assert(fitted_attribute_vector, "Only FittedAttributeVectors can be scanned");
+    functor(fitted_attribute_vector->values());
+  };
+
+  switch (attribute_vector.width()) {
+    case 1:
+      resolve(dynamic_cast<const FittedAttributeVector<uint8_t>*>(&attribute_vector));
+      break;
+    case 2:
+      resolve(dynamic_cast<const FittedAttributeVector<uint16_t>*>(&attribute_vector));
+      break;
+    case 4:
+      resolve(dynamic_cast<const FittedAttributeVector<uint32_t>*>(&attribute_vector));
+      break;
+    default:
+      Fail("Unsupported attribute vector width");
+  }
+}
+
+template <typename T>
+void scan_dictionary_column(const DictionaryColumn<T>& column, const ScanType scan_type, const T& search_value,
+                            std::vector<ChunkOffset>& matches) {
+  const auto lower_bound = column.lower_bound(search_value);
+  const auto upper_bound = column.upper_bound(search_value);
+  const auto contains_value = lower_bound != INVALID_VALUE_ID && column.value_by_value_id(lower_bound) == search_value;
+
+  // As the dictionary is sorted, every scan type translates into a comparison with the ValueID of a bound. Some
+  // bounds tell us that all or none of the rows match without looking at the attribute vector.
+  auto value_id_scan_type = scan_type;
+  auto search_value_id = lower_bound;
+  auto all_match = false;
+  auto none_match = false;
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      none_match = !contains_value;
+      break;
+    case ScanType::OpNotEquals:
+      all_match = !contains_value;
+      break;
+    case ScanType::OpLessThan:
+      all_match = lower_bound == INVALID_VALUE_ID;
+      break;
+    case ScanType::OpLessThanEquals:
+      value_id_scan_type = ScanType::OpLessThan;
+      search_value_id = upper_bound;
+      all_match = upper_bound == INVALID_VALUE_ID;
+      break;
+    case ScanType::OpGreaterThan:
+      value_id_scan_type = ScanType::OpGreaterThanEquals;
+      search_value_id = upper_bound;
+      none_match = upper_bound == INVALID_VALUE_ID;
+      break;
+    case ScanType::OpGreaterThanEquals:
+      none_match = lower_bound == INVALID_VALUE_ID;
+      break;
+    default:
+      Fail("Unsupported scan type");
+  }
+
+  if (none_match) return;
+
+  // NULL is represented by the ValueID behind the dictionary, which compares greater than all others and has to be
+  // excluded from "all" and from the comparisons that it would pass
+  const auto null_value_id = column.null_value_id().t;
+  const auto& attribute_vector = *column.attribute_vector();
+  if (all_match) {
+    with_value_ids(attribute_vector, [&](const auto& value_ids) {
+      for (ChunkOffset chunk_offset = 0; chunk_offset < value_ids.size(); ++chunk_offset) {
+        if (value_ids[chunk_offset] != null_value_id) matches.push_back(chunk_offset);
+      }
+    });
+    return;
+  }
+
+  const auto may_match_null = value_id_scan_type == ScanType::OpNotEquals ||
+                              value_id_scan_type == ScanType::OpGreaterThanEquals;
+  with_comparator(value_id_scan_type, [&](auto comparator) {
+    with_value_ids(attribute_vector, [&](const auto& value_ids) {
+      for (ChunkOffset chunk_offset = 0; chunk_offset < value_ids.size(); ++chunk_offset) {
+        const auto value_id = value_ids[chunk_offset];
+        if (comparator(value_id, search_value_id.t) && !(may_match_null && value_id == null_value_id)) {
+          matches.push_back(chunk_offset);
+        }
+      }
+    });
+  });
+}
+
+// scans columns that are neither ValueColumns nor DictionaryColumns, i.e., ReferenceColumns
+template <typename T>
+void scan_referenced_values(const std::shared_ptr<const Table>& table, const ChunkID chunk_id, const ColumnID column_id,
+                            const ScanType scan_type, const T& search_value, ColumnValueReaderCache& reader_cache,
+                            std::vector<ChunkOffset>& matches) {
+  auto& reader = reader_cache.get<T>(table, column_id, chunk_id);
+  const auto nullable = table->column_is_nullable(column_id);
+  const auto chunk_size = table->get_chunk(chunk_id)->size();
+  with_comparator(scan_type, [&](auto comparator) {
+    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+      const auto row_id = RowID{chunk_id, chunk_offset};
+      if (nullable && reader.is_null(row_id)) continue;
+      if (comparator(reader.get(row_id), search_value)) matches.push_back(chunk_offset);
+    }
+  });
+}
+
+// handles OpIsNull and OpIsNotNull, which do not look at the values
+template <typename T>
+void scan_null_values(const std::shared_ptr<const Table>& table, const ChunkID chunk_id, const ColumnID column_id,
+                      const ScanType scan_type, ColumnValueReaderCache& reader_cache,
+                      std::vector<ChunkOffset>& matches) {
+  const auto chunk = table->get_chunk(chunk_id);
+  const auto column = chunk->get_column(column_id);
+  const auto chunk_size = chunk->size();
+  const auto match_null = scan_type == ScanType::OpIsNull;
+
+  if (!table->column_is_nullable(column_id)) {
+    if (match_null) return;
+    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+      matches.push_back(chunk_offset);
+    }
+    return;
+  }
+
+  if (const auto value_column = std::dynamic_pointer_cast<const ValueColumn<T>>(column)) {
+    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+      if (value_column->is_null(chunk_offset) == match_null) matches.push_back(chunk_offset);
+    }
+  } else if (const auto dictionary_column = std::dynamic_pointer_cast<const DictionaryColumn<T>>(column)) {
+    const auto null_value_id = dictionary_column->null_value_id().t;
+    with_value_ids(*dictionary_column->attribute_vector(), [&](const auto& value_ids) {
+      for (ChunkOffset chunk_offset = 0; chunk_offset < value_ids.size(); ++chunk_offset) {
+        if ((value_ids[chunk_offset] == null_value_id) == match_null) matches.push_back(chunk_offset);
+      }
+    });
+  } else {
+    auto& reader = reader_cache.get<T>(table, column_id, chunk_id);
+    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+      if (reader.is_null(RowID{chunk_id, chunk_offset}) == match_null) matches.push_back(chunk_offset);
+    }
+  }
+}
+
+// scans the ValueIDs for those in [begin, end) (or outside of it for OpNotLike), where end may be the null ValueID
+void scan_value_id_range(const BaseAttributeVector& attribute_vector, const ValueID::base_type begin,
+                         const ValueID::base_type end, const ValueID::base_type null_value_id, const bool match_like,
+                         std::vector<ChunkOffset>& matches) {
+  with_value_ids(attribute_vector, [&](const auto& value_ids) {
+    for (ChunkOffset chunk_offset = 0; chunk_offset < value_ids.size(); ++chunk_offset) {
+      const auto value_id = value_ids[chunk_offset];
+      const auto in_range = value_id >= begin && value_id < end;
+      if (in_range == match_like && value_id != null_value_id) matches.push_back(chunk_offset);
+    }
+  });
+}
+
+// The pattern is evaluated once per dictionary entry instead of once per row. Prefix patterns select a range of the
+// sorted dictionary, which is found by binary search without looking at the other entries.
+void scan_like_dictionary_column(const DictionaryColumn<std::string>& column, const bool match_like,
+                                 const LikeMatcher& matcher, std::vector<ChunkOffset>& matches) {
+  const auto& dictionary = *column.dictionary();
+  const auto null_value_id = column.null_value_id().t;
+  const auto& attribute_vector = *column.attribute_vector();
+
+  if (const auto& prefix = matcher.prefix()) {
+    const auto prefix_upper_bound = LikeMatcher::prefix_upper_bound(*prefix);
+    const auto begin = static_cast<ValueID::base_type>(dictionary.lower_bound(*prefix));
+    const auto end = static_cast<ValueID::base_type>(
+        prefix_upper_bound ? dictionary.lower_bound(*prefix_upper_bound) : dictionary.size());
+    if (begin == end && match_like) return;
+    scan_value_id_range(attribute_vector, begin, end, null_value_id, match_like, matches);
+    return;
+  }
+
+  // one entry per ValueID, including the null ValueID, which never matches
+  std::vector<uint8_t> value_id_matches(dictionary.size() + 1, false);
+  auto match_count = size_t{0};
+  dictionary.for_each([&](const size_t value_id, const auto value) {
+    value_id_matches[value_id] = matcher.matches(value) == match_like;
+    match_count += value_id_matches[value_id];
+  });
+  if (match_count == 0) return;
+
+  with_value_ids(attribute_vector, [&](const auto& value_ids) {
+    for (ChunkOffset chunk_offset = 0; chunk_offset < value_ids.size(); ++chunk_offset) {
+      if (value_id_matches[value_ids[chunk_offset]]) matches.push_back(chunk_offset);
+    }
+  });
+}
+
+// handles OpLike and OpNotLike. Like comparisons, neither matches NULL values.
+void scan_like(const std::shared_ptr<const Table>& table, const ChunkID chunk_id, const ColumnID column_id,
+               const ScanType scan_type, const LikeMatcher& matcher, ColumnValueReaderCache& reader_cache,
+               std::vector<ChunkOffset>& matches) {
+  const auto chunk = table->get_chunk(chunk_id);
+  const auto column = chunk->get_column(column_id);
+  const auto chunk_size = chunk->size();
+  const auto match_like = scan_type == ScanType::OpLike;
+
+  if (const auto value_column = std::dynamic_pointer_cast<const ValueColumn<std::string>>(column)) {
+    const auto& values = value_column->values();
+    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+      if (!value_column->is_null(chunk_offset) && matcher.matches(values[chunk_offset]) == match_like) {
+        matches.push_back(chunk_offset);
+      }
+    }
+  } else if (const auto dictionary_column = std::dynamic_pointer_cast<const DictionaryColumn<std::string>>(column)) {
+    scan_like_dictionary_column(*dictionary_column, match_like, matcher, matches);
+  } else {
+    auto& reader = reader_cache.get<std::string>(table, column_id, chunk_id);
+    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+      const auto row_id = RowID{chunk_id, chunk_offset};
+      if (!reader.is_null(row_id) && matcher.matches(reader.get(row_id)) == match_like) {
+        matches.push_back(chunk_offset);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+std::string to_string(const ScanType scan_type) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return "=";
+    case ScanType::OpNotEquals:
+      return "!=";
+    case ScanType::OpLessThan:
+      return "<";
+    case ScanType::OpLessThanEquals:
+      return "<=";
+    case ScanType::OpGreaterThan:
+      return ">";
+    case ScanType::OpGreaterThanEquals:
+      return ">=";
+    case ScanType::OpIsNull:
+      return "IS NULL";
+    case ScanType::OpIsNotNull:
+      return "IS NOT NULL";
+    case ScanType::OpLike:
+      return "LIKE";
+    case ScanType::OpNotLike:
+      return "NOT LIKE";
+    default:
+      Fail("Unsupported scan type");
+      return "";
+  }
+}
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
+                     const AllTypeVariant search_value)
+    : AbstractOperator(in), _column_id(column_id), _scan_type(scan_type), _search_value(search_value) {}
+
+TableScan::~TableScan() = default;
+
+const std::string TableScan::name() const { return "TableScan"; }
+
+const std::string TableScan::description() const {
+  if (is_null_scan_type(_scan_type)) {
+    return "TableScan (#" + std::to_string(_column_id) + " " + to_string(_scan_type) + ")";
+  }
+  return "TableScan (#" + std::to_string(_column_id) + " " + to_string(_scan_type) + " " +
+         type_cast<std::string>(_search_value) + ")";
+}
+
+ColumnID TableScan::column_id() const { return _column_id; }
+
+ScanType TableScan::scan_type() const { return _scan_type; }
+
+const AllTypeVariant& TableScan::search_value() const { return _search_value; }
+
+bool TableScan::is_pipelineable() const { return true; }
+
+std::shared_ptr<const Table> TableScan::_on_execute() { return Pipeline(_input_table_left(), {this}).execute(); }
+
+std::shared_ptr<Table> TableScan::_create_output_table(const Table& input_table) const {
+  Assert(_column_id < input_table.col_count(), "TableScan: Column " + std::to_string(_column_id) + " does not exist");
+
+  auto output_table = std::make_shared<Table>(input_table.chunk_size(), _get_allocator());
+  for (ColumnID column_id{0}; column_id < input_table.col_count(); ++column_id) {
+    output_table->add_column_definition(input_table.column_name(column_id), input_table.column_type(column_id),
+                                        input_table.column_is_nullable(column_id));
+  }
+  return output_table;
+}
+
+Chunk TableScan::_on_execute_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                                   size_t) const {
+  // transactions skip chunks whose rows they cannot see anyway
+  const auto context = transaction_context();
+  if (context && input_table->get_chunk(chunk_id)->is_fully_invalidated(context->snapshot_commit_id())) {
+    return create_reference_chunk(input_table, chunk_id, {}, _get_allocator());
+  }
+
+  const auto matches = scan_chunk(input_table, chunk_id, _column_id, _scan_type, _search_value, _reader_cache);
+  return create_reference_chunk(input_table, chunk_id, matches, _get_allocator());
+}
+
+std::vector<ChunkOffset> TableScan::scan_chunk(const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
+                                               const ColumnID column_id, const ScanType scan_type,
+                                               const AllTypeVariant& search_value,
+                                               ColumnValueReaderCache& reader_cache) {
+  const auto chunk = table->get_chunk(chunk_id);
+  const auto column = chunk->get_column(column_id);
+
+  std::vector<ChunkOffset> matches;
+  resolve_data_type(table->column_type(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    if (is_null_scan_type(scan_type)) {
+      scan_null_values<ColumnDataType>(table, chunk_id, column_id, scan_type, reader_cache, matches);
+      return;
+    }
+
+    // as in SQL, comparisons with NULL are never true
+    if (variant_is_null(search_value)) return;
+
+    if (is_like_scan_type(scan_type)) {
+      if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+        scan_like(table, chunk_id, column_id, scan_type, LikeMatcher{type_cast<std::string>(search_value)},
+                  reader_cache, matches);
+      } else {
+        Fail("LIKE can only be applied to string columns");
+      }
+      return;
+    }
+
+    const auto typed_search_value = type_cast<ColumnDataType>(search_value);
+
+    if (const auto value_column = std::dynamic_pointer_cast<const ValueColumn<ColumnDataType>>(column)) {
+      scan_value_column(*value_column, chunk->size(), scan_type, typed_search_value, matches);
+    } else if (const auto dictionary_column =
+                   std::dynamic_pointer_cast<const DictionaryColumn<ColumnDataType>>(column)) {
+      scan_dictionary_column(*dictionary_column, scan_type, typed_search_value, matches);
+    } else {
+      scan_referenced_values(table, chunk_id, column_id, scan_type, typed_search_value, reader_cache, matches);
+    }
+  });
+
+  return matches;
+}
+
+}  // namespace opossum
@@ -7,27 +7,61 @@
 
 #include "abstract_operator.hpp"
 #include "all_type_variant.hpp"
+#include "storage/column_value_reader.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-class BaseTableScanImpl;
 class Table;
 
+// returns the comparison operator of the scan type, e.g., "<=" or "IS NULL"
+std::string to_string(ScanType scan_type);
+
+// Operator that selects the rows whose value in the given column compares to search_value as specified by scan_type.
+// The output consists of ReferenceColumns. If the input consists of ReferenceColumns, the output references the
+// same tables. DictionaryColumns are scanned by comparing ValueIDs instead of values.
+// As in SQL, NULL values never match a comparison, and comparisons with a NULL search value match no rows. NULL values
+// are selected with OpIsNull or OpIsNotNull, for which the search value is ignored.
+// OpLike and OpNotLike match string columns against an SQL LIKE pattern (see LikeMatcher). For DictionaryColumns, the
+// pattern is evaluated once per distinct value, and prefix patterns such as "abc%" select a range of ValueIDs.
 class TableScan : public AbstractOperator {
  public:
   TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
             const AllTypeVariant search_value);
 
+  const std::string name() const override;
+  const std::string description() const override;
+
   ~TableScan();
 
   ColumnID column_id() const;
   ScanType scan_type() const;
   const AllTypeVariant& search_value() const;
 
+  bool is_pipelineable() const override;
+
+  // returns the offsets of the rows of the chunk chunk_id whose value in column_id matches the predicate, in
+  // ascending order. This is the work the TableScan does per chunk, other operators use it for chunks they cannot
+  // process in a better way (see IndexScan). ReferenceColumns are read with the reader of reader_cache, which callers
+  // keep across the chunks of a table.
+  static std::vector<ChunkOffset> scan_chunk(const std::shared_ptr<const Table>& table, ChunkID chunk_id,
+                                             ColumnID column_id, ScanType scan_type, const AllTypeVariant& search_value,
+                                             ColumnValueReaderCache& reader_cache);
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<Table> _create_output_table(const Table& input_table) const override;
+  Chunk _on_execute_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id,
+                          size_t emitted_row_count) const override;
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
+
+  // kept across the chunks of an execution, because setting up a ColumnValueReader is linear in the number of chunks
+  mutable ColumnValueReaderCache _reader_cache;
 };
 
 }  // namespace opossum
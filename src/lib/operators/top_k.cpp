@@ -0,0 +1,155 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/chunk_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/column_value_reader.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/create_reference_table.hpp"
+
+namespace opossum {
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator> in, const SortColumnDefinition& sort_definition,
+           const size_t k)
+    : AbstractOperator(in), _sort_definition(sort_definition), _k(k) {}
+
+const std::string TopK::name() const { return "TopK"; }
+
+const std::string TopK::description() const {
+  return "TopK (" + to_string(_sort_definition) + ", k = " + std::to_string(_k) + ")";
+}
+
+const SortColumnDefinition& TopK::sort_definition() const { return _sort_definition; }
+
+size_t TopK::k() const { return _k; }
+
+size_t TopK::skipped_chunk_count() const { return _skipped_chunk_count; }
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto input_table = _input_table_left();
+  Assert(_sort_definition.column_id < input_table->col_count(),
+         "TopK: Column " + std::to_string(_sort_definition.column_id) + " does not exist");
+
+  PosList row_ids(_get_allocator());
+  if (_k > 0) {
+    resolve_data_type(input_table->column_type(_sort_definition.column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      row_ids = _find_top_k<ColumnDataType>();
+    });
+  }
+
+  return create_reference_table(input_table, row_ids, 0, _get_allocator());
+}
+
+template <typename T>
+PosList TopK::_find_top_k() {
+  const auto input_table = _input_table_left();
+  const auto order_by_mode = _sort_definition.order_by_mode;
+
+  const auto nullable = input_table->column_is_nullable(_sort_definition.column_id);
+
+  // NULL is represented by std::nullopt, which sorts before all values like in the Sort
+  struct Candidate {
+    std::optional<T> value;
+    RowID row_id;
+  };
+
+  // ties are broken by the position in the input, so that the result is the same as that of a stable sort
+  const auto is_ordered = [order_by_mode](const std::optional<T>& lhs, const std::optional<T>& rhs) {
+    return order_by_mode == OrderByMode::Ascending ? lhs < rhs : rhs < lhs;
+  };
+  const auto is_better = [&](const Candidate& lhs, const Candidate& rhs) {
+    if (is_ordered(lhs.value, rhs.value)) return true;
+    if (is_ordered(rhs.value, lhs.value)) return false;
+    return lhs.row_id < rhs.row_id;
+  };
+
+  size_t cpu_count = 0;
+  for (NodeID node_id = 0; node_id < Topology::get().node_count(); ++node_id) {
+    cpu_count += Topology::get().cpu_count(node_id);
+  }
+  const auto task_count = std::max(size_t{1}, std::min(cpu_count, static_cast<size_t>(input_table->chunk_count())));
+
+  // task i processes the chunks i, i + task_count, ... and runs on the node of its first chunk
+  std::vector<NodeID> task_nodes(task_count);
+  for (size_t task_id = 0; task_id < task_count; ++task_id) {
+    task_nodes[task_id] = input_table->chunk_numa_node(ChunkID{static_cast<ChunkID::base_type>(task_id)});
+  }
+
+  // the heaps keep their worst candidate at the front and never hold more candidates than there are rows
+  std::vector<std::vector<Candidate>> heaps(task_count);
+  const auto heap_capacity = std::min<size_t>(_k, input_table->row_count());
+  std::atomic<size_t> skipped_chunk_count{0};
+
+  ChunkScheduler::schedule_and_wait(task_nodes, [&](const size_t task_id) {
+    auto& heap = heaps[task_id];
+    heap.reserve(heap_capacity);
+    ColumnValueReader<T> reader(*input_table, _sort_definition.column_id);
+
+    for (auto chunk_index = task_id; chunk_index < input_table->chunk_count().t; chunk_index += task_count) {
+      const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_index)};
+      const auto chunk_size = input_table->get_chunk(chunk_id)->size();
+      if (chunk_size == 0) continue;
+
+      // The chunks of a task are processed in order, so rows of this chunk lose all ties against the heap's rows.
+      // Hence, the chunk can only contribute if its best value is strictly better than the worst candidate.
+      if (heap.size() == _k) {
+        if (const auto dictionary_column = reader.dictionary_column(chunk_id)) {
+          // NULL values are not part of the dictionary. As they come first in ascending order, chunks of nullable
+          // columns are only skipped in descending order.
+          const auto& dictionary = *dictionary_column->dictionary();
+          auto best_value = std::optional<T>{};
+          if (order_by_mode == OrderByMode::Descending && !dictionary.empty()) best_value = dictionary.back();
+          if (order_by_mode == OrderByMode::Ascending && !nullable) best_value = dictionary.front();
+          if (!is_ordered(best_value, heap.front().value)) {
+            ++skipped_chunk_count;
+            continue;
+          }
+        }
+      }
+
+      for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+        const RowID row_id{chunk_id, chunk_offset};
+        Candidate candidate{nullable && reader.is_null(row_id) ? std::nullopt : std::optional<T>{reader.get(row_id)},
+                            row_id};
+
+        if (heap.size() < _k) {
+          heap.push_back(std::move(candidate));
+          std::push_heap(heap.begin(), heap.end(), is_better);
+        } else if (is_better(candidate, heap.front())) {
+          std::pop_heap(heap.begin(), heap.end(), is_better);
+          heap.back() = std::move(candidate);
+          std::push_heap(heap.begin(), heap.end(), is_better);
+        }
+      }
+    }
+  });
+
+  _skipped_chunk_count = skipped_chunk_count;
+
+  std::vector<Candidate> candidates;
+  for (auto& heap : heaps) {
+    std::move(heap.begin(), heap.end(), std::back_inserter(candidates));
+  }
+  const auto result_size = std::min(_k, candidates.size());
+  std::partial_sort(candidates.begin(), candidates.begin() + result_size, candidates.end(), is_better);
+
+  PosList row_ids(_get_allocator());
+  row_ids.reserve(result_size);
+  for (size_t i = 0; i < result_size; ++i) {
+    row_ids.push_back(candidates[i].row_id);
+  }
+  return row_ids;
+}
+
+}  // namespace opossum
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "sort.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that returns the first k rows of its input in the order given by sort_definition, i.e., the same rows as
+ * a Sort followed by a Limit, without sorting the entire input. Rows with equal values keep their input order, and
+ * NULL values are ordered like in the Sort.
+ *
+ * The chunks are distributed over one task per CPU. Every task keeps the best k rows it has seen so far in a bounded
+ * heap, and the heaps are merged at the end. Before scanning a DictionaryColumn, a task compares the smallest (or
+ * largest) value of the dictionary with the worst row in its heap and skips the chunk if it cannot contribute.
+ */
+class TopK : public AbstractOperator {
+ public:
+  TopK(const std::shared_ptr<const AbstractOperator> in, const SortColumnDefinition& sort_definition, const size_t k);
+
+  const std::string name() const override;
+  const std::string description() const override;
+
+  const SortColumnDefinition& sort_definition() const;
+  size_t k() const;
+
+  // returns the number of chunks that were not scanned because they could not contribute to the result
+  size_t skipped_chunk_count() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  template <typename T>
+  PosList _find_top_k();
+
+  const SortColumnDefinition _sort_definition;
+  const size_t _k;
+  size_t _skipped_chunk_count = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#include "update.hpp"
+
+#include <memory>
+#include <string>
+
+#include "concurrency/transaction_context.hpp"
+#include "delete.hpp"
+#include "insert.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Update::Update(const std::string& table_name, const std::shared_ptr<const AbstractOperator>& rows_to_update,
+               const std::shared_ptr<const AbstractOperator>& updated_values)
+    : AbstractReadWriteOperator(rows_to_update, updated_values), _table_name(table_name) {}
+
+const std::string Update::name() const { return "Update"; }
+
+const std::string Update::description() const { return "Update (" + _table_name + ")"; }
+
+const std::string& Update::table_name() const { return _table_name; }
+
+void Update::commit_records(CommitID) {}
+
+void Update::rollback_records() {}
+
+std::shared_ptr<const Table> Update::_on_execute() {
+  const auto context = transaction_context();
+  Assert(context && context->phase() == TransactionPhase::Active, "Update has to be executed in an active transaction");
+  Assert(_input_table_left()->row_count() == _input_table_right()->row_count(),
+         "Update: There has to be one updated row per row to update");
+
+  _delete = std::make_shared<Delete>(_table_name, _input_left);
+  _delete->set_transaction_context(context);
+  _delete->execute();
+  if (_delete->execute_failed()) {
+    _execute_failed = true;
+    return nullptr;
+  }
+
+  _insert = std::make_shared<Insert>(_table_name, _input_right);
+  _insert->set_transaction_context(context);
+  _insert->execute();
+  return nullptr;
+}
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_read_write_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Delete;
+class Insert;
+
+// Operator that replaces rows of the MVCC table with the given name by new versions. It deletes the rows that
+// rows_to_update references (see Delete) and appends the rows of updated_values to the table's mutable chunk (see
+// Insert), so that transactions see either the old or the new versions. updated_values needs the columns of the table.
+// Like Delete, Update fails if another transaction modified one of the rows. Update has no output.
+class Update : public AbstractReadWriteOperator {
+ public:
+  Update(const std::string& table_name, const std::shared_ptr<const AbstractOperator>& rows_to_update,
+         const std::shared_ptr<const AbstractOperator>& updated_values);
+
+  const std::string name() const override;
+  const std::string description() const override;
+
+  const std::string& table_name() const;
+
+  // The Delete and the Insert register with the transaction themselves, so that there is nothing left to do
+  void commit_records(CommitID commit_id) override;
+  void rollback_records() override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::string _table_name;
+  std::shared_ptr<Delete> _delete;
+  std::shared_ptr<Insert> _insert;
+};
+
+}  // namespace opossum
@@ -0,0 +1,105 @@
+#include "validate.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "pipeline.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/create_reference_table.hpp"
+
+namespace opossum {
+
+Validate::Validate(const std::shared_ptr<const AbstractOperator> in) : AbstractOperator(in) {}
+
+const std::string Validate::name() const { return "Validate"; }
+
+bool Validate::is_pipelineable() const { return true; }
+
+bool Validate::is_row_visible(const TransactionID our_tid, const CommitID snapshot_commit_id,
+                              const TransactionID row_tid, const CommitID begin_cid, const CommitID end_cid) {
+  // Rows that the transaction inserted itself are visible until it deletes them. Rows of other transactions are
+  // visible if they were committed before the snapshot and not deleted before it. A row that the transaction is
+  // deleting carries its TransactionID and is thus invisible to it, but still visible to others.
+  const auto own_insert = row_tid == our_tid && begin_cid == MAX_COMMIT_ID && end_cid == MAX_COMMIT_ID;
+  const auto past_insert = row_tid != our_tid && begin_cid <= snapshot_commit_id && snapshot_commit_id < end_cid;
+  return own_insert || past_insert;
+}
+
+std::shared_ptr<const Table> Validate::_on_execute() { return Pipeline(_input_table_left(), {this}).execute(); }
+
+std::shared_ptr<Table> Validate::_create_output_table(const Table& input_table) const {
+  Assert(static_cast<bool>(transaction_context()), "Validate has to be executed in a transaction");
+
+  auto output_table = std::make_shared<Table>(input_table.chunk_size(), _get_allocator());
+  for (ColumnID column_id{0}; column_id < input_table.col_count(); ++column_id) {
+    output_table->add_column_definition(input_table.column_name(column_id), input_table.column_type(column_id),
+                                        input_table.column_is_nullable(column_id));
+  }
+  return output_table;
+}
+
+Chunk Validate::_on_execute_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                                  size_t) const {
+  const auto context = transaction_context();
+  Assert(static_cast<bool>(context), "Validate has to be executed in a transaction");
+  const auto our_tid = context->transaction_id();
+  const auto snapshot_commit_id = context->snapshot_commit_id();
+
+  const auto chunk = input_table->get_chunk(chunk_id);
+  const auto is_visible = [&](const Chunk::MvccColumns& mvcc_columns, const ChunkOffset chunk_offset) {
+    return is_row_visible(our_tid, snapshot_commit_id, mvcc_columns.tids[chunk_offset],
+                          mvcc_columns.begin_cids[chunk_offset], mvcc_columns.end_cids[chunk_offset]);
+  };
+
+  std::vector<ChunkOffset> visible_chunk_offsets;
+  const auto reference_column = chunk->col_count() > 0
+                                    ? std::dynamic_pointer_cast<const ReferenceColumn>(chunk->get_column(ColumnID{0}))
+                                    : nullptr;
+
+  if (reference_column) {
+    // all columns of a chunk reference the same rows, so that the first one tells which rows they are
+    const auto& referenced_table = *reference_column->referenced_table();
+    const auto& pos_list = *reference_column->pos_list();
+    Assert(referenced_table.uses_mvcc(), "Validate: The referenced table does not use MVCC");
+
+    // A chunk's rows usually reference few chunks of the referenced table, in runs of consecutive rows. Their MVCC
+    // columns are looked up once and kept in a map, the current run's ones are also kept outside of it.
+    std::map<ChunkID, std::shared_ptr<const Chunk::MvccColumns>> referenced_mvcc_columns;
+    auto current_chunk_id = ChunkID{0};
+    const Chunk::MvccColumns* current_mvcc_columns = nullptr;
+
+    for (ChunkOffset chunk_offset = 0; chunk_offset < pos_list.size(); ++chunk_offset) {
+      const auto& row_id = pos_list[chunk_offset];
+      if (!current_mvcc_columns || row_id.chunk_id != current_chunk_id) {
+        auto& mvcc_columns = referenced_mvcc_columns[row_id.chunk_id];
+        if (!mvcc_columns) mvcc_columns = referenced_table.get_chunk(row_id.chunk_id)->mvcc_columns();
+        current_chunk_id = row_id.chunk_id;
+        current_mvcc_columns = mvcc_columns.get();
+      }
+
+      // the MVCC columns of released chunks (see Table::release_chunks) are empty, their rows are invisible
+      if (row_id.chunk_offset < current_mvcc_columns->capacity() &&
+          is_visible(*current_mvcc_columns, row_id.chunk_offset)) {
+        visible_chunk_offsets.push_back(chunk_offset);
+      }
+    }
+  } else {
+    Assert(chunk->has_mvcc_columns(), "Validate: The input table does not use MVCC");
+
+    const auto mvcc_columns = chunk->mvcc_columns();
+    // the rows of fully invalidated chunks do not have to be looked at
+    const auto chunk_size = chunk->is_fully_invalidated(snapshot_commit_id) ? 0u : chunk->size();
+    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk_size; ++chunk_offset) {
+      if (is_visible(*mvcc_columns, chunk_offset)) visible_chunk_offsets.push_back(chunk_offset);
+    }
+  }
+
+  return create_reference_chunk(input_table, chunk_id, visible_chunk_offsets, _get_allocator());
+}
+
+}  // namespace opossum
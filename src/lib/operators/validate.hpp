@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Operator that removes the rows that are invisible to its transaction (see TransactionContext), i.e., rows that other
+// transactions inserted but had not committed when it started, and rows whose deletion had been committed by then.
+// The input has to be an MVCC table or consist of ReferenceColumns that reference one, e.g., the output of a
+// TableScan on it. The output consists of ReferenceColumns.
+//
+// As other transactions append to MVCC tables while they are read, a row might already be present in some columns but
+// not yet in others. Such rows are invisible, so a plan has to validate before it reads a second column of the table,
+// e.g., GetTable -> TableScan -> Validate -> TableScan. Validating the output of a selective scan is also cheaper than
+// validating the whole table.
+class Validate : public AbstractOperator {
+ public:
+  explicit Validate(const std::shared_ptr<const AbstractOperator> in);
+
+  const std::string name() const override;
+
+  bool is_pipelineable() const override;
+
+  // returns whether a row with the given MVCC information is visible to the transaction our_tid with the given snapshot
+  static bool is_row_visible(TransactionID our_tid, CommitID snapshot_commit_id, TransactionID row_tid,
+                             CommitID begin_cid, CommitID end_cid);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<Table> _create_output_table(const Table& input_table) const override;
+  Chunk _on_execute_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id,
+                          size_t emitted_row_count) const override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,137 @@
+#include "chunk_scheduler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "storage/table.hpp"
+#include "topology.hpp"
+#include "worker_pool.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Tracks the pool jobs of one schedule_and_wait call. Once all tasks have been claimed, the group is closed. Jobs that
+// only start afterwards return without touching the state of the call, so that it does not have to wait for workers
+// that are still busy with other jobs.
+struct JobGroup {
+  bool enter() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (closed) return false;
+    ++active_job_count;
+    return true;
+  }
+
+  void leave() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (--active_job_count == 0) all_jobs_left.notify_all();
+  }
+
+  void close_and_wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    closed = true;
+    all_jobs_left.wait(lock, [&]() { return active_job_count == 0; });
+  }
+
+  std::mutex mutex;
+  std::condition_variable all_jobs_left;
+  size_t active_job_count = 0;
+  bool closed = false;
+};
+
+}  // namespace
+
+void ChunkScheduler::schedule_and_wait(const std::vector<NodeID>& task_nodes,
+                                       const std::function<void(size_t)>& task) {
+  schedule_and_wait(task_nodes, [&](const size_t task_id, size_t) { task(task_id); });
+}
+
+void ChunkScheduler::schedule_and_wait(const std::vector<NodeID>& task_nodes,
+                                       const std::function<void(size_t, size_t)>& task) {
+  if (task_nodes.empty()) return;
+
+  const auto& topology = Topology::get();
+  const auto node_count = topology.node_count();
+
+  std::vector<std::vector<size_t>> task_queues(node_count);
+  for (size_t task_id = 0; task_id < task_nodes.size(); ++task_id) {
+    task_queues[task_nodes[task_id] % node_count].push_back(task_id);
+  }
+
+  // single-threaded execution does not pay off for a single task or a single CPU
+  if (task_nodes.size() == 1 || (node_count == 1 && topology.cpu_count(NodeID{0}) == 1)) {
+    for (size_t task_id = 0; task_id < task_nodes.size(); ++task_id) task(task_id, 0);
+    return;
+  }
+
+  std::vector<std::atomic<size_t>> next_task_indices(node_count);
+  std::atomic_bool failed{false};
+  std::exception_ptr exception;
+  std::mutex exception_mutex;
+
+  const auto work = [&](const NodeID node_id, const size_t worker_id) {
+    // process the tasks of the own node first, then steal from the other nodes
+    for (size_t node_offset = 0; node_offset < node_count; ++node_offset) {
+      const auto queue_id = (node_id + node_offset) % node_count;
+      const auto& task_queue = task_queues[queue_id];
+
+      for (auto index = next_task_indices[queue_id]++; index < task_queue.size() && !failed;
+           index = next_task_indices[queue_id]++) {
+        try {
+          task(task_queue[index], worker_id);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(exception_mutex);
+          if (!failed) exception = std::current_exception();
+          failed = true;
+        }
+      }
+    }
+  };
+
+  // the scheduling thread is worker 0, the jobs handed to the WorkerPool are the workers 1 to n
+  auto& worker_pool = WorkerPool::get();
+  const auto job_group = std::make_shared<JobGroup>();
+  size_t worker_id = 1;
+  for (NodeID node_id{0}; node_id < node_count; ++node_id) {
+    const auto node_worker_count = std::min(topology.cpu_count(node_id), task_nodes.size());
+    for (size_t node_worker_id = 0; node_worker_id < node_worker_count; ++node_worker_id, ++worker_id) {
+      worker_pool.submit(node_id, [job_group, &work, node_id, worker_id]() {
+        if (!job_group->enter()) return;
+        work(node_id, worker_id);
+        job_group->leave();
+      });
+    }
+  }
+
+  // The scheduling thread processes tasks as well. This guarantees progress if all workers are busy, e.g., because the
+  // tasks are scheduled from within another task.
+  work(topology.current_node(), 0);
+  job_group->close_and_wait();
+
+  if (exception) std::rethrow_exception(exception);
+}
+
+size_t ChunkScheduler::max_worker_count() {
+  const auto& topology = Topology::get();
+
+  size_t cpu_count = 0;
+  for (NodeID node_id{0}; node_id < topology.node_count(); ++node_id) cpu_count += topology.cpu_count(node_id);
+  return cpu_count + 1;
+}
+
+void ChunkScheduler::schedule_per_chunk_and_wait(const Table& table, const std::function<void(ChunkID)>& task) {
+  std::vector<NodeID> task_nodes(table.chunk_count());
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    task_nodes[chunk_id] = table.chunk_numa_node(chunk_id);
+  }
+
+  schedule_and_wait(task_nodes, [&](size_t task_id) { task(ChunkID{static_cast<ChunkID::base_type>(task_id)}); });
+}
+
+}  // namespace opossum
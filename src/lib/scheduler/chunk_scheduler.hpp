@@ -0,0 +1,35 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// The ChunkScheduler executes independent tasks, usually one per chunk, on worker threads and waits for them to
+// finish. The tasks are processed by the persistent workers of each NUMA node (see WorkerPool) and by the scheduling
+// thread. Workers first process the tasks that prefer their node and only then help out with the tasks of other nodes,
+// so that chunks are mostly processed on the node that holds their memory.
+//
+// If a task throws, the remaining tasks are skipped and the first exception is rethrown by the scheduling thread.
+class ChunkScheduler {
+ public:
+  // executes task(i) for every entry i of task_nodes, preferably on node task_nodes[i]
+  static void schedule_and_wait(const std::vector<NodeID>& task_nodes, const std::function<void(size_t)>& task);
+
+  // executes task(i, worker_id) for every entry i of task_nodes. worker_id identifies the executing worker and is
+  // below max_worker_count(). Tasks with the same worker_id never run concurrently, so they can share state that is
+  // expensive to set up, e.g., a ColumnValueReader.
+  static void schedule_and_wait(const std::vector<NodeID>& task_nodes, const std::function<void(size_t, size_t)>& task);
+
+  // returns the maximum number of workers that execute the tasks of one schedule_and_wait call
+  static size_t max_worker_count();
+
+  // executes task(chunk_id) for every chunk of the table, preferably on the node the chunk is placed on
+  static void schedule_per_chunk_and_wait(const Table& table, const std::function<void(ChunkID)>& task);
+};
+
+}  // namespace opossum
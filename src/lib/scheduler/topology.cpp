@@ -0,0 +1,99 @@
+#include "topology.hpp"
+
+#if HYRISE_NUMA_SUPPORT
+#include <numa.h>
+#endif
+
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the node the calling thread was bound to with bind_current_thread_to_node
+thread_local std::optional<NodeID> current_thread_node;
+
+}  // namespace
+
+Topology::Topology() {
+#if HYRISE_NUMA_SUPPORT
+  if (numa_available() >= 0) {
+    std::vector<size_t> cpu_counts(numa_max_node() + 1, 0);
+    for (auto cpu = 0; cpu < numa_num_configured_cpus(); ++cpu) {
+      const auto node = numa_node_of_cpu(cpu);
+      if (node >= 0) ++cpu_counts[node];
+    }
+
+    // memory-only nodes cannot run workers and are left out
+    for (auto node = 0; node < static_cast<int>(cpu_counts.size()); ++node) {
+      if (cpu_counts[node] == 0) continue;
+      _numa_node_ids.push_back(node);
+      _cpu_counts.push_back(cpu_counts[node]);
+    }
+  }
+#endif
+
+  if (_cpu_counts.empty()) {
+    _numa_node_ids = {0};
+    _cpu_counts = {std::max(std::thread::hardware_concurrency(), 1u)};
+  }
+}
+
+const Topology& Topology::get() {
+  static Topology instance;
+  return instance;
+}
+
+size_t Topology::node_count() const { return _cpu_counts.size(); }
+
+size_t Topology::cpu_count(NodeID node_id) const { return _cpu_counts.at(node_id); }
+
+int Topology::numa_node_id(NodeID node_id) const { return _numa_node_ids.at(node_id); }
+
+void Topology::bind_current_thread_to_node(NodeID node_id) const {
+  DebugAssert(node_id < node_count(), "Invalid NUMA node");
+
+#if HYRISE_NUMA_SUPPORT
+  if (node_count() > 1) numa_run_on_node(_numa_node_ids[node_id]);
+#endif
+  current_thread_node = node_id;
+}
+
+NodeID Topology::current_node() const { return current_thread_node.value_or(NodeID{0}); }
+
+void Topology::run_on_node(NodeID node_id, const std::function<void()>& function) const {
+  if (node_count() == 1 || current_thread_node == node_id) {
+    function();
+    return;
+  }
+
+  const auto previous_node = current_thread_node;
+  bind_current_thread_to_node(node_id);
+  try {
+    function();
+  } catch (...) {
+    _rebind_current_thread(previous_node);
+    throw;
+  }
+  _rebind_current_thread(previous_node);
+}
+
+void Topology::_rebind_current_thread(std::optional<NodeID> node_id) const {
+  if (node_id) {
+    bind_current_thread_to_node(*node_id);
+    return;
+  }
+
+#if HYRISE_NUMA_SUPPORT
+  numa_run_on_node(-1);
+#endif
+  current_thread_node = std::nullopt;
+}
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// The Topology describes the NUMA nodes of the machine and the number of CPUs of each node.
+// If the library was built without libnuma (see HYRISE_NUMA_SUPPORT) or the kernel does not support NUMA,
+// the machine is described as a single node containing all CPUs.
+class Topology : private Noncopyable {
+ public:
+  static const Topology& get();
+
+  size_t node_count() const;
+
+  // returns the number of CPUs that belong to the given node (at least 1)
+  size_t cpu_count(NodeID node_id) const;
+
+  // returns the node id the operating system uses for the given node, e.g., for libnuma calls
+  int numa_node_id(NodeID node_id) const;
+
+  // restricts the calling thread to the CPUs of the given node. Memory is allocated where it is first touched,
+  // so everything the thread allocates afterwards is placed on that node.
+  void bind_current_thread_to_node(NodeID node_id) const;
+
+  // returns the node the calling thread is bound to, or node 0 if it is not bound to any node
+  NodeID current_node() const;
+
+  // executes the function on the calling thread, which is bound to the given node until the function returns.
+  // Afterwards, the thread is bound to its previous node again, or to none if it was not bound before.
+  void run_on_node(NodeID node_id, const std::function<void()>& function) const;
+
+ protected:
+  Topology();
+
+  // binds the calling thread to the given node, or allows it to run on all nodes if node_id is empty
+  void _rebind_current_thread(std::optional<NodeID> node_id) const;
+
+  // the NodeIDs used by opossum are dense, the node ids of the operating system might not be
+  std::vector<int> _numa_node_ids;
+  std::vector<size_t> _cpu_counts;
+};
+
+}  // namespace opossum
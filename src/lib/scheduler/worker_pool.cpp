@@ -0,0 +1,67 @@
+#include "worker_pool.hpp"
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "topology.hpp"
+
+namespace opossum {
+
+WorkerPool::WorkerPool() {
+  const auto& topology = Topology::get();
+
+  for (NodeID node_id{0}; node_id < topology.node_count(); ++node_id) {
+    _queues.push_back(std::make_unique<NodeQueue>());
+  }
+
+  for (NodeID node_id{0}; node_id < topology.node_count(); ++node_id) {
+    for (size_t worker_id = 0; worker_id < topology.cpu_count(node_id); ++worker_id) {
+      _workers.emplace_back(&WorkerPool::_work, this, std::ref(*_queues[node_id]), node_id);
+    }
+  }
+}
+
+WorkerPool& WorkerPool::get() {
+  static WorkerPool instance;
+  return instance;
+}
+
+WorkerPool::~WorkerPool() {
+  for (auto& queue : _queues) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    queue->shutdown = true;
+    queue->job_available.notify_all();
+  }
+
+  for (auto& worker : _workers) worker.join();
+}
+
+void WorkerPool::submit(NodeID node_id, std::function<void()> job) {
+  auto& queue = *_queues.at(node_id);
+
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  queue.jobs.push_back(std::move(job));
+  queue.job_available.notify_one();
+}
+
+void WorkerPool::_work(NodeQueue& queue, NodeID node_id) {
+  Topology::get().bind_current_thread_to_node(node_id);
+
+  while (true) {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(queue.mutex);
+      queue.job_available.wait(lock, [&]() { return queue.shutdown || !queue.jobs.empty(); });
+      if (queue.jobs.empty()) return;
+
+      job = std::move(queue.jobs.front());
+      queue.jobs.pop_front();
+    }
+
+    job();
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// The WorkerPool owns one worker thread per CPU of every NUMA node. The workers are bound to their node for their
+// whole lifetime (see Topology), so that the memory they first touch is placed on that node. Jobs submitted for a node
+// are executed by its workers in the order of submission. The workers are started on first use and joined when the
+// process exits.
+class WorkerPool : private Noncopyable {
+ public:
+  static WorkerPool& get();
+
+  ~WorkerPool();
+
+  // queues the job for execution by one of the workers of the given node and returns immediately.
+  // Jobs must not throw and must not wait for jobs that were submitted after them.
+  void submit(NodeID node_id, std::function<void()> job);
+
+ protected:
+  WorkerPool();
+
+  struct NodeQueue {
+    std::mutex mutex;
+    std::condition_variable job_available;
+    std::deque<std::function<void()>> jobs;
+    bool shutdown = false;
+  };
+
+  void _work(NodeQueue& queue, NodeID node_id);
+
+  std::vector<std::unique_ptr<NodeQueue>> _queues;
+  std::vector<std::thread> _workers;
+};
+
+}  // namespace opossum
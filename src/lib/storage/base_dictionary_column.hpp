@@ -0,0 +1,40 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "base_column.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseAttributeVector;
+
+// Even though ValueIDs do not have to use the full width of ValueID (uint32_t), this will also work for smaller ValueID
+// types (uint8_t, uint16_t) since after a down-cast INVALID_VALUE_ID will look like their numeric_limit::max()
+constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
+
+// BaseDictionaryColumn is the type-independent interface of DictionaryColumn. It allows code that only works with
+// ValueIDs, such as the indexes, to handle dictionary columns of all types without resolving them.
+class BaseDictionaryColumn : public BaseColumn {
+ public:
+  // returns the first value ID that refers to a value >= the search value
+  // returns INVALID_VALUE_ID if all values are smaller than the search value
+  virtual ValueID lower_bound(const AllTypeVariant& value) const = 0;
+
+  // returns the first value ID that refers to a value > the search value
+  // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
+  virtual ValueID upper_bound(const AllTypeVariant& value) const = 0;
+
+  // returns the number of unique values (dictionary entries)
+  virtual size_t unique_values_count() const = 0;
+
+  // returns the ValueID that represents NULL in the attribute vector, which is the number of dictionary entries
+  virtual ValueID null_value_id() const = 0;
+
+  // returns the ValueIDs of the column's values
+  virtual std::shared_ptr<const BaseAttributeVector> attribute_vector() const = 0;
+};
+
+}  // namespace opossum
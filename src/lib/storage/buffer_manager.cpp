@@ -0,0 +1,357 @@
+#include "buffer_manager.hpp"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "chunk.hpp"
+#include "dictionary_column.hpp"
+#include "fitted_attribute_vector.hpp"
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Spill files contain the chunk's size and column count, followed by each column's type, dictionary, and attribute
+// vector. Values are written in their in-memory representation, spill files are not meant to be portable.
+
+template <typename T>
+void write_value(std::ofstream& file, const T& value) {
+  file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <>
+void write_value(std::ofstream& file, const std::string& value) {
+  write_value(file, value.size());
+  file.write(value.data(), value.size());
+}
+
+template <typename T>
+T read_value(std::ifstream& file) {
+  T value;
+  file.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return value;
+}
+
+template <>
+std::string read_value(std::ifstream& file) {
+  std::string value(read_value<size_t>(file), '\0');
+  file.read(&value[0], value.size());
+  return value;
+}
+
+template <typename T>
+void write_vector(std::ofstream& file, const pmr_vector<T>& values) {
+  write_value(file, values.size());
+  file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
+
+template <typename T>
+pmr_vector<T> read_vector(std::ifstream& file, const PolymorphicAllocator<T>& alloc) {
+  pmr_vector<T> values(read_value<size_t>(file), alloc);
+  file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
+  return values;
+}
+
+template <typename T>
+void write_dictionary(std::ofstream& file, const pmr_vector<T>& dictionary) {
+  write_vector(file, dictionary);
+}
+
+// string dictionaries are written as their buffers, which spares copying every string
+void write_dictionary(std::ofstream& file, const StringVector& dictionary) {
+  write_value(file, dictionary.layout());
+  write_value(file, dictionary.size());
+  write_value(file, dictionary.fixed_length());
+  write_vector(file, dictionary.chars());
+  write_vector(file, dictionary.offsets());
+}
+
+template <typename T>
+std::shared_ptr<const DictionaryVector<T>> read_dictionary(std::ifstream& file,
+                                                           const PolymorphicAllocator<size_t>& alloc) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto layout = read_value<StringVector::Layout>(file);
+    const auto size = read_value<size_t>(file);
+    const auto fixed_length = read_value<size_t>(file);
+    auto chars = read_vector<char>(file, alloc);
+    auto offsets = read_vector<StringVector::Offset>(file, alloc);
+    return std::make_shared<StringVector>(layout, size, fixed_length, std::move(chars), std::move(offsets));
+  } else {
+    return std::make_shared<pmr_vector<T>>(read_vector<T>(file, alloc));
+  }
+}
+
+template <typename uintX_t>
+void write_attribute_vector(std::ofstream& file, const BaseAttributeVector& attribute_vector) {
+  const auto fitted_attribute_vector = dynamic_cast<const FittedAttributeVector<uintX_t>*>(&attribute_vector);
+  Assert(fitted_attribute_vector, "Only FittedAttributeVectors can be spilled");
+
+  write_vector(file, fitted_attribute_vector->values());
+}
+
+template <typename uintX_t>
+std::shared_ptr<BaseAttributeVector> read_attribute_vector(std::ifstream& file,
+                                                           const PolymorphicAllocator<size_t>& alloc) {
+  return std::make_shared<FittedAttributeVector<uintX_t>>(read_vector<uintX_t>(file, alloc));
+}
+
+void write_column(std::ofstream& file, const std::string& type, const std::shared_ptr<BaseColumn>& base_column) {
+  write_value(file, type);
+
+  resolve_data_type(type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto column = std::dynamic_pointer_cast<DictionaryColumn<ColumnDataType>>(base_column);
+    Assert(static_cast<bool>(column), "Only chunks consisting of DictionaryColumns can be spilled");
+
+    write_dictionary(file, *column->dictionary());
+
+    const auto& attribute_vector = *column->attribute_vector();
+    write_value(file, attribute_vector.width());
+    switch (attribute_vector.width()) {
+      case 1:
+        write_attribute_vector<uint8_t>(file, attribute_vector);
+        break;
+      case 2:
+        write_attribute_vector<uint16_t>(file, attribute_vector);
+        break;
+      case 4:
+        write_attribute_vector<uint32_t>(file, attribute_vector);
+        break;
+      default:
+        Fail("Unsupported attribute vector width");
+    }
+  });
+}
+
+std::shared_ptr<BaseColumn> read_column(std::ifstream& file, const std::string& type,
+                                        const PolymorphicAllocator<size_t>& alloc) {
+  std::shared_ptr<BaseColumn> column;
+
+  resolve_data_type(type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto dictionary = read_dictionary<ColumnDataType>(file, alloc);
+
+    std::shared_ptr<BaseAttributeVector> attribute_vector;
+    switch (read_value<AttributeVectorWidth>(file)) {
+      case 1:
+        attribute_vector = read_attribute_vector<uint8_t>(file, alloc);
+        break;
+      case 2:
+        attribute_vector = read_attribute_vector<uint16_t>(file, alloc);
+        break;
+      case 4:
+        attribute_vector = read_attribute_vector<uint32_t>(file, alloc);
+        break;
+      default:
+        Fail("Unsupported attribute vector width");
+    }
+
+    column = std::make_shared<DictionaryColumn<ColumnDataType>>(std::move(dictionary), std::move(attribute_vector));
+  });
+
+  Assert(static_cast<bool>(column), "Unknown column type " + type);
+  return column;
+}
+
+}  // namespace
+
+BufferManager::BufferManager() {
+  const auto tmp_directory = std::getenv("TMPDIR");
+  _spill_directory = tmp_directory ? tmp_directory : "/tmp";
+}
+
+BufferManager& BufferManager::get() {
+  static BufferManager instance;
+  return instance;
+}
+
+void BufferManager::set_memory_budget(size_t memory_budget) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _memory_budget = memory_budget;
+  _evict();
+}
+
+size_t BufferManager::memory_budget() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _memory_budget;
+}
+
+size_t BufferManager::memory_usage() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  // do not count chunks whose tables have been dropped in the meantime
+  size_t memory_usage = 0;
+  for (const auto& tracked_chunk : _lru_list) {
+    if (!tracked_chunk.chunk.expired()) memory_usage += tracked_chunk.memory_usage;
+  }
+  return memory_usage;
+}
+
+uint64_t BufferManager::load_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _load_count;
+}
+
+void BufferManager::set_spill_directory(const std::string& spill_directory) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _spill_directory = spill_directory;
+}
+
+std::string BufferManager::spill_directory() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _spill_directory;
+}
+
+void BufferManager::register_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<std::string>& column_types) {
+  DebugAssert(column_types.size() == chunk->col_count(), "Number of column types does not match number of columns");
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _track(chunk, column_types);
+  _evict();
+}
+
+std::shared_ptr<Chunk> BufferManager::pin(const std::shared_ptr<Chunk>& chunk) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  auto lru_iterator = _lru_iterators.find(chunk);
+  if (lru_iterator != _lru_iterators.end()) {
+    _lru_list.splice(_lru_list.begin(), _lru_list, lru_iterator->second);
+  } else if (chunk->is_spilled()) {
+    _track(chunk, _load(*chunk));
+    ++_load_count;
+    lru_iterator = _lru_iterators.find(chunk);
+  } else {
+    return chunk;
+  }
+
+  // the chunk is pinned before other chunks are spilled to make room for it
+  ++lru_iterator->second->pin_count;
+  _evict();
+
+  // the handle owns a reference to the chunk and unpins it once its last copy is gone
+  return std::shared_ptr<Chunk>(chunk.get(), [chunk](Chunk*) { BufferManager::get()._unpin(chunk); });
+}
+
+void BufferManager::reset() {
+  auto& buffer_manager = get();
+  std::lock_guard<std::mutex> lock(buffer_manager._mutex);
+
+  buffer_manager._lru_list.clear();
+  buffer_manager._lru_iterators.clear();
+  buffer_manager._memory_usage = 0;
+  buffer_manager._memory_budget = 0;
+  buffer_manager._load_count = 0;
+
+  const auto tmp_directory = std::getenv("TMPDIR");
+  buffer_manager._spill_directory = tmp_directory ? tmp_directory : "/tmp";
+}
+
+void BufferManager::_track(const std::shared_ptr<Chunk>& chunk, const std::vector<std::string>& column_types) {
+  auto pin_count = size_t{0};
+  const auto lru_iterator = _lru_iterators.find(chunk);
+  if (lru_iterator != _lru_iterators.end()) {
+    pin_count = lru_iterator->second->pin_count;
+    _memory_usage -= lru_iterator->second->memory_usage;
+    _lru_list.erase(lru_iterator->second);
+    _lru_iterators.erase(lru_iterator);
+  }
+
+  _lru_list.push_front(TrackedChunk{chunk, column_types, chunk->estimate_memory_usage(), pin_count});
+  _lru_iterators.emplace(chunk, _lru_list.begin());
+  _memory_usage += _lru_list.front().memory_usage;
+}
+
+void BufferManager::_unpin(const std::shared_ptr<Chunk>& chunk) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  // the chunk is not tracked anymore if the BufferManager has been reset in the meantime
+  const auto lru_iterator = _lru_iterators.find(chunk);
+  if (lru_iterator == _lru_iterators.end()) return;
+
+  --lru_iterator->second->pin_count;
+  _evict();
+}
+
+void BufferManager::_evict() {
+  if (_memory_budget == 0 || _memory_usage <= _memory_budget) return;
+
+  // least recently used chunks first
+  for (auto it = _lru_list.end(); it != _lru_list.begin() && _memory_usage > _memory_budget;) {
+    --it;
+    if (it->pin_count > 0) continue;
+
+    // chunks that have been deleted are forgotten without spilling them
+    const auto chunk = it->chunk.lock();
+    if (chunk) _spill(*chunk, it->column_types);
+
+    _memory_usage -= it->memory_usage;
+    _lru_iterators.erase(it->chunk);
+    it = _lru_list.erase(it);
+  }
+}
+
+void BufferManager::_spill(Chunk& chunk, const std::vector<std::string>& column_types) {
+  const auto file_name = _spill_directory + "/opossum_chunk_" + std::to_string(::getpid()) + "_" +
+                         std::to_string(_next_spill_file_id++) + ".bin";
+
+  std::ofstream file(file_name, std::ios::binary);
+  Assert(file.is_open(), "BufferManager: Could not create spill file " + file_name);
+
+  write_value(file, chunk.size());
+  write_value(file, chunk.col_count());
+  for (ColumnID column_id{0}; column_id < chunk.col_count(); ++column_id) {
+    write_column(file, column_types[column_id], std::atomic_load(&chunk._columns[column_id]));
+  }
+
+  file.close();
+  Assert(!file.fail(), "BufferManager: Could not write spill file " + file_name);
+
+  // operators that still hold on to a column keep it in memory until they release it
+  chunk._spill_file_name = file_name;
+  for (auto& column : chunk._columns) {
+    std::atomic_store(&column, std::shared_ptr<BaseColumn>{});
+  }
+}
+
+std::vector<std::string> BufferManager::_load(Chunk& chunk) {
+  std::ifstream file(chunk._spill_file_name, std::ios::binary);
+  Assert(file.is_open(), "BufferManager: Could not open spill file " + chunk._spill_file_name);
+
+  read_value<uint32_t>(file);
+  const auto col_count = read_value<uint16_t>(file);
+  DebugAssert(col_count == chunk._columns.size(), "Spill file does not match chunk");
+
+  std::vector<std::string> column_types(col_count);
+  std::vector<std::shared_ptr<BaseColumn>> columns(col_count);
+  for (ColumnID column_id{0}; column_id < col_count; ++column_id) {
+    column_types[column_id] = read_value<std::string>(file);
+    columns[column_id] = read_column(file, column_types[column_id], chunk.get_allocator());
+  }
+
+  Assert(!file.fail(), "BufferManager: Could not read spill file " + chunk._spill_file_name);
+  file.close();
+
+  // is_spilled looks at the first column, which is therefore published last
+  for (auto column_id = col_count; column_id-- > 0;) {
+    std::atomic_store(&chunk._columns[column_id], std::move(columns[column_id]));
+  }
+
+  std::remove(chunk._spill_file_name.c_str());
+  chunk._spill_file_name.clear();
+
+  return column_types;
+}
+
+}  // namespace opossum
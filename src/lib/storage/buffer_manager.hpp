@@ -0,0 +1,94 @@
+#pragma once
+
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+// The BufferManager is a singleton that keeps the memory consumed by immutable (i.e., compressed) chunks below a
+// configurable budget. Once the budget is exceeded, the least recently accessed chunks are spilled to files in the
+// spill directory and their columns are released. Table::get_chunk transparently loads spilled chunks back into memory.
+//
+// Mutable chunks are neither tracked nor spilled, so the budget only covers the compressed part of the data.
+// Chunks are pinned while they are in use: Table::get_chunk returns a handle that keeps the chunk in memory until it
+// and all its copies are destroyed. Pinned chunks are skipped when chunks are spilled, so the budget may be exceeded
+// as long as more chunks are pinned than fit into it.
+class BufferManager : private Noncopyable {
+ public:
+  static BufferManager& get();
+
+  // sets the number of bytes that tracked chunks may occupy. 0 (default) means unlimited
+  void set_memory_budget(size_t memory_budget);
+  size_t memory_budget() const;
+
+  // returns the number of bytes currently occupied by tracked chunks that are not spilled
+  size_t memory_usage() const;
+
+  // returns the number of times a spilled chunk was loaded since the last reset
+  uint64_t load_count() const;
+
+  // sets the directory spill files are written to, defaults to $TMPDIR or /tmp
+  void set_spill_directory(const std::string& spill_directory);
+  std::string spill_directory() const;
+
+  // Starts tracking an immutable chunk whose columns are all DictionaryColumns of the given types.
+  // This might spill other chunks (or the chunk itself) if the budget is exceeded. Chunks have to be registered before
+  // they are added to a table, so that every handle returned by pin is accounted for.
+  void register_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<std::string>& column_types);
+
+  // Loads the chunk from disk if it was spilled, marks it as the most recently used one, and returns a handle that
+  // pins it: the chunk is not spilled until the handle and all its copies are destroyed. Untracked chunks are returned
+  // as they are.
+  std::shared_ptr<Chunk> pin(const std::shared_ptr<Chunk>& chunk);
+
+  // stops tracking all chunks and resets the configuration. Chunks that are currently spilled stay on disk until
+  // they are accessed again.
+  static void reset();
+
+  BufferManager(BufferManager&&) = delete;
+
+ protected:
+  struct TrackedChunk {
+    std::weak_ptr<Chunk> chunk;
+    std::vector<std::string> column_types;
+    size_t memory_usage;
+    // the number of handles returned by pin that are alive
+    size_t pin_count;
+  };
+
+  BufferManager();
+
+  // adds the chunk as most recently used chunk, requires _mutex to be locked
+  void _track(const std::shared_ptr<Chunk>& chunk, const std::vector<std::string>& column_types);
+
+  // called once the last copy of a handle returned by pin is destroyed
+  void _unpin(const std::shared_ptr<Chunk>& chunk);
+
+  // spills the least recently used chunks that are not pinned until the budget is met, requires _mutex to be locked
+  void _evict();
+
+  void _spill(Chunk& chunk, const std::vector<std::string>& column_types);
+  std::vector<std::string> _load(Chunk& chunk);
+
+  size_t _memory_budget = 0;
+  size_t _memory_usage = 0;
+  std::string _spill_directory;
+  uint64_t _next_spill_file_id = 0;
+  uint64_t _load_count = 0;
+
+  // most recently used chunk first
+  std::list<TrackedChunk> _lru_list;
+  std::map<std::weak_ptr<Chunk>, std::list<TrackedChunk>::iterator, std::owner_less<std::weak_ptr<Chunk>>>
+      _lru_iterators;
+
+  mutable std::mutex _mutex;
+};
+}  // namespace opossum
@@ -1,3 +1,4 @@
+#include <cstdio>
 #include <iomanip>
 #include <iterator>
 #include <limits>
@@ -9,32 +10,135 @@
 
 #include "base_column.hpp"
 #include "chunk.hpp"
+#include "index/base_index.hpp"
 
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+Chunk::MvccColumns::MvccColumns(const size_t capacity)
+    : tids(capacity), begin_cids(capacity), end_cids(capacity) {
+  for (size_t chunk_offset = 0; chunk_offset < capacity; ++chunk_offset) {
+    tids[chunk_offset] = INVALID_TRANSACTION_ID;
+    begin_cids[chunk_offset] = MAX_COMMIT_ID;
+    end_cids[chunk_offset] = MAX_COMMIT_ID;
+  }
+}
+
+size_t Chunk::MvccColumns::capacity() const { return tids.size(); }
+
+Chunk::Chunk(NodeID numa_node, const PolymorphicAllocator<size_t>& alloc) : _numa_node(numa_node), _alloc(alloc) {}
+
+Chunk::Chunk(Chunk&& other) noexcept
+    : _columns(std::move(other._columns)),
+      _size(other._size.load()),
+      _numa_node(other._numa_node),
+      _alloc(other._alloc),
+      _indices(std::move(other._indices)),
+      _mvcc_columns(std::move(other._mvcc_columns)),
+      _spill_file_name(std::exchange(other._spill_file_name, std::string{})) {}
+
+Chunk& Chunk::operator=(Chunk&& other) noexcept {
+  if (!_spill_file_name.empty()) std::remove(_spill_file_name.c_str());
+
+  _columns = std::move(other._columns);
+  _size = other._size.load();
+  _numa_node = other._numa_node;
+  _alloc = other._alloc;
+  _indices = std::move(other._indices);
+  _mvcc_columns = std::move(other._mvcc_columns);
+  _spill_file_name = std::exchange(other._spill_file_name, std::string{});
+  return *this;
+}
+
+Chunk::~Chunk() {
+  if (!_spill_file_name.empty()) std::remove(_spill_file_name.c_str());
+}
+
 void Chunk::add_column(std::shared_ptr<BaseColumn> column) {
-  // Implementation goes here
+  if (_columns.empty()) {
+    _size = static_cast<uint32_t>(column->size());
+  } else {
+    DebugAssert(column->size() == _size, "All columns of a chunk need to have the same size");
+  }
+  _columns.push_back(column);
 }
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
-  // Implementation goes here
+  DebugAssert(values.size() == _columns.size(), "Number of values does not match number of columns");
+
+  for (size_t column_id = 0; column_id < _columns.size(); ++column_id) {
+    _columns[column_id]->append(values[column_id]);
+  }
+
+  // the row becomes visible to readers only once all of its values have been written
+  _size.store(_size.load(std::memory_order_relaxed) + 1, std::memory_order_release);
 }
 
 std::shared_ptr<BaseColumn> Chunk::get_column(ColumnID column_id) const {
-  // Implementation goes here
-  return nullptr;
+  const auto column = std::atomic_load(&_columns.at(column_id));
+  DebugAssert(column, "Chunk is spilled to disk, it has to be pinned through Table::get_chunk");
+  return column;
+}
+
+std::shared_ptr<BaseColumn> Chunk::get_column_if_loaded(ColumnID column_id) const {
+  return std::atomic_load(&_columns.at(column_id));
 }
 
-uint16_t Chunk::col_count() const {
-  // Implementation goes here
-  return 0;
+uint16_t Chunk::col_count() const { return static_cast<uint16_t>(_columns.size()); }
+
+uint32_t Chunk::size() const { return _size.load(std::memory_order_acquire); }
+
+size_t Chunk::estimate_memory_usage() const {
+  size_t memory_usage = 0;
+  for (const auto& column : _columns) {
+    const auto loaded_column = std::atomic_load(&column);
+    if (loaded_column) memory_usage += loaded_column->estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+bool Chunk::is_spilled() const { return !_columns.empty() && !std::atomic_load(&_columns.front()); }
+
+NodeID Chunk::numa_node() const { return _numa_node; }
+
+const PolymorphicAllocator<size_t>& Chunk::get_allocator() const { return _alloc; }
+
+bool Chunk::has_mvcc_columns() const { return static_cast<bool>(_mvcc_columns); }
+
+std::shared_ptr<Chunk::MvccColumns> Chunk::mvcc_columns() const {
+  DebugAssert(has_mvcc_columns(), "Chunk has no MVCC columns");
+  return _mvcc_columns;
+}
+
+void Chunk::set_mvcc_columns(std::shared_ptr<MvccColumns> mvcc_columns) { _mvcc_columns = std::move(mvcc_columns); }
+
+uint32_t Chunk::invalid_row_count() const { return _mvcc_columns ? _mvcc_columns->invalid_row_count.load() : 0u; }
+
+bool Chunk::is_fully_invalidated(const CommitID snapshot_commit_id) const {
+  if (!_mvcc_columns) return false;
+
+  // rows that are appended in the meantime are not committed yet and thus also invisible
+  const auto row_count = size();
+  return row_count > 0 && _mvcc_columns->invalid_row_count >= row_count &&
+         _mvcc_columns->max_end_cid <= snapshot_commit_id;
+}
+
+std::shared_ptr<const BaseIndex> Chunk::get_index(const ColumnIndexType index_type,
+                                                  const std::vector<ColumnID>& column_ids) const {
+  for (const auto& indexed_columns_and_index : _indices) {
+    const auto& index = indexed_columns_and_index.second;
+    if (indexed_columns_and_index.first == column_ids && index->type() == index_type) return index;
+  }
+  return nullptr;
 }
 
-uint32_t Chunk::size() const {
-  // Implementation goes here
-  return 0;
+std::vector<std::shared_ptr<const BaseIndex>> Chunk::get_indices(const std::vector<ColumnID>& column_ids) const {
+  auto indices = std::vector<std::shared_ptr<const BaseIndex>>{};
+  for (const auto& indexed_columns_and_index : _indices) {
+    if (indexed_columns_and_index.first == column_ids) indices.emplace_back(indexed_columns_and_index.second);
+  }
+  return indices;
 }
 
 }  // namespace opossum
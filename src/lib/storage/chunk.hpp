@@ -6,6 +6,7 @@
 #include <atomic>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
@@ -15,6 +16,7 @@ namespace opossum {
 
 class BaseIndex;
 class BaseColumn;
+enum class ColumnIndexType;
 
 // A chunk is a horizontal partition of a table.
 // It stores the data column by column.
@@ -22,12 +24,39 @@ class BaseColumn;
 // Find more information about this in our wiki: https://github.com/hyrise/zweirise/wiki/chunk-concept
 class Chunk : private Noncopyable {
  public:
+  // Multi-version concurrency control (MVCC) information of the rows of a chunk that belongs to an MVCC table (see
+  // TransactionContext and Validate). The columns are allocated for a fixed number of rows, so that they can be read
+  // while rows are appended to the chunk.
+  struct MvccColumns : private Noncopyable {
+    // creates the columns for up to capacity rows, none of which is visible yet
+    explicit MvccColumns(size_t capacity);
+
+    size_t capacity() const;
+
+    // the transaction that currently inserts or deletes the row, INVALID_TRANSACTION_ID if there is none
+    std::vector<std::atomic<TransactionID>> tids;
+    // the commit from which on the row is visible, MAX_COMMIT_ID as long as it has not been committed
+    std::vector<std::atomic<CommitID>> begin_cids;
+    // the commit from which on the row is deleted, MAX_COMMIT_ID as long as it has not been deleted
+    std::vector<std::atomic<CommitID>> end_cids;
+
+    // The number of invalid rows, i.e., rows whose deletion was committed or whose insertion was rolled back. Together
+    // with max_end_cid, it tells whether a chunk can be skipped without looking at its rows.
+    std::atomic<uint32_t> invalid_row_count{0};
+    // the highest CommitID of a deletion, 0 if no row has been deleted
+    std::atomic<CommitID> max_end_cid{0};
+  };
+
   Chunk() = default;
+  ~Chunk();
+
+  // creates a chunk whose columns are meant to be placed on the given NUMA node (see Table::create_new_chunk)
+  // and are allocated using alloc
+  explicit Chunk(NodeID numa_node, const PolymorphicAllocator<size_t>& alloc = {});
 
-  // we need to explicitly set the move constructor to default when
-  // we overwrite the copy constructor
-  Chunk(Chunk&&) = default;
-  Chunk& operator=(Chunk&&) = default;
+  // chunks are moved before they are added to a table, i.e., before they can be read concurrently
+  Chunk(Chunk&& other) noexcept;
+  Chunk& operator=(Chunk&& other) noexcept;
 
   // adds a column to the "right" of the chunk
   void add_column(std::shared_ptr<BaseColumn> column);
@@ -35,18 +64,86 @@ class Chunk : private Noncopyable {
   // returns the number of columns (cannot exceed ColumnID (uint16_t))
   uint16_t col_count() const;
 
-  // returns the number of rows (cannot exceed ChunkOffset (uint32_t))
+  // Returns the number of rows (cannot exceed ChunkOffset (uint32_t)). The count is kept by the chunk instead of being
+  // taken from the columns, which the BufferManager releases while the chunk is spilled.
   uint32_t size() const;
 
   // adds a new row, given as a list of values, to the chunk
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
-  // Returns the column at a given position
+  // Returns the column at a given position. The chunk has to be pinned (see Table::get_chunk), as the columns of
+  // spilled chunks are not in memory.
   std::shared_ptr<BaseColumn> get_column(ColumnID column_id) const;
 
+  // returns the column at a given position, or nullptr if the chunk is spilled. The chunk does not have to be pinned.
+  std::shared_ptr<BaseColumn> get_column_if_loaded(ColumnID column_id) const;
+
+  // returns an estimate of the number of bytes occupied by the chunk's columns (0 while the chunk is spilled)
+  size_t estimate_memory_usage() const;
+
+  // returns whether the BufferManager has spilled the chunk's columns to disk.
+  // Table::get_chunk transparently loads spilled chunks and pins them, so operators never see a spilled chunk.
+  bool is_spilled() const;
+
+  // returns the NUMA node the chunk's columns are placed on. Tasks working on the chunk should run on that node
+  // (see ChunkScheduler).
+  NodeID numa_node() const;
+
+  // returns the allocator that the chunk's columns use
+  const PolymorphicAllocator<size_t>& get_allocator() const;
+
+  // returns whether the chunk has MVCC columns, which is the case for the chunks of MVCC tables
+  bool has_mvcc_columns() const;
+
+  // Returns the MVCC columns. They are kept in memory while the chunk is spilled and are shared with the chunk that
+  // replaces it when it is compressed.
+  std::shared_ptr<MvccColumns> mvcc_columns() const;
+  void set_mvcc_columns(std::shared_ptr<MvccColumns> mvcc_columns);
+
+  // returns the number of invalid rows (see MvccColumns::invalid_row_count), 0 for chunks without MVCC columns
+  uint32_t invalid_row_count() const;
+
+  // Returns whether all rows are invisible to transactions whose snapshot is snapshot_commit_id, because they were
+  // deleted before it or never committed. Operators that are executed in such a transaction skip the chunk.
+  bool is_fully_invalidated(CommitID snapshot_commit_id) const;
+
+  // Creates an index of type Index (e.g., GroupKeyIndex) over the given columns and adds it to the chunk. The index
+  // refers to the current columns and keeps them alive, so it has to be recreated if the columns are replaced, e.g.,
+  // by compress_chunk. Like append, this is not thread-safe.
+  template <typename Index>
+  std::shared_ptr<Index> create_index(const std::vector<ColumnID>& column_ids) {
+    auto index_columns = std::vector<std::shared_ptr<const BaseColumn>>{};
+    for (const auto& column_id : column_ids) {
+      index_columns.emplace_back(get_column(column_id));
+    }
+
+    auto index = std::make_shared<Index>(index_columns);
+    _indices.emplace_back(column_ids, index);
+    return index;
+  }
+
+  // returns the index of the given type over exactly these columns (in this order), or nullptr if there is none
+  std::shared_ptr<const BaseIndex> get_index(ColumnIndexType index_type, const std::vector<ColumnID>& column_ids) const;
+
+  // returns all indexes over exactly these columns (in this order)
+  std::vector<std::shared_ptr<const BaseIndex>> get_indices(const std::vector<ColumnID>& column_ids) const;
+
  protected:
-  // Implementation goes here
+  friend class BufferManager;
+
+  // The columns are read and replaced with std::atomic_load and std::atomic_store, as the BufferManager spills and
+  // loads them while the chunk's size or memory usage is read by other threads. They are nullptr while the chunk is
+  // spilled.
+  std::vector<std::shared_ptr<BaseColumn>> _columns;
+  std::atomic<uint32_t> _size{0};
+  NodeID _numa_node = 0;
+  PolymorphicAllocator<size_t> _alloc;
+  std::vector<std::pair<std::vector<ColumnID>, std::shared_ptr<BaseIndex>>> _indices;
+  std::shared_ptr<MvccColumns> _mvcc_columns;
+
+  // only set while the chunk is spilled, guarded by the BufferManager's mutex
+  std::string _spill_file_name;
 };
 
 }  // namespace opossum
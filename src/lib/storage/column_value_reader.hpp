@@ -0,0 +1,131 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "dictionary_column.hpp"
+#include "reference_column.hpp"
+#include "table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+// type-independent base of ColumnValueReader, so that readers can be kept without knowing the column type
+class BaseColumnValueReader {
+ public:
+  virtual ~BaseColumnValueReader() = default;
+
+  // drops the column of the chunk that the reader looked up, so that the reader does not keep it alive
+  virtual void release(ChunkID chunk_id) = 0;
+};
+
+// Reads the typed values of a column, following ReferenceColumns to the columns they reference. Columns are looked
+// up once per chunk, because Table::get_chunk has to consult the BufferManager. Setting up a reader is linear in the
+// number of chunks, so readers should be reused, e.g., one per worker or per execution of an operator (see
+// ColumnValueReaderCache). Chunks that are added to the table afterwards (e.g., by a Pipeline or by appends to an MVCC
+// table) are looked up once they are read. Not thread-safe, operators that read in parallel should use one reader per
+// worker.
+template <typename T>
+class ColumnValueReader : public BaseColumnValueReader {
+ public:
+  ColumnValueReader(const Table& table, const ColumnID column_id)
+      : _table(table), _column_id(column_id), _columns(table.chunk_count()) {}
+
+  // returns the value of the row, which must not be NULL
+  T get(const RowID& row_id) {
+    const auto& column = _resolve(row_id.chunk_id);
+    if (column.value_column) return column.value_column->values()[row_id.chunk_offset];
+    if (column.dictionary_column) return column.dictionary_column->get(row_id.chunk_offset);
+    return column.referenced_reader->get((*column.reference_column->pos_list())[row_id.chunk_offset]);
+  }
+
+  bool is_null(const RowID& row_id) {
+    const auto& column = _resolve(row_id.chunk_id);
+    if (column.value_column) return column.value_column->is_null(row_id.chunk_offset);
+    if (column.dictionary_column) return column.dictionary_column->is_null(row_id.chunk_offset);
+    return column.referenced_reader->is_null((*column.reference_column->pos_list())[row_id.chunk_offset]);
+  }
+
+  // returns the DictionaryColumn of the given chunk, or nullptr if the chunk holds a different kind of column
+  const DictionaryColumn<T>* dictionary_column(const ChunkID chunk_id) { return _resolve(chunk_id).dictionary_column; }
+
+  void release(const ChunkID chunk_id) override {
+    if (chunk_id.t < _columns.size()) _columns[chunk_id] = ResolvedColumn{};
+  }
+
+ protected:
+  struct ResolvedColumn {
+    std::shared_ptr<const BaseColumn> column;
+    const ValueColumn<T>* value_column = nullptr;
+    const DictionaryColumn<T>* dictionary_column = nullptr;
+    const ReferenceColumn* reference_column = nullptr;
+    ColumnValueReader* referenced_reader = nullptr;
+  };
+
+  const ResolvedColumn& _resolve(const ChunkID chunk_id) {
+    if (chunk_id.t >= _columns.size()) _columns.resize(chunk_id.t + 1);
+    auto& resolved_column = _columns[chunk_id];
+    if (resolved_column.column) return resolved_column;
+
+    resolved_column.column = _table.get_chunk(chunk_id)->get_column(_column_id);
+    resolved_column.value_column = dynamic_cast<const ValueColumn<T>*>(resolved_column.column.get());
+    resolved_column.dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(resolved_column.column.get());
+    resolved_column.reference_column = dynamic_cast<const ReferenceColumn*>(resolved_column.column.get());
+
+    if (resolved_column.reference_column) {
+      const auto key = std::make_pair(resolved_column.reference_column->referenced_table().get(),
+                                      resolved_column.reference_column->referenced_column_id());
+      auto& referenced_reader = _referenced_readers[key];
+      if (!referenced_reader) {
+        referenced_reader = std::make_unique<ColumnValueReader>(*key.first, key.second);
+      }
+      resolved_column.referenced_reader = referenced_reader.get();
+    }
+
+    DebugAssert(resolved_column.value_column || resolved_column.dictionary_column || resolved_column.reference_column,
+                "Column type does not match the table's column definition");
+    return resolved_column;
+  }
+
+  const Table& _table;
+  const ColumnID _column_id;
+  std::vector<ResolvedColumn> _columns;
+  std::map<std::pair<const Table*, ColumnID>, std::unique_ptr<ColumnValueReader>> _referenced_readers;
+};
+
+// Keeps the reader of one column for operators that process a table chunk by chunk (e.g., TableScan). A new reader is
+// set up when a different table or column is read. As the cache only observes the table, it does not keep the table
+// alive and cannot mistake a new table for a destroyed one. Each chunk is read once, so the reader drops the column of
+// the previously read chunk whenever it is handed out. This lets a Pipeline free its intermediate chunks, and chunks
+// that the table replaced in the meantime are looked up anew (see Pipeline).
+class ColumnValueReaderCache {
+ public:
+  // returns the reader for reading the chunk chunk_id of the table
+  template <typename T>
+  ColumnValueReader<T>& get(const std::shared_ptr<const Table>& table, const ColumnID column_id,
+                            const ChunkID chunk_id) {
+    if (!_reader || _table.lock() != table || _column_id != column_id) {
+      _reader = std::make_unique<ColumnValueReader<T>>(*table, column_id);
+      _table = table;
+      _column_id = column_id;
+    } else {
+      _reader->release(_chunk_id);
+    }
+    _chunk_id = chunk_id;
+
+    DebugAssert(dynamic_cast<ColumnValueReader<T>*>(_reader.get()), "Column type does not match the cached reader");
+    return static_cast<ColumnValueReader<T>&>(*_reader);
+  }
+
+ protected:
+  std::weak_ptr<const Table> _table;
+  ColumnID _column_id{0};
+  ChunkID _chunk_id{0};
+  std::unique_ptr<BaseColumnValueReader> _reader;
+};
+
+}  // namespace opossum
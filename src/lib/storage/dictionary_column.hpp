@@ -1,75 +1,182 @@
 #pragma once
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "base_attribute_vector.hpp"
+#include "base_dictionary_column.hpp"
+#include "fitted_attribute_vector.hpp"
+#include "string_vector.hpp"
+#include "type_cast.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+#include "value_column.hpp"
 
 namespace opossum {
 
-class BaseAttributeVector;
-class BaseColumn;
-
-// Even though ValueIDs do not have to use the full width of ValueID (uint32_t), this will also work for smaller ValueID
-// types (uint8_t, uint16_t) since after a down-cast INVALID_VALUE_ID will look like their numeric_limit::max()
-constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
+// the type of the dictionary of a DictionaryColumn<T>. Strings are kept in one contiguous buffer, which is
+// front-coded if they share long prefixes (see StringVector).
+template <typename T>
+using DictionaryVector = std::conditional_t<std::is_same_v<T, std::string>, StringVector, pmr_vector<T>>;
 
 // Dictionary is a specific column type that stores all its values in a vector
+// NULL values are not part of the dictionary. They are represented by null_value_id(), the ValueID behind the last
+// dictionary entry.
 template <typename T>
-class DictionaryColumn : public BaseColumn {
+class DictionaryColumn : public BaseDictionaryColumn {
  public:
   /**
    * Creates a Dictionary column from a given value column.
+   * The dictionary and the attribute vector are allocated using alloc.
    */
-  explicit DictionaryColumn(const std::shared_ptr<BaseColumn>& base_column);
+  explicit DictionaryColumn(const std::shared_ptr<BaseColumn>& base_column,
+                            const PolymorphicAllocator<size_t>& alloc = {}) {
+    const auto value_column = std::dynamic_pointer_cast<ValueColumn<T>>(base_column);
+    Assert(static_cast<bool>(value_column), "DictionaryColumn can only be created from a ValueColumn of the same type");
+
+    const auto& values = value_column->values();
+
+    if constexpr (std::is_same_v<T, std::string>) {
+      // sort views of the strings, so that only the distinct strings are copied into the dictionary's buffer
+      std::vector<std::string_view> distinct_values;
+      distinct_values.reserve(values.size());
+      for (size_t i = 0; i < values.size(); ++i) {
+        if (!value_column->is_null(i)) distinct_values.emplace_back(values[i]);
+      }
+      std::sort(distinct_values.begin(), distinct_values.end());
+      distinct_values.erase(std::unique(distinct_values.begin(), distinct_values.end()), distinct_values.end());
+      _dictionary = std::make_shared<StringVector>(distinct_values.cbegin(), distinct_values.cend(), alloc);
+    } else {
+      auto dictionary = std::make_shared<pmr_vector<T>>(alloc);
+      dictionary->reserve(values.size());
+      for (size_t i = 0; i < values.size(); ++i) {
+        if (!value_column->is_null(i)) dictionary->push_back(values[i]);
+      }
+      std::sort(dictionary->begin(), dictionary->end());
+      dictionary->erase(std::unique(dictionary->begin(), dictionary->end()), dictionary->end());
+      dictionary->shrink_to_fit();
+      _dictionary = std::move(dictionary);
+    }
+
+    // the attribute vector has to be able to hold the null ValueID as well
+    _attribute_vector = _create_attribute_vector(_dictionary->size(), values.size(), alloc);
+    for (size_t i = 0; i < values.size(); ++i) {
+      _attribute_vector->set(i, value_column->is_null(i) ? null_value_id() : lower_bound(values[i]));
+    }
+  }
 
-  // SEMINAR INFORMATION: Since most of these methods depend on the template parameter, you will have to implement
-  // the DictionaryColumn in this file. Replace the method signatures with actual implementations.
+  /**
+   * Creates a Dictionary column from an already sorted and deduplicated dictionary and a matching attribute vector,
+   * e.g., when reading a column back from disk. The dictionary may be shared with other columns (see Materialize) and
+   * may contain values that the attribute vector does not reference.
+   */
+  DictionaryColumn(std::shared_ptr<const DictionaryVector<T>> dictionary,
+                   std::shared_ptr<BaseAttributeVector> attribute_vector)
+      : _dictionary(std::move(dictionary)), _attribute_vector(std::move(attribute_vector)) {}
 
   // return the value at a certain position. If you want to write efficient operators, back off!
-  const AllTypeVariant operator[](const size_t i) const override;
+  const AllTypeVariant operator[](const size_t i) const override {
+    PerformanceWarning("operator[] used");
+
+    if (is_null(i)) return NULL_VALUE;
+    return get(i);
+  }
 
-  // return the value at a certain position.
-  const T get(const size_t i) const;
+  // return the value at a certain position. The position must not hold NULL.
+  const T get(const size_t i) const { return T((*_dictionary)[_attribute_vector->get(i)]); }
+
+  // returns whether the value at a certain position is NULL
+  bool is_null(const size_t i) const { return _attribute_vector->get(i) == null_value_id(); }
+
+  ValueID null_value_id() const override { return ValueID{static_cast<ValueID::base_type>(_dictionary->size())}; }
 
   // dictionary columns are immutable
-  void append(const AllTypeVariant&) override;
+  void append(const AllTypeVariant&) override { throw std::logic_error("DictionaryColumn is immutable"); }
 
   // returns an underlying dictionary
-  std::shared_ptr<const std::vector<T>> dictionary() const;
+  std::shared_ptr<const DictionaryVector<T>> dictionary() const { return _dictionary; }
 
   // returns an underlying data structure
-  std::shared_ptr<const BaseAttributeVector> attribute_vector() const;
+  std::shared_ptr<const BaseAttributeVector> attribute_vector() const override { return _attribute_vector; }
 
   // return the value represented by a given ValueID
-  const T& value_by_value_id(ValueID value_id) const;
+  const T value_by_value_id(ValueID value_id) const { return T(_dictionary->at(value_id)); }
 
   // returns the first value ID that refers to a value >= the search value
   // returns INVALID_VALUE_ID if all values are smaller than the search value
-  ValueID lower_bound(T value) const;
-
-  // same as lower_bound(T), but accepts an AllTypeVariant
-  ValueID lower_bound(const AllTypeVariant& value) const;
+  ValueID lower_bound(const T& value) const {
+    if constexpr (std::is_same_v<T, std::string>) {
+      return _to_value_id(_dictionary->lower_bound(value));
+    } else {
+      return _to_value_id(std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), value) - _dictionary->cbegin());
+    }
+  }
+
+  // same as lower_bound(T), but accepts an AllTypeVariant, which must not be NULL
+  ValueID lower_bound(const AllTypeVariant& value) const override {
+    DebugAssert(!variant_is_null(value), "NULL has no position in the dictionary");
+    return lower_bound(type_cast<T>(value));
+  }
 
   // returns the first value ID that refers to a value > the search value
   // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
-  ValueID upper_bound(T value) const;
-
-  // same as upper_bound(T), but accepts an AllTypeVariant
-  ValueID upper_bound(const AllTypeVariant& value) const;
+  ValueID upper_bound(const T& value) const {
+    if constexpr (std::is_same_v<T, std::string>) {
+      return _to_value_id(_dictionary->upper_bound(value));
+    } else {
+      return _to_value_id(std::upper_bound(_dictionary->cbegin(), _dictionary->cend(), value) - _dictionary->cbegin());
+    }
+  }
+
+  // same as upper_bound(T), but accepts an AllTypeVariant, which must not be NULL
+  ValueID upper_bound(const AllTypeVariant& value) const override {
+    DebugAssert(!variant_is_null(value), "NULL has no position in the dictionary");
+    return upper_bound(type_cast<T>(value));
+  }
 
   // return the number of unique_values (dictionary entries)
-  size_t unique_values_count() const;
+  size_t unique_values_count() const override { return _dictionary->size(); }
 
   // return the number of entries
-  size_t size() const override;
+  size_t size() const override { return _attribute_vector->size(); }
+
+  size_t estimate_memory_usage() const override {
+    const auto attribute_vector_usage = _attribute_vector->size() * _attribute_vector->width();
+    if constexpr (std::is_same_v<T, std::string>) {
+      return sizeof(*this) + _dictionary->estimate_memory_usage() + attribute_vector_usage;
+    } else {
+      return sizeof(*this) + _dictionary->capacity() * sizeof(T) + attribute_vector_usage;
+    }
+  }
 
  protected:
-  std::shared_ptr<std::vector<T>> _dictionary;
+  // converts a position in the dictionary, where size() means behind the last entry, into a ValueID
+  ValueID _to_value_id(const size_t position) const {
+    if (position == _dictionary->size()) return INVALID_VALUE_ID;
+    return ValueID{static_cast<ValueID::base_type>(position)};
+  }
+
+  // chooses the narrowest attribute vector that can address all entries of the dictionary and the null ValueID
+  static std::shared_ptr<BaseAttributeVector> _create_attribute_vector(const size_t unique_values_count,
+                                                                       const size_t size,
+                                                                       const PolymorphicAllocator<size_t>& alloc) {
+    if (unique_values_count <= std::numeric_limits<uint8_t>::max()) {
+      return std::make_shared<FittedAttributeVector<uint8_t>>(size, alloc);
+    }
+    if (unique_values_count <= std::numeric_limits<uint16_t>::max()) {
+      return std::make_shared<FittedAttributeVector<uint16_t>>(size, alloc);
+    }
+    return std::make_shared<FittedAttributeVector<uint32_t>>(size, alloc);
+  }
+
+  std::shared_ptr<const DictionaryVector<T>> _dictionary;
   std::shared_ptr<BaseAttributeVector> _attribute_vector;
 };
 
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// FittedAttributeVector stores ValueIDs in the smallest unsigned integer type (uint8_t, uint16_t, or uint32_t) that
+// can hold all ValueIDs of the dictionary it belongs to
+template <typename uintX_t>
+class FittedAttributeVector : public BaseAttributeVector {
+ public:
+  explicit FittedAttributeVector(const size_t size, const PolymorphicAllocator<uintX_t>& alloc = {})
+      : _attribute_vector(size, alloc) {}
+  explicit FittedAttributeVector(pmr_vector<uintX_t>&& attribute_vector)
+      : _attribute_vector(std::move(attribute_vector)) {}
+
+  ValueID get(const size_t i) const override { return ValueID{_attribute_vector[i]}; }
+
+  void set(const size_t i, const ValueID value_id) override {
+    DebugAssert(value_id.t <= std::numeric_limits<uintX_t>::max(), "ValueID does not fit into attribute vector");
+    _attribute_vector[i] = static_cast<uintX_t>(value_id);
+  }
+
+  size_t size() const override { return _attribute_vector.size(); }
+
+  AttributeVectorWidth width() const override { return sizeof(uintX_t); }
+
+  // returns the underlying vector. Use this instead of get() in tight loops
+  const pmr_vector<uintX_t>& values() const { return _attribute_vector; }
+
+ protected:
+  pmr_vector<uintX_t> _attribute_vector;
+};
+
+}  // namespace opossum
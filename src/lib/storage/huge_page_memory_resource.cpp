@@ -0,0 +1,78 @@
+#include "huge_page_memory_resource.hpp"
+
+#include <sys/mman.h>
+
+#include <cstdint>
+#include <new>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+size_t round_up_to_huge_pages(size_t bytes) {
+  const auto page_size = HugePageMemoryResource::HUGE_PAGE_SIZE;
+  return (bytes + page_size - 1) / page_size * page_size;
+}
+
+}  // namespace
+
+HugePageMemoryResource::HugePageMemoryResource(HugePageMode mode, size_t min_allocation_size,
+                                               boost::container::pmr::memory_resource* upstream)
+    : _mode(mode), _min_allocation_size(min_allocation_size), _upstream(upstream) {}
+
+HugePageMemoryResource* HugePageMemoryResource::get(HugePageMode mode) {
+  static HugePageMemoryResource transparent_resource(HugePageMode::Transparent);
+  static HugePageMemoryResource explicit_resource(HugePageMode::Explicit);
+
+  return mode == HugePageMode::Transparent ? &transparent_resource : &explicit_resource;
+}
+
+HugePageMode HugePageMemoryResource::mode() const { return _mode; }
+
+void* HugePageMemoryResource::do_allocate(size_t bytes, size_t alignment) {
+  if (bytes < _min_allocation_size) return _upstream->allocate(bytes, alignment);
+
+  DebugAssert(alignment <= HUGE_PAGE_SIZE, "Alignment exceeds the huge page size");
+  const auto mapped_bytes = round_up_to_huge_pages(bytes);
+
+  if (_mode == HugePageMode::Explicit) {
+    auto pointer =
+        mmap(nullptr, mapped_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (pointer != MAP_FAILED) return pointer;
+  }
+
+  // mmap only guarantees 4 KB alignment. Mapping one additional huge page allows us to align the region so that the
+  // kernel can back all of it with huge pages.
+  auto pointer =
+      mmap(nullptr, mapped_bytes + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (pointer == MAP_FAILED) throw std::bad_alloc();
+
+  const auto address = reinterpret_cast<uintptr_t>(pointer);
+  const auto aligned_address = (address + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+
+  // return the unused parts before and after the aligned region to the operating system
+  if (aligned_address > address) munmap(pointer, aligned_address - address);
+  const auto tail_size = address + HUGE_PAGE_SIZE - aligned_address;
+  if (tail_size > 0) munmap(reinterpret_cast<void*>(aligned_address + mapped_bytes), tail_size);
+
+  const auto aligned_pointer = reinterpret_cast<void*>(aligned_address);
+  madvise(aligned_pointer, mapped_bytes, MADV_HUGEPAGE);
+  return aligned_pointer;
+}
+
+void HugePageMemoryResource::do_deallocate(void* pointer, size_t bytes, size_t alignment) {
+  if (bytes < _min_allocation_size) {
+    _upstream->deallocate(pointer, bytes, alignment);
+    return;
+  }
+
+  munmap(pointer, round_up_to_huge_pages(bytes));
+}
+
+bool HugePageMemoryResource::do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+}  // namespace opossum
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <cstddef>
+
+#include "types.hpp"
+
+namespace opossum {
+
+enum class HugePageMode {
+  // Pages are backed by transparent huge pages (madvise) whenever the kernel can find free 2 MB pages
+  Transparent,
+  // Pages are taken from the pool of preallocated huge pages (MAP_HUGETLB, see /proc/sys/vm/nr_hugepages).
+  // If the pool is exhausted, allocations fall back to transparent huge pages.
+  Explicit
+};
+
+// HugePageMemoryResource backs large allocations, e.g., the values of a ValueColumn or an attribute vector, with
+// 2 MB pages. This reduces TLB misses for random accesses into large columns, for example, when a PosList is
+// materialized. Allocations smaller than min_allocation_size are passed to the upstream resource, because they would
+// waste most of a huge page.
+//
+// To back a table with huge pages, create it with such a resource:
+//   auto table = std::make_shared<Table>(chunk_size, HugePageMemoryResource::get(HugePageMode::Transparent));
+class HugePageMemoryResource : public boost::container::pmr::memory_resource, private Noncopyable {
+ public:
+  static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+  explicit HugePageMemoryResource(
+      HugePageMode mode, size_t min_allocation_size = HUGE_PAGE_SIZE,
+      boost::container::pmr::memory_resource* upstream = boost::container::pmr::get_default_resource());
+
+  // returns a process-wide resource for the given mode with the default settings
+  static HugePageMemoryResource* get(HugePageMode mode);
+
+  HugePageMode mode() const;
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+  bool do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept override;
+
+  const HugePageMode _mode;
+  const size_t _min_allocation_size;
+  boost::container::pmr::memory_resource* const _upstream;
+};
+
+}  // namespace opossum
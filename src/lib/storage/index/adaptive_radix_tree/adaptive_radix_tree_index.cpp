@@ -0,0 +1,173 @@
+#include "adaptive_radix_tree_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "adaptive_radix_tree_nodes.hpp"
+#include "resolve_type.hpp"
+#include "storage/base_attribute_vector.hpp"
+#include "storage/dictionary_column.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns)
+    : BaseIndex(ColumnIndexType::AdaptiveRadixTree, index_columns),
+      _index_column(std::dynamic_pointer_cast<const BaseDictionaryColumn>(index_columns.front())) {
+  Assert(index_columns.size() == 1, "AdaptiveRadixTreeIndex only works with a single column");
+  Assert(static_cast<bool>(_index_column), "AdaptiveRadixTreeIndex only works with DictionaryColumns");
+
+  const auto attribute_vector = _index_column->attribute_vector();
+  const auto row_count = attribute_vector->size();
+
+  // group the postings by value id with a counting sort, like the GroupKeyIndex, which also leaves out NULL values
+  const auto null_value_id = _index_column->null_value_id();
+  auto group_offsets = std::vector<size_t>(_index_column->unique_values_count() + 1, 0);
+  for (size_t offset = 0; offset < row_count; ++offset) {
+    const auto value_id = attribute_vector->get(offset);
+    if (value_id != null_value_id) ++group_offsets[value_id.t + 1];
+  }
+  for (size_t value_id = 1; value_id < group_offsets.size(); ++value_id) {
+    group_offsets[value_id] += group_offsets[value_id - 1];
+  }
+
+  auto next_positions = group_offsets;
+  _index_postings.resize(group_offsets.back());
+  for (size_t offset = 0; offset < row_count; ++offset) {
+    const auto value_id = attribute_vector->get(offset);
+    if (value_id != null_value_id) _index_postings[next_positions[value_id.t]++] = static_cast<ChunkOffset>(offset);
+  }
+
+  // the dictionary may contain values that no row references, they do not become part of the tree
+  hana::for_each(column_types, [&](auto column_type) {
+    using ColumnDataType = typename decltype(+hana::second(column_type))::type;
+    const auto typed_column = std::dynamic_pointer_cast<const DictionaryColumn<ColumnDataType>>(_index_column);
+    if (!typed_column) return;
+
+    const auto& dictionary = *typed_column->dictionary();
+    for (size_t value_id = 0; value_id + 1 < group_offsets.size(); ++value_id) {
+      if (group_offsets[value_id] == group_offsets[value_id + 1]) continue;
+      _value_groups.emplace_back(art_key_from_value(ColumnDataType{dictionary[value_id]}), group_offsets[value_id]);
+    }
+
+    _key_from_value = [](const AllTypeVariant& value) {
+      DebugAssert(!variant_is_null(value), "NULL is not part of the index");
+      return art_key_from_value(type_cast<ColumnDataType>(value));
+    };
+  });
+  DebugAssert(static_cast<bool>(_key_from_value), "Unknown column type");
+
+  if (!_value_groups.empty()) _root = _build_tree(0, _value_groups.size(), 0);
+  _value_groups = {};
+}
+
+AdaptiveRadixTreeIndex::~AdaptiveRadixTreeIndex() = default;
+
+PosList AdaptiveRadixTreeIndex::point_lookup(const ChunkID chunk_id, const AllTypeVariant& value) const {
+  return _to_pos_list(chunk_id, lower_bound({value}), upper_bound({value}));
+}
+
+PosList AdaptiveRadixTreeIndex::range_lookup(const ChunkID chunk_id, const AllTypeVariant& lower_value,
+                                             const AllTypeVariant& upper_value) const {
+  return _to_pos_list(chunk_id, lower_bound({lower_value}), upper_bound({upper_value}));
+}
+
+PosList AdaptiveRadixTreeIndex::prefix_lookup(const ChunkID chunk_id, const std::string& prefix) const {
+  Assert(static_cast<bool>(std::dynamic_pointer_cast<const DictionaryColumn<std::string>>(_index_column)),
+         "Prefix lookups are only supported for string columns");
+
+  // All values starting with prefix are less than the smallest string that is greater than prefix and does not start
+  // with it. It is prefix with its last character incremented, after removing characters that cannot be incremented.
+  // Strings compare their characters as unsigned char.
+  auto prefix_end = prefix;
+  while (!prefix_end.empty() && static_cast<unsigned char>(prefix_end.back()) == 0xFF) prefix_end.pop_back();
+  if (prefix_end.empty()) return _to_pos_list(chunk_id, lower_bound({prefix}), cend());
+
+  prefix_end.back() = static_cast<char>(static_cast<unsigned char>(prefix_end.back()) + 1);
+  return _to_pos_list(chunk_id, lower_bound({prefix}), lower_bound({prefix_end}));
+}
+
+size_t AdaptiveRadixTreeIndex::estimate_memory_usage() const {
+  auto memory_usage = _index_postings.capacity() * sizeof(ChunkOffset);
+  if (_root) memory_usage += _root->estimate_memory_usage();
+  return memory_usage;
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  return _bound(values.front(), false);
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  return _bound(values.front(), true);
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_cbegin() const { return _index_postings.cbegin(); }
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_cend() const { return _index_postings.cend(); }
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_bound(const AllTypeVariant& value, const bool is_upper_bound) const {
+  if (!_root) return _index_postings.cend();
+  return _root->bound(_key_from_value(value), 0, is_upper_bound);
+}
+
+std::unique_ptr<ARTNode> AdaptiveRadixTreeIndex::_build_tree(const size_t first_group, const size_t last_group,
+                                                              size_t depth) const {
+  const auto begin = _index_postings.cbegin() + _value_groups[first_group].second;
+  const auto end = last_group < _value_groups.size() ? _index_postings.cbegin() + _value_groups[last_group].second
+                                                     : _index_postings.cend();
+  const auto& first_key = _value_groups[first_group].first;
+
+  if (last_group - first_group == 1) return std::make_unique<ARTLeaf>(first_key, begin, end);
+
+  // As the groups are sorted, all of them share a byte if the first and the last one do. Distinct keys are no
+  // prefixes of each other and differ in at least one byte, so this stops before the end of the keys.
+  const auto& last_key = _value_groups[last_group - 1].first;
+  auto compressed_path = std::vector<uint8_t>{};
+  while (first_key[depth] == last_key[depth]) {
+    compressed_path.emplace_back(first_key[depth]);
+    ++depth;
+  }
+
+  auto children = std::vector<std::pair<uint8_t, std::unique_ptr<ARTNode>>>{};
+  auto child_first_group = first_group;
+  while (child_first_group < last_group) {
+    const auto key_byte = _value_groups[child_first_group].first[depth];
+    auto child_last_group = child_first_group + 1;
+    while (child_last_group < last_group && _value_groups[child_last_group].first[depth] == key_byte) {
+      ++child_last_group;
+    }
+
+    children.emplace_back(key_byte, _build_tree(child_first_group, child_last_group, depth + 1));
+    child_first_group = child_last_group;
+  }
+
+  if (children.size() <= 4) {
+    return std::make_unique<ARTNode4>(std::move(compressed_path), std::move(children), begin, end);
+  }
+  if (children.size() <= 16) {
+    return std::make_unique<ARTNode16>(std::move(compressed_path), std::move(children), begin, end);
+  }
+  if (children.size() <= 48) {
+    return std::make_unique<ARTNode48>(std::move(compressed_path), std::move(children), begin, end);
+  }
+  return std::make_unique<ARTNode256>(std::move(compressed_path), std::move(children), begin, end);
+}
+
+PosList AdaptiveRadixTreeIndex::_to_pos_list(const ChunkID chunk_id, const Iterator begin, const Iterator end) {
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  if (begin < end) chunk_offsets.assign(begin, end);
+  std::sort(chunk_offsets.begin(), chunk_offsets.end());
+
+  auto pos_list = PosList{};
+  pos_list.reserve(chunk_offsets.size());
+  for (const auto chunk_offset : chunk_offsets) {
+    pos_list.emplace_back(RowID{chunk_id, chunk_offset});
+  }
+  return pos_list;
+}
+
+}  // namespace opossum
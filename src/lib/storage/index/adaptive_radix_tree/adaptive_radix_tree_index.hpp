@@ -0,0 +1,67 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class ARTNode;
+class BaseDictionaryColumn;
+
+/**
+ * The AdaptiveRadixTreeIndex indexes a single DictionaryColumn with an adaptive radix tree (see
+ * adaptive_radix_tree_nodes.hpp) over the binary-comparable encodings of the values of the rows. Like in the
+ * GroupKeyIndex, the postings are grouped by value, but only the values that occur in the column are stored in the
+ * tree. Lookups encode the search value and walk the tree, they do not search the dictionary. The tree's height is
+ * bounded by the length of the keys, independent of the number of distinct values, which makes it a good fit for
+ * high-cardinality columns such as unique IDs.
+ *
+ * In addition to the bounds of BaseIndex, it offers lookups that return the matching rows as a PosList.
+ */
+class AdaptiveRadixTreeIndex : public BaseIndex {
+ public:
+  explicit AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns);
+  ~AdaptiveRadixTreeIndex() override;
+
+  // The lookups return the rows of the chunk chunk_id (which the index does not know itself) in ascending order.
+  // returns the rows with the value
+  PosList point_lookup(ChunkID chunk_id, const AllTypeVariant& value) const;
+  // returns the rows with lower_value <= value <= upper_value
+  PosList range_lookup(ChunkID chunk_id, const AllTypeVariant& lower_value, const AllTypeVariant& upper_value) const;
+  // returns the rows whose value starts with prefix, only for string columns
+  PosList prefix_lookup(ChunkID chunk_id, const std::string& prefix) const;
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+
+  // returns the first posting whose value is not less than (or greater than, if is_upper_bound) the value
+  Iterator _bound(const AllTypeVariant& value, bool is_upper_bound) const;
+
+  // builds the subtree for the values [first_group, last_group) of _value_groups whose keys share the first depth
+  // bytes
+  std::unique_ptr<ARTNode> _build_tree(size_t first_group, size_t last_group, size_t depth) const;
+
+  static PosList _to_pos_list(ChunkID chunk_id, Iterator begin, Iterator end);
+
+  const std::shared_ptr<const BaseDictionaryColumn> _index_column;
+  // encodes a search value with art_key_from_value of the column's type
+  std::function<std::vector<uint8_t>(const AllTypeVariant&)> _key_from_value;
+  std::vector<ChunkOffset> _index_postings;
+  // the keys of the values that occur in the column and the position of their first posting, only needed while
+  // building
+  std::vector<std::pair<std::vector<uint8_t>, size_t>> _value_groups;
+  std::unique_ptr<ARTNode> _root;
+};
+
+}  // namespace opossum
@@ -0,0 +1,200 @@
+#include "adaptive_radix_tree_nodes.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename UnsignedT>
+void append_big_endian(ARTKey& key, const UnsignedT bits) {
+  for (auto shift = static_cast<int>(8 * sizeof(UnsignedT)) - 8; shift >= 0; shift -= 8) {
+    key.emplace_back(static_cast<uint8_t>((bits >> shift) & 0xFF));
+  }
+}
+
+}  // namespace
+
+template <typename T>
+ARTKey art_key_from_value(const T& value) {
+  auto key = ARTKey{};
+  key.reserve(sizeof(T));
+
+  if constexpr (std::is_integral_v<T>) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    constexpr auto sign_bit = UnsignedT{1} << (8 * sizeof(T) - 1);
+    append_big_endian(key, static_cast<UnsignedT>(static_cast<UnsignedT>(value) ^ sign_bit));
+  } else {
+    static_assert(std::is_floating_point_v<T>, "Unsupported type");
+    using UnsignedT = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    constexpr auto sign_bit = UnsignedT{1} << (8 * sizeof(T) - 1);
+
+    auto bits = UnsignedT{};
+    const auto normalized_value = value == T{0} ? T{0} : value;
+    std::memcpy(&bits, &normalized_value, sizeof(T));
+    append_big_endian(key, static_cast<UnsignedT>((bits & sign_bit) ? ~bits : bits ^ sign_bit));
+  }
+
+  return key;
+}
+
+template <>
+ARTKey art_key_from_value(const std::string& value) {
+  auto key = ARTKey{};
+  key.reserve(value.size() + 2);
+  for (const auto character : value) {
+    key.emplace_back(static_cast<uint8_t>(character));
+    if (character == '\0') key.emplace_back(0xFF);
+  }
+  key.emplace_back(0x00);
+  key.emplace_back(0x00);
+  return key;
+}
+
+template ARTKey art_key_from_value(const int32_t& value);
+template ARTKey art_key_from_value(const int64_t& value);
+template ARTKey art_key_from_value(const float& value);
+template ARTKey art_key_from_value(const double& value);
+
+ARTNode::ARTNode(const Iterator begin, const Iterator end) : _begin(begin), _end(end) {}
+
+ARTNode::Iterator ARTNode::begin() const { return _begin; }
+
+ARTNode::Iterator ARTNode::end() const { return _end; }
+
+ARTLeaf::ARTLeaf(ARTKey key, const Iterator begin, const Iterator end) : ARTNode(begin, end), _key(std::move(key)) {}
+
+ARTNode::Iterator ARTLeaf::bound(const ARTKey& key, const size_t depth, const bool is_upper_bound) const {
+  // The inner nodes above only compared the bytes before depth, the leaf is responsible for the remaining ones. A
+  // search key that ended above would not have reached the leaf.
+  const auto is_leaf_key_less = std::lexicographical_compare(_key.cbegin() + depth, _key.cend(),
+                                                             key.cbegin() + depth, key.cend());
+  if (is_leaf_key_less) return _end;
+  if (!is_upper_bound) return _begin;
+
+  const auto is_leaf_key_equal = std::equal(_key.cbegin() + depth, _key.cend(), key.cbegin() + depth, key.cend());
+  return is_leaf_key_equal ? _end : _begin;
+}
+
+size_t ARTLeaf::estimate_memory_usage() const { return sizeof(*this) + _key.capacity(); }
+
+ARTInnerNode::ARTInnerNode(std::vector<uint8_t> compressed_path, const Iterator begin, const Iterator end)
+    : ARTNode(begin, end), _compressed_path(std::move(compressed_path)) {}
+
+ARTNode::Iterator ARTInnerNode::bound(const ARTKey& key, size_t depth, const bool is_upper_bound) const {
+  // A search key that ends here is a proper prefix of all keys below, and thus less than them. Keys of the same type
+  // are never prefixes of each other, but search keys may be, e.g., in tests.
+  for (const auto path_byte : _compressed_path) {
+    if (depth == key.size() || key[depth] < path_byte) return _begin;
+    if (key[depth] > path_byte) return _end;
+    ++depth;
+  }
+  if (depth == key.size()) return _begin;
+
+  auto is_exact_match = false;
+  const auto child = _find_child_not_less(key[depth], is_exact_match);
+  if (!child) return _end;
+  if (!is_exact_match) return child->begin();
+  return child->bound(key, depth + 1, is_upper_bound);
+}
+
+template <size_t capacity>
+ARTSortedNode<capacity>::ARTSortedNode(std::vector<uint8_t> compressed_path,
+                                       std::vector<std::pair<uint8_t, std::unique_ptr<ARTNode>>> children,
+                                       const Iterator begin, const Iterator end)
+    : ARTInnerNode(std::move(compressed_path), begin, end), _child_count(static_cast<uint8_t>(children.size())) {
+  DebugAssert(children.size() <= capacity, "Too many children for node");
+  for (size_t child_index = 0; child_index < children.size(); ++child_index) {
+    _key_bytes[child_index] = children[child_index].first;
+    _children[child_index] = std::move(children[child_index].second);
+  }
+}
+
+template <size_t capacity>
+size_t ARTSortedNode<capacity>::estimate_memory_usage() const {
+  auto memory_usage = sizeof(*this) + _compressed_path.capacity();
+  for (size_t child_index = 0; child_index < _child_count; ++child_index) {
+    memory_usage += _children[child_index]->estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+template <size_t capacity>
+const ARTNode* ARTSortedNode<capacity>::_find_child_not_less(const uint8_t key_byte, bool& is_exact_match) const {
+  const auto key_bytes_end = _key_bytes.cbegin() + _child_count;
+  const auto key_byte_it = std::lower_bound(_key_bytes.cbegin(), key_bytes_end, key_byte);
+  if (key_byte_it == key_bytes_end) return nullptr;
+
+  is_exact_match = *key_byte_it == key_byte;
+  return _children[std::distance(_key_bytes.cbegin(), key_byte_it)].get();
+}
+
+template class ARTSortedNode<4>;
+template class ARTSortedNode<16>;
+
+ARTNode48::ARTNode48(std::vector<uint8_t> compressed_path,
+                     std::vector<std::pair<uint8_t, std::unique_ptr<ARTNode>>> children, const Iterator begin,
+                     const Iterator end)
+    : ARTInnerNode(std::move(compressed_path), begin, end) {
+  DebugAssert(children.size() <= _children.size(), "Too many children for node");
+  _child_positions.fill(NO_CHILD);
+  for (size_t child_index = 0; child_index < children.size(); ++child_index) {
+    _child_positions[children[child_index].first] = static_cast<uint8_t>(child_index);
+    _children[child_index] = std::move(children[child_index].second);
+  }
+}
+
+size_t ARTNode48::estimate_memory_usage() const {
+  auto memory_usage = sizeof(*this) + _compressed_path.capacity();
+  for (const auto& child : _children) {
+    if (child) memory_usage += child->estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+const ARTNode* ARTNode48::_find_child_not_less(const uint8_t key_byte, bool& is_exact_match) const {
+  for (auto next_key_byte = size_t{key_byte}; next_key_byte < _child_positions.size(); ++next_key_byte) {
+    if (_child_positions[next_key_byte] != NO_CHILD) {
+      is_exact_match = next_key_byte == key_byte;
+      return _children[_child_positions[next_key_byte]].get();
+    }
+  }
+  return nullptr;
+}
+
+ARTNode256::ARTNode256(std::vector<uint8_t> compressed_path,
+                       std::vector<std::pair<uint8_t, std::unique_ptr<ARTNode>>> children, const Iterator begin,
+                       const Iterator end)
+    : ARTInnerNode(std::move(compressed_path), begin, end) {
+  for (auto& key_byte_and_child : children) {
+    _children[key_byte_and_child.first] = std::move(key_byte_and_child.second);
+  }
+}
+
+size_t ARTNode256::estimate_memory_usage() const {
+  auto memory_usage = sizeof(*this) + _compressed_path.capacity();
+  for (const auto& child : _children) {
+    if (child) memory_usage += child->estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+const ARTNode* ARTNode256::_find_child_not_less(const uint8_t key_byte, bool& is_exact_match) const {
+  for (auto next_key_byte = size_t{key_byte}; next_key_byte < _children.size(); ++next_key_byte) {
+    if (_children[next_key_byte]) {
+      is_exact_match = next_key_byte == key_byte;
+      return _children[next_key_byte].get();
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace opossum
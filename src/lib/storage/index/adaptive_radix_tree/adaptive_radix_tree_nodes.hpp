@@ -0,0 +1,143 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Nodes of the AdaptiveRadixTreeIndex, following "The Adaptive Radix Tree: ARTful Indexing for Main-Memory Databases"
+ * (Leis et al., ICDE 2013). Keys are binary-comparable encodings of the indexed values (see art_key_from_value), so
+ * that the byte-wise order of the keys is the order of the values. Every node covers a contiguous range of the index's
+ * postings (all rows whose keys start with the node's path), so that begin() and end() do not need to descend the tree.
+ *
+ * Inner nodes adapt their layout to the number of children:
+ *  - ARTNode4 and ARTNode16 store up to 4 or 16 sorted key bytes and child pointers.
+ *  - ARTNode48 maps all 256 key bytes to the positions of at most 48 children.
+ *  - ARTNode256 directly stores a child pointer for every key byte.
+ * Inner nodes whose children all share the next bytes store them as a compressed path (pessimistic path compression).
+ * Subtrees with a single key are replaced by a leaf (lazy expansion), which is why leaves store their complete key.
+ */
+
+using ARTKey = std::vector<uint8_t>;
+
+/**
+ * Returns the binary-comparable encoding of a value, i.e., a < b if and only if the key of a is lexicographically
+ * less than the key of b. No key is a prefix of another key of the same type.
+ *  - Integers are stored big-endian with the sign bit flipped.
+ *  - Floating-point numbers are stored like integers, but all bits of negative numbers are flipped, so that greater
+ *    magnitudes become smaller keys. -0.0 is stored as 0.0, as they are equal.
+ *  - Strings are stored byte-wise and terminated by 0x00 0x00. Their 0x00 bytes are stored as 0x00 0xFF, so that
+ *    they order before all other bytes but after the end of a shorter string.
+ */
+template <typename T>
+ARTKey art_key_from_value(const T& value);
+
+template <>
+ARTKey art_key_from_value(const std::string& value);
+
+class ARTNode : private Noncopyable {
+ public:
+  using Iterator = BaseIndex::Iterator;
+
+  ARTNode(Iterator begin, Iterator end);
+  virtual ~ARTNode() = default;
+
+  // returns the first posting of a key >= the given key (or > the given key if is_upper_bound), looking at the bytes
+  // from depth on
+  virtual Iterator bound(const ARTKey& key, size_t depth, bool is_upper_bound) const = 0;
+
+  virtual size_t estimate_memory_usage() const = 0;
+
+  Iterator begin() const;
+  Iterator end() const;
+
+ protected:
+  const Iterator _begin;
+  const Iterator _end;
+};
+
+// the postings of all rows with the same key
+class ARTLeaf : public ARTNode {
+ public:
+  ARTLeaf(ARTKey key, Iterator begin, Iterator end);
+
+  Iterator bound(const ARTKey& key, size_t depth, bool is_upper_bound) const override;
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  const ARTKey _key;
+};
+
+class ARTInnerNode : public ARTNode {
+ public:
+  ARTInnerNode(std::vector<uint8_t> compressed_path, Iterator begin, Iterator end);
+
+  Iterator bound(const ARTKey& key, size_t depth, bool is_upper_bound) const override;
+
+ protected:
+  // returns the child for the key byte, or the first child with a greater key byte, or nullptr if there is none.
+  // Sets is_exact_match accordingly.
+  virtual const ARTNode* _find_child_not_less(uint8_t key_byte, bool& is_exact_match) const = 0;
+
+  const std::vector<uint8_t> _compressed_path;
+};
+
+// The constructors of the inner nodes take the children with their key bytes (at depth + compressed_path.size()),
+// sorted by the key bytes.
+template <size_t capacity>
+class ARTSortedNode : public ARTInnerNode {
+ public:
+  ARTSortedNode(std::vector<uint8_t> compressed_path,
+                std::vector<std::pair<uint8_t, std::unique_ptr<ARTNode>>> children, Iterator begin, Iterator end);
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  const ARTNode* _find_child_not_less(uint8_t key_byte, bool& is_exact_match) const override;
+
+  uint8_t _child_count;
+  std::array<uint8_t, capacity> _key_bytes;
+  std::array<std::unique_ptr<ARTNode>, capacity> _children;
+};
+
+using ARTNode4 = ARTSortedNode<4>;
+using ARTNode16 = ARTSortedNode<16>;
+
+class ARTNode48 : public ARTInnerNode {
+ public:
+  ARTNode48(std::vector<uint8_t> compressed_path, std::vector<std::pair<uint8_t, std::unique_ptr<ARTNode>>> children,
+            Iterator begin, Iterator end);
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  const ARTNode* _find_child_not_less(uint8_t key_byte, bool& is_exact_match) const override;
+
+  static constexpr uint8_t NO_CHILD = 255;
+
+  std::array<uint8_t, 256> _child_positions;
+  std::array<std::unique_ptr<ARTNode>, 48> _children;
+};
+
+class ARTNode256 : public ARTInnerNode {
+ public:
+  ARTNode256(std::vector<uint8_t> compressed_path, std::vector<std::pair<uint8_t, std::unique_ptr<ARTNode>>> children,
+             Iterator begin, Iterator end);
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  const ARTNode* _find_child_not_less(uint8_t key_byte, bool& is_exact_match) const override;
+
+  std::array<std::unique_ptr<ARTNode>, 256> _children;
+};
+
+}  // namespace opossum
@@ -0,0 +1,270 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * An in-memory B+-tree that stores a sorted set of unique keys. Inner nodes hold up to node_capacity children, leaves
+ * up to node_capacity keys and a pointer to the next leaf, so that iterating over a range of keys only descends the
+ * tree once. Inserting and looking up a key costs O(log n).
+ *
+ * Nodes that overflow are split in half, except for the rightmost leaf when the key is inserted at its end. Then, the
+ * new leaf only receives the new key, which keeps the leaves full when keys are inserted in ascending order (e.g.,
+ * row ids or serial numbers).
+ *
+ * erase_if removes keys in place. It does not merge nodes that become underfull, but removes empty ones, so that
+ * every leaf holds at least one key. The tree is not thread-safe.
+ */
+template <typename Key, size_t node_capacity = 64>
+class BPlusTree : private Noncopyable {
+  static_assert(node_capacity >= 3, "Nodes need room for at least three entries");
+
+ protected:
+  struct Node {
+    explicit Node(const bool is_leaf) : is_leaf(is_leaf) {}
+    virtual ~Node() = default;
+
+    const bool is_leaf;
+  };
+
+  struct LeafNode : public Node {
+    LeafNode() : Node(true) { keys.reserve(node_capacity + 1); }
+
+    std::vector<Key> keys;
+    LeafNode* next = nullptr;
+  };
+
+  struct InnerNode : public Node {
+    InnerNode() : Node(false) {
+      separators.reserve(node_capacity);
+      children.reserve(node_capacity + 1);
+    }
+
+    // children[i] holds the keys in [separators[i - 1], separators[i])
+    std::vector<Key> separators;
+    std::vector<std::unique_ptr<Node>> children;
+  };
+
+  // the first key of a node that was split off and the node itself
+  using Split = std::pair<Key, std::unique_ptr<Node>>;
+
+ public:
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Key;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Key*;
+    using reference = const Key&;
+
+    Iterator() = default;
+    Iterator(const LeafNode* leaf, const size_t position) : _leaf(leaf), _position(position) {
+      if (_leaf && _position == _leaf->keys.size()) *this = Iterator(_leaf->next, 0);
+    }
+
+    const Key& operator*() const { return _leaf->keys[_position]; }
+    const Key* operator->() const { return &_leaf->keys[_position]; }
+
+    Iterator& operator++() {
+      *this = Iterator(_leaf, _position + 1);
+      return *this;
+    }
+
+    bool operator==(const Iterator& other) const { return _leaf == other._leaf && _position == other._position; }
+    bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+   protected:
+    // nullptr for the end iterator
+    const LeafNode* _leaf = nullptr;
+    size_t _position = 0;
+  };
+
+  BPlusTree() : _root(std::make_unique<LeafNode>()) {}
+
+  // inserts the key, returns false if it was already contained
+  bool insert(const Key& key) {
+    auto inserted = false;
+    auto split = _insert(*_root, key, inserted, true);
+    if (split.second) {
+      auto new_root = std::make_unique<InnerNode>();
+      new_root->separators.emplace_back(std::move(split.first));
+      new_root->children.emplace_back(std::move(_root));
+      new_root->children.emplace_back(std::move(split.second));
+      _root = std::move(new_root);
+      ++_height;
+    }
+    if (inserted) ++_size;
+    return inserted;
+  }
+
+  // removes all keys for which predicate returns true in one pass over the leaves, returns the number of removed keys
+  template <typename Predicate>
+  size_t erase_if(const Predicate& predicate) {
+    const auto previous_size = _size;
+    _erase_if(*_root, predicate);
+
+    // the root may have lost all children but one, or all of them
+    while (!_root->is_leaf && static_cast<InnerNode&>(*_root).children.size() <= 1) {
+      auto& children = static_cast<InnerNode&>(*_root).children;
+      _height = children.empty() ? 1 : _height - 1;
+      _root = children.empty() ? std::make_unique<LeafNode>() : std::move(children.front());
+    }
+
+    // the next pointers of the leaves before removed ones are dangling, the remaining leaves are linked again
+    LeafNode* previous_leaf = nullptr;
+    _link_leaves(*_root, previous_leaf);
+    if (previous_leaf) previous_leaf->next = nullptr;
+
+    return previous_size - _size;
+  }
+
+  // returns an iterator to the first key that is not less than key
+  Iterator lower_bound(const Key& key) const {
+    const Node* node = _root.get();
+    while (!node->is_leaf) {
+      const auto& inner_node = static_cast<const InnerNode&>(*node);
+      node = inner_node.children[_child_index(inner_node, key)].get();
+    }
+
+    const auto& leaf = static_cast<const LeafNode&>(*node);
+    const auto position = std::lower_bound(leaf.keys.cbegin(), leaf.keys.cend(), key) - leaf.keys.cbegin();
+    return Iterator(&leaf, position);
+  }
+
+  Iterator begin() const { return Iterator(_first_leaf(), 0); }
+  Iterator end() const { return Iterator(); }
+
+  size_t size() const { return _size; }
+
+  // returns the number of levels, a tree with a single leaf has height 1
+  size_t height() const { return _height; }
+
+  size_t estimate_memory_usage() const { return _estimate_memory_usage(*_root); }
+
+ protected:
+  // returns the index of the child whose keys include key
+  static size_t _child_index(const InnerNode& node, const Key& key) {
+    return std::upper_bound(node.separators.cbegin(), node.separators.cend(), key) - node.separators.cbegin();
+  }
+
+  // inserts the key into the subtree, returns the node that was split off from node, if any
+  Split _insert(Node& node, const Key& key, bool& inserted, const bool is_rightmost) {
+    if (node.is_leaf) {
+      auto& leaf = static_cast<LeafNode&>(node);
+      const auto position = std::lower_bound(leaf.keys.begin(), leaf.keys.end(), key);
+      if (position != leaf.keys.end() && !(key < *position)) return {};
+
+      const auto is_appended = position == leaf.keys.end();
+      leaf.keys.insert(position, key);
+      inserted = true;
+      if (leaf.keys.size() <= node_capacity) return {};
+
+      auto new_leaf = std::make_unique<LeafNode>();
+      const auto split_position = is_rightmost && is_appended ? node_capacity : leaf.keys.size() / 2;
+      new_leaf->keys.assign(std::make_move_iterator(leaf.keys.begin() + split_position),
+                            std::make_move_iterator(leaf.keys.end()));
+      leaf.keys.erase(leaf.keys.begin() + split_position, leaf.keys.end());
+      new_leaf->next = leaf.next;
+      leaf.next = new_leaf.get();
+      auto separator = new_leaf->keys.front();
+      return {std::move(separator), std::move(new_leaf)};
+    }
+
+    auto& inner_node = static_cast<InnerNode&>(node);
+    const auto child_index = _child_index(inner_node, key);
+    const auto is_rightmost_child = is_rightmost && child_index + 1 == inner_node.children.size();
+    auto child_split = _insert(*inner_node.children[child_index], key, inserted, is_rightmost_child);
+    if (!child_split.second) return {};
+
+    inner_node.separators.insert(inner_node.separators.begin() + child_index, std::move(child_split.first));
+    inner_node.children.insert(inner_node.children.begin() + child_index + 1, std::move(child_split.second));
+    if (inner_node.children.size() <= node_capacity) return {};
+
+    // the middle separator moves up, the children right of it move to the new node
+    auto new_inner_node = std::make_unique<InnerNode>();
+    const auto split_position = inner_node.separators.size() / 2;
+    auto separator = std::move(inner_node.separators[split_position]);
+    new_inner_node->separators.assign(std::make_move_iterator(inner_node.separators.begin() + split_position + 1),
+                                      std::make_move_iterator(inner_node.separators.end()));
+    new_inner_node->children.assign(std::make_move_iterator(inner_node.children.begin() + split_position + 1),
+                                    std::make_move_iterator(inner_node.children.end()));
+    inner_node.separators.erase(inner_node.separators.begin() + split_position, inner_node.separators.end());
+    inner_node.children.erase(inner_node.children.begin() + split_position + 1, inner_node.children.end());
+    return {std::move(separator), std::move(new_inner_node)};
+  }
+
+  // removes the keys of the subtree for which predicate returns true and the nodes that become empty
+  template <typename Predicate>
+  void _erase_if(Node& node, const Predicate& predicate) {
+    if (node.is_leaf) {
+      auto& keys = static_cast<LeafNode&>(node).keys;
+      const auto new_end = std::remove_if(keys.begin(), keys.end(), predicate);
+      _size -= static_cast<size_t>(std::distance(new_end, keys.end()));
+      keys.erase(new_end, keys.end());
+      return;
+    }
+
+    // An empty child is removed together with the separator on its left (or on its right for the first child), so
+    // that its left (or right) neighbor covers its range of keys.
+    auto& inner_node = static_cast<InnerNode&>(node);
+    for (size_t child_index = inner_node.children.size(); child_index-- > 0;) {
+      auto& child = *inner_node.children[child_index];
+      _erase_if(child, predicate);
+
+      const auto is_empty = child.is_leaf ? static_cast<LeafNode&>(child).keys.empty()
+                                          : static_cast<InnerNode&>(child).children.empty();
+      if (!is_empty) continue;
+
+      inner_node.children.erase(inner_node.children.begin() + child_index);
+      if (!inner_node.separators.empty()) {
+        inner_node.separators.erase(inner_node.separators.begin() + (child_index > 0 ? child_index - 1 : 0));
+      }
+    }
+  }
+
+  static void _link_leaves(Node& node, LeafNode*& previous_leaf) {
+    if (node.is_leaf) {
+      auto& leaf = static_cast<LeafNode&>(node);
+      if (previous_leaf) previous_leaf->next = &leaf;
+      previous_leaf = &leaf;
+      return;
+    }
+
+    for (auto& child : static_cast<InnerNode&>(node).children) _link_leaves(*child, previous_leaf);
+  }
+
+  const LeafNode* _first_leaf() const {
+    const Node* node = _root.get();
+    while (!node->is_leaf) node = static_cast<const InnerNode&>(*node).children.front().get();
+    return static_cast<const LeafNode*>(node);
+  }
+
+  static size_t _estimate_memory_usage(const Node& node) {
+    if (node.is_leaf) {
+      const auto& leaf = static_cast<const LeafNode&>(node);
+      return sizeof(LeafNode) + leaf.keys.capacity() * sizeof(Key);
+    }
+
+    const auto& inner_node = static_cast<const InnerNode&>(node);
+    auto memory_usage = sizeof(InnerNode) + inner_node.separators.capacity() * sizeof(Key) +
+                        inner_node.children.capacity() * sizeof(std::unique_ptr<Node>);
+    for (const auto& child : inner_node.children) {
+      memory_usage += _estimate_memory_usage(*child);
+    }
+    return memory_usage;
+  }
+
+  std::unique_ptr<Node> _root;
+  size_t _size = 0;
+  size_t _height = 1;
+};
+
+}  // namespace opossum
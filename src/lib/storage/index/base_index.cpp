@@ -0,0 +1,35 @@
+#include "base_index.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BaseIndex::BaseIndex(const ColumnIndexType type, const std::vector<std::shared_ptr<const BaseColumn>>& index_columns)
+    : _type(type), _index_columns(index_columns) {
+  Assert(!_index_columns.empty(), "Indexes need at least one column");
+}
+
+BaseIndex::Iterator BaseIndex::lower_bound(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(values.size() <= _index_columns.size(), "Index has fewer columns than values are given");
+  if (values.empty()) return cbegin();
+  return _lower_bound(values);
+}
+
+BaseIndex::Iterator BaseIndex::upper_bound(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(values.size() <= _index_columns.size(), "Index has fewer columns than values are given");
+  if (values.empty()) return cend();
+  return _upper_bound(values);
+}
+
+BaseIndex::Iterator BaseIndex::cbegin() const { return _cbegin(); }
+
+BaseIndex::Iterator BaseIndex::cend() const { return _cend(); }
+
+ColumnIndexType BaseIndex::type() const { return _type; }
+
+const std::vector<std::shared_ptr<const BaseColumn>>& BaseIndex::index_columns() const { return _index_columns; }
+
+}  // namespace opossum
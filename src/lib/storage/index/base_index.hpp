@@ -0,0 +1,65 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+
+enum class ColumnIndexType { GroupKey, CompositeGroupKey, AdaptiveRadixTree };
+
+/**
+ * BaseIndex is the abstract super class of the secondary indexes of a chunk (see Chunk::create_index).
+ *
+ * An index lists the chunk offsets of the indexed rows in the order of their values. lower_bound returns the first
+ * position in this list whose value is not less than the search values, upper_bound the first one whose value is
+ * greater. [lower_bound(v), upper_bound(v)) thus holds all rows with the value v, and range predicates map to ranges
+ * of the list as well.
+ *
+ * Indexes over several columns order their rows lexicographically. The search values may be a prefix of the indexed
+ * columns, e.g., [lower_bound({1}), upper_bound({1})) of an index on (a, b) holds all rows with a = 1.
+ *
+ * Indexes are immutable and keep their columns alive. They are not spilled together with their chunk, so indexed
+ * columns stay in memory even if the BufferManager spills the chunk.
+ */
+class BaseIndex : private Noncopyable {
+ public:
+  using Iterator = std::vector<ChunkOffset>::const_iterator;
+
+  BaseIndex(ColumnIndexType type, const std::vector<std::shared_ptr<const BaseColumn>>& index_columns);
+  BaseIndex(BaseIndex&&) = default;
+  BaseIndex& operator=(BaseIndex&&) = default;
+  virtual ~BaseIndex() = default;
+
+  // values may hold fewer values than the index has columns, but not more. Without values, the bounds are cbegin()
+  // and cend().
+  Iterator lower_bound(const std::vector<AllTypeVariant>& values) const;
+  Iterator upper_bound(const std::vector<AllTypeVariant>& values) const;
+
+  // iterate over the offsets of all rows, ordered by their values
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+  ColumnIndexType type() const;
+
+  const std::vector<std::shared_ptr<const BaseColumn>>& index_columns() const;
+
+  // returns an estimate of the number of bytes occupied by the index, not including the indexed columns
+  virtual size_t estimate_memory_usage() const = 0;
+
+ protected:
+  // called with 1 to index_columns().size() values
+  virtual Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _cbegin() const = 0;
+  virtual Iterator _cend() const = 0;
+
+  ColumnIndexType _type;
+  std::vector<std::shared_ptr<const BaseColumn>> _index_columns;
+};
+
+}  // namespace opossum
@@ -0,0 +1,124 @@
+#include "composite_group_key_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "storage/base_attribute_vector.hpp"
+#include "storage/base_dictionary_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+CompositeGroupKeyIndex::CompositeGroupKeyIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns)
+    : BaseIndex(ColumnIndexType::CompositeGroupKey, index_columns) {
+  for (const auto& column : index_columns) {
+    const auto dictionary_column = std::dynamic_pointer_cast<const BaseDictionaryColumn>(column);
+    Assert(static_cast<bool>(dictionary_column), "CompositeGroupKeyIndex only works with DictionaryColumns");
+    _dictionary_columns.emplace_back(dictionary_column);
+  }
+
+  const auto column_count = _dictionary_columns.size();
+  const auto row_count = _dictionary_columns.front()->size();
+  for (const auto& column : _dictionary_columns) {
+    Assert(column->size() == row_count, "All columns of the index need to have the same size");
+  }
+
+  // gather the keys in row order first, so that sorting does not go through the attribute vectors' virtual calls
+  auto row_keys = std::vector<ValueID>(row_count * column_count);
+  for (size_t column_index = 0; column_index < column_count; ++column_index) {
+    const auto attribute_vector = _dictionary_columns[column_index]->attribute_vector();
+    for (size_t offset = 0; offset < row_count; ++offset) {
+      row_keys[offset * column_count + column_index] = attribute_vector->get(offset);
+    }
+  }
+
+  // rows with a NULL value in any of the columns are not indexed, as no lookup matches them. Their null ValueID would
+  // otherwise sort like values that are greater than all values of the dictionary (see _create_search_key).
+  _index_postings.reserve(row_count);
+  for (size_t offset = 0; offset < row_count; ++offset) {
+    auto has_null = false;
+    for (size_t column_index = 0; column_index < column_count; ++column_index) {
+      has_null |= row_keys[offset * column_count + column_index] == _dictionary_columns[column_index]->null_value_id();
+    }
+    if (!has_null) _index_postings.push_back(static_cast<ChunkOffset>(offset));
+  }
+  std::stable_sort(_index_postings.begin(), _index_postings.end(), [&](const auto left, const auto right) {
+    const auto left_key = row_keys.cbegin() + left * column_count;
+    const auto right_key = row_keys.cbegin() + right * column_count;
+    return std::lexicographical_compare(left_key, left_key + column_count, right_key, right_key + column_count);
+  });
+
+  _keys.reserve(row_keys.size());
+  for (const auto offset : _index_postings) {
+    const auto key = row_keys.cbegin() + offset * column_count;
+    _keys.insert(_keys.end(), key, key + column_count);
+  }
+}
+
+size_t CompositeGroupKeyIndex::estimate_memory_usage() const {
+  return _keys.capacity() * sizeof(ValueID) + _index_postings.capacity() * sizeof(ChunkOffset);
+}
+
+BaseIndex::Iterator CompositeGroupKeyIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  return _find_first_not_less(_create_search_key(values, false));
+}
+
+BaseIndex::Iterator CompositeGroupKeyIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  return _find_first_not_less(_create_search_key(values, true));
+}
+
+BaseIndex::Iterator CompositeGroupKeyIndex::_cbegin() const { return _index_postings.cbegin(); }
+
+BaseIndex::Iterator CompositeGroupKeyIndex::_cend() const { return _index_postings.cend(); }
+
+std::vector<ValueID> CompositeGroupKeyIndex::_create_search_key(const std::vector<AllTypeVariant>& values,
+                                                                const bool is_upper_bound) const {
+  auto search_key = std::vector<ValueID>{};
+
+  for (size_t column_index = 0; column_index < values.size(); ++column_index) {
+    const auto& column = *_dictionary_columns[column_index];
+    const auto unique_values_count = ValueID{static_cast<ValueID::base_type>(column.unique_values_count())};
+
+    // INVALID_VALUE_ID means that all values of the dictionary are smaller, i.e., the value sorts after all of them
+    auto lower_value_id = column.lower_bound(values[column_index]);
+    if (lower_value_id == INVALID_VALUE_ID) lower_value_id = unique_values_count;
+    auto upper_value_id = column.upper_bound(values[column_index]);
+    if (upper_value_id == INVALID_VALUE_ID) upper_value_id = unique_values_count;
+
+    const auto is_last_value = column_index + 1 == values.size();
+    if (is_upper_bound && is_last_value) {
+      search_key.emplace_back(upper_value_id);
+      break;
+    }
+
+    search_key.emplace_back(lower_value_id);
+
+    // The value is not in the dictionary, so all rows starting with lower_value_id are greater than the values,
+    // regardless of the remaining columns.
+    if (lower_value_id == upper_value_id) break;
+  }
+
+  return search_key;
+}
+
+BaseIndex::Iterator CompositeGroupKeyIndex::_find_first_not_less(const std::vector<ValueID>& search_key) const {
+  const auto column_count = _dictionary_columns.size();
+
+  // binary search over the positions of the index, comparing only the first search_key.size() ValueIDs of each key
+  auto begin = size_t{0};
+  auto end = _index_postings.size();
+  while (begin < end) {
+    const auto middle = begin + (end - begin) / 2;
+    const auto key = _keys.cbegin() + middle * column_count;
+    if (std::lexicographical_compare(key, key + search_key.size(), search_key.cbegin(), search_key.cend())) {
+      begin = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+
+  return _index_postings.cbegin() + begin;
+}
+
+}  // namespace opossum
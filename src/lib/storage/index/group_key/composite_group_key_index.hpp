@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseDictionaryColumn;
+
+/**
+ * The CompositeGroupKeyIndex indexes several DictionaryColumns of a chunk at once. Every row is represented by the
+ * concatenation of its ValueIDs (its key), and the rows are sorted by their keys, so that the order of the index is
+ * the lexicographical order of the values:
+ *
+ *   column a: 1 0 1 0        keys:     (0,0) (0,1) (1,0) (1,1)
+ *   column b: 0 1 1 0        postings:   3     1     0     2
+ *
+ * To look up values, they are translated into a key using the dictionaries, and the index performs a binary search
+ * over the keys. Rows with equal keys are ordered by their offset.
+ */
+class CompositeGroupKeyIndex : public BaseIndex {
+ public:
+  explicit CompositeGroupKeyIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns);
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+
+  // Translates the values into a (possibly shorter) key, so that the rows whose keys start with something greater
+  // than or equal to it are exactly the rows whose values are greater than (is_upper_bound) or greater than or equal
+  // to (!is_upper_bound) the values.
+  std::vector<ValueID> _create_search_key(const std::vector<AllTypeVariant>& values, bool is_upper_bound) const;
+
+  // returns the first row whose key starts with something greater than or equal to the search key
+  Iterator _find_first_not_less(const std::vector<ValueID>& search_key) const;
+
+  std::vector<std::shared_ptr<const BaseDictionaryColumn>> _dictionary_columns;
+  // the keys of all rows in index order, i.e., the key of the row _index_postings[i] is
+  // _keys[i * column count, (i + 1) * column count)
+  std::vector<ValueID> _keys;
+  std::vector<ChunkOffset> _index_postings;
+};
+
+}  // namespace opossum
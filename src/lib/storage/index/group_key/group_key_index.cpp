@@ -0,0 +1,64 @@
+#include "group_key_index.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "storage/base_attribute_vector.hpp"
+#include "storage/base_dictionary_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns)
+    : BaseIndex(ColumnIndexType::GroupKey, index_columns),
+      _index_column(std::dynamic_pointer_cast<const BaseDictionaryColumn>(index_columns.front())) {
+  Assert(index_columns.size() == 1, "GroupKeyIndex only works with a single column");
+  Assert(static_cast<bool>(_index_column), "GroupKeyIndex only works with DictionaryColumns");
+
+  const auto attribute_vector = _index_column->attribute_vector();
+  const auto row_count = attribute_vector->size();
+
+  // count the occurrences of every value id, shifted by one so that the prefix sum yields the start of each group.
+  // NULL values (see BaseDictionaryColumn::null_value_id) are not indexed, as no lookup matches them.
+  const auto null_value_id = _index_column->null_value_id();
+  _index_offsets.resize(_index_column->unique_values_count() + 1, 0);
+  for (size_t offset = 0; offset < row_count; ++offset) {
+    const auto value_id = attribute_vector->get(offset);
+    if (value_id != null_value_id) ++_index_offsets[value_id.t + 1];
+  }
+  for (size_t value_id = 1; value_id < _index_offsets.size(); ++value_id) {
+    _index_offsets[value_id] += _index_offsets[value_id - 1];
+  }
+
+  // place every offset at the next free position of its group. Since the offsets are visited in ascending order,
+  // every group is sorted.
+  auto next_positions = _index_offsets;
+  _index_postings.resize(_index_offsets.back());
+  for (size_t offset = 0; offset < row_count; ++offset) {
+    const auto value_id = attribute_vector->get(offset);
+    if (value_id != null_value_id) _index_postings[next_positions[value_id.t]++] = static_cast<ChunkOffset>(offset);
+  }
+}
+
+size_t GroupKeyIndex::estimate_memory_usage() const {
+  return _index_offsets.capacity() * sizeof(size_t) + _index_postings.capacity() * sizeof(ChunkOffset);
+}
+
+BaseIndex::Iterator GroupKeyIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  return _postings_begin(_index_column->lower_bound(values.front()));
+}
+
+BaseIndex::Iterator GroupKeyIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  return _postings_begin(_index_column->upper_bound(values.front()));
+}
+
+BaseIndex::Iterator GroupKeyIndex::_cbegin() const { return _index_postings.cbegin(); }
+
+BaseIndex::Iterator GroupKeyIndex::_cend() const { return _index_postings.cend(); }
+
+BaseIndex::Iterator GroupKeyIndex::_postings_begin(const ValueID value_id) const {
+  if (value_id == INVALID_VALUE_ID) return _index_postings.cend();
+  return _index_postings.cbegin() + _index_offsets[value_id.t];
+}
+
+}  // namespace opossum
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseDictionaryColumn;
+
+/**
+ * The GroupKeyIndex indexes a single DictionaryColumn. It groups the chunk offsets of the rows by their ValueIDs
+ * (postings) and stores where the group of every ValueID starts (offsets):
+ *
+ *   attribute vector: 2 0 1 2 0      ValueID:    0    1    2
+ *   offsets:          0 2 3 5        postings: [1 4] [2] [0 3]
+ *
+ * Since the dictionary is sorted, the groups are ordered by value, and the bounds of a value are the start of the
+ * group of the dictionary's lower_bound and upper_bound ValueID. The index is built with a counting sort in linear
+ * time, a lookup costs a binary search in the dictionary.
+ */
+class GroupKeyIndex : public BaseIndex {
+ public:
+  explicit GroupKeyIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns);
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+
+  // returns an iterator to the first posting of the value id, which may be INVALID_VALUE_ID
+  Iterator _postings_begin(ValueID value_id) const;
+
+  const std::shared_ptr<const BaseDictionaryColumn> _index_column;
+  // _index_offsets[value_id] is the position of the first posting of value_id, the last entry is the number of rows
+  std::vector<size_t> _index_offsets;
+  std::vector<ChunkOffset> _index_postings;
+};
+
+}  // namespace opossum
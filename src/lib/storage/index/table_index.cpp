@@ -0,0 +1,160 @@
+#include "table_index.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "storage/dictionary_column.hpp"
+#include "storage/value_column.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// An entry with MIN_ROW_ID sorts before all entries of the same value. No row has MAX_ROW_ID, so that an entry with it
+// sorts after all of them.
+const auto MIN_ROW_ID = RowID{ChunkID{0}, 0};
+const auto MAX_ROW_ID = RowID{ChunkID{std::numeric_limits<ChunkID::base_type>::max()},
+                              std::numeric_limits<ChunkOffset>::max()};
+
+}  // namespace
+
+PosList BaseTableIndex::point_lookup(const AllTypeVariant& value) const { return lookup(ScanType::OpEquals, value); }
+
+template <typename T>
+void TableIndex<T>::insert(const AllTypeVariant& value, const RowID row_id) {
+  if (variant_is_null(value)) return;
+
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  _tree.insert(Entry{type_cast<T>(value), row_id});
+}
+
+template <typename T>
+void TableIndex<T>::insert_column(const BaseColumn& column, const ChunkID chunk_id) {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&column)) {
+    const auto& values = value_column->values();
+    for (ChunkOffset chunk_offset = 0; chunk_offset < values.size(); ++chunk_offset) {
+      if (value_column->is_null(chunk_offset)) continue;
+      _tree.insert(Entry{values[chunk_offset], RowID{chunk_id, chunk_offset}});
+    }
+  } else if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+    for (ChunkOffset chunk_offset = 0; chunk_offset < dictionary_column->size(); ++chunk_offset) {
+      if (dictionary_column->is_null(chunk_offset)) continue;
+      _tree.insert(Entry{dictionary_column->get(chunk_offset), RowID{chunk_id, chunk_offset}});
+    }
+  } else {
+    Fail("Table indexes can only index ValueColumns and DictionaryColumns");
+  }
+}
+
+template <typename T>
+void TableIndex<T>::remove_chunks(const std::vector<ChunkID>& chunk_ids) {
+  if (chunk_ids.empty()) return;
+
+  // the rows of a chunk are spread over the whole tree, so that every entry is checked against a bitmap of the chunks
+  const auto max_chunk_id = *std::max_element(chunk_ids.cbegin(), chunk_ids.cend());
+  auto is_removed_chunk = std::vector<bool>(max_chunk_id + 1, false);
+  for (const auto& chunk_id : chunk_ids) is_removed_chunk[chunk_id] = true;
+
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  _tree.erase_if([&](const Entry& entry) {
+    return entry.row_id.chunk_id <= max_chunk_id && is_removed_chunk[entry.row_id.chunk_id];
+  });
+}
+
+template <typename T>
+PosList TableIndex<T>::lookup(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  if (variant_is_null(search_value)) return PosList{};
+
+  const auto typed_search_value = type_cast<T>(search_value);
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+
+  PosList row_ids;
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      _append_row_ids(_value_begin(typed_search_value), _value_end(typed_search_value), row_ids);
+      break;
+    case ScanType::OpNotEquals:
+      _append_row_ids(_tree.begin(), _value_begin(typed_search_value), row_ids);
+      _append_row_ids(_value_end(typed_search_value), _tree.end(), row_ids);
+      break;
+    case ScanType::OpLessThan:
+      _append_row_ids(_tree.begin(), _value_begin(typed_search_value), row_ids);
+      break;
+    case ScanType::OpLessThanEquals:
+      _append_row_ids(_tree.begin(), _value_end(typed_search_value), row_ids);
+      break;
+    case ScanType::OpGreaterThan:
+      _append_row_ids(_value_end(typed_search_value), _tree.end(), row_ids);
+      break;
+    case ScanType::OpGreaterThanEquals:
+      _append_row_ids(_value_begin(typed_search_value), _tree.end(), row_ids);
+      break;
+    default:
+      Fail("Unsupported scan type");
+  }
+
+  std::sort(row_ids.begin(), row_ids.end());
+  return row_ids;
+}
+
+template <typename T>
+PosList TableIndex<T>::range_lookup(const AllTypeVariant& lower_value, const AllTypeVariant& upper_value) const {
+  PosList row_ids;
+  if (variant_is_null(lower_value) || variant_is_null(upper_value)) return row_ids;
+
+  const auto typed_lower_value = type_cast<T>(lower_value);
+  const auto typed_upper_value = type_cast<T>(upper_value);
+  if (typed_upper_value < typed_lower_value) return row_ids;
+
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  _append_row_ids(_value_begin(typed_lower_value), _value_end(typed_upper_value), row_ids);
+  std::sort(row_ids.begin(), row_ids.end());
+  return row_ids;
+}
+
+template <typename T>
+size_t TableIndex<T>::size() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return _tree.size();
+}
+
+template <typename T>
+size_t TableIndex<T>::estimate_memory_usage() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  auto memory_usage = _tree.estimate_memory_usage();
+  if constexpr (std::is_same_v<T, std::string>) {
+    for (const auto& entry : _tree) memory_usage += entry.value.capacity();
+  }
+  return memory_usage;
+}
+
+template <typename T>
+typename TableIndex<T>::Tree::Iterator TableIndex<T>::_value_begin(const T& value) const {
+  return _tree.lower_bound(Entry{value, MIN_ROW_ID});
+}
+
+template <typename T>
+typename TableIndex<T>::Tree::Iterator TableIndex<T>::_value_end(const T& value) const {
+  return _tree.lower_bound(Entry{value, MAX_ROW_ID});
+}
+
+template <typename T>
+void TableIndex<T>::_append_row_ids(typename Tree::Iterator begin, const typename Tree::Iterator end,
+                                    PosList& row_ids) {
+  for (; begin != end; ++begin) {
+    row_ids.emplace_back(begin->row_id);
+  }
+}
+
+EXPLICITLY_INSTANTIATE_COLUMN_TYPES(TableIndex);
+
+}  // namespace opossum
@@ -0,0 +1,99 @@
+#pragma once
+
+// the linter wants this to be above everything else
+#include <shared_mutex>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "b_plus_tree/b_plus_tree.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+
+/**
+ * BaseTableIndex is the type-independent interface of TableIndex, an index over one column of a table that spans all
+ * of its chunks (see Table::create_table_index). In contrast to the indexes of a chunk, which have to be probed one by
+ * one, a lookup costs O(log n) regardless of the number of chunks.
+ *
+ * The lookups return the RowIDs of the matching rows in ascending order, i.e., in the order of the table. They may
+ * run concurrently to modifications of the index, e.g., by transactions that insert into an MVCC table. Rows that such
+ * transactions have not committed yet are returned as well and have to be filtered by Validate.
+ */
+class BaseTableIndex : private Noncopyable {
+ public:
+  BaseTableIndex() = default;
+  virtual ~BaseTableIndex() = default;
+
+  // adds a row with the given value. NULL values are not indexed, as no lookup matches them.
+  virtual void insert(const AllTypeVariant& value, RowID row_id) = 0;
+
+  // adds all rows of a column of the chunk chunk_id, which has to be a ValueColumn or a DictionaryColumn
+  virtual void insert_column(const BaseColumn& column, ChunkID chunk_id) = 0;
+
+  // Removes the rows of the given chunks in place. This takes one pass over the index and blocks lookups in the
+  // meantime.
+  virtual void remove_chunks(const std::vector<ChunkID>& chunk_ids) = 0;
+
+  // returns the rows whose value compares to search_value as specified by scan_type
+  virtual PosList lookup(ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+
+  // returns the rows with lower_value <= value <= upper_value
+  virtual PosList range_lookup(const AllTypeVariant& lower_value, const AllTypeVariant& upper_value) const = 0;
+
+  // returns the rows with the value
+  PosList point_lookup(const AllTypeVariant& value) const;
+
+  // returns the number of indexed rows
+  virtual size_t size() const = 0;
+
+  virtual size_t estimate_memory_usage() const = 0;
+
+ protected:
+  // held exclusively by modifications and shared by all other methods
+  mutable std::shared_mutex _mutex;
+};
+
+// A TableIndex stores the pairs of value and RowID of all rows in a B+-tree, sorted by value and RowID.
+template <typename T>
+class TableIndex : public BaseTableIndex {
+ public:
+  void insert(const AllTypeVariant& value, RowID row_id) override;
+  void insert_column(const BaseColumn& column, ChunkID chunk_id) override;
+  void remove_chunks(const std::vector<ChunkID>& chunk_ids) override;
+
+  PosList lookup(ScanType scan_type, const AllTypeVariant& search_value) const override;
+  PosList range_lookup(const AllTypeVariant& lower_value, const AllTypeVariant& upper_value) const override;
+
+  size_t size() const override;
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  struct Entry {
+    T value;
+    RowID row_id;
+
+    bool operator<(const Entry& other) const {
+      if (value < other.value) return true;
+      if (other.value < value) return false;
+      return row_id < other.row_id;
+    }
+  };
+
+  using Tree = BPlusTree<Entry>;
+
+  // returns the first entry with a value >= value or > value
+  typename Tree::Iterator _value_begin(const T& value) const;
+  typename Tree::Iterator _value_end(const T& value) const;
+
+  // appends the RowIDs of the entries in [begin, end) to row_ids
+  static void _append_row_ids(typename Tree::Iterator begin, typename Tree::Iterator end, PosList& row_ids);
+
+  Tree _tree;
+};
+
+}  // namespace opossum
@@ -0,0 +1,70 @@
+#include "numa_memory_resource.hpp"
+
+#if HYRISE_NUMA_SUPPORT
+#include <numa.h>
+#endif
+
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "scheduler/topology.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+NumaMemoryResource::NumaMemoryResource(NodeID node_id, size_t min_allocation_size,
+                                       boost::container::pmr::memory_resource* upstream)
+    : _node_id(node_id), _min_allocation_size(min_allocation_size), _upstream(upstream) {
+  DebugAssert(node_id < Topology::get().node_count(), "Invalid NUMA node");
+#if HYRISE_NUMA_SUPPORT
+  _numa_enabled = Topology::get().node_count() > 1;
+#endif
+}
+
+NumaMemoryResource* NumaMemoryResource::get(NodeID node_id) {
+  static const auto resources = []() {
+    std::vector<std::unique_ptr<NumaMemoryResource>> resources;
+    for (NodeID node{0}; node < Topology::get().node_count(); ++node) {
+      resources.push_back(std::make_unique<NumaMemoryResource>(node));
+    }
+    return resources;
+  }();
+
+  return resources.at(node_id).get();
+}
+
+NodeID NumaMemoryResource::node_id() const { return _node_id; }
+
+bool NumaMemoryResource::_is_node_local(size_t bytes) const { return _numa_enabled && bytes >= _min_allocation_size; }
+
+void* NumaMemoryResource::do_allocate(size_t bytes, size_t alignment) {
+#if HYRISE_NUMA_SUPPORT
+  if (_is_node_local(bytes)) {
+    // numa_alloc_onnode maps whole pages, which satisfies every alignment up to the page size
+    DebugAssert(alignment <= static_cast<size_t>(numa_pagesize()), "Alignment exceeds the page size");
+    auto pointer = numa_alloc_onnode(bytes, Topology::get().numa_node_id(_node_id));
+    if (!pointer) throw std::bad_alloc();
+    return pointer;
+  }
+#endif
+
+  return _upstream->allocate(bytes, alignment);
+}
+
+void NumaMemoryResource::do_deallocate(void* pointer, size_t bytes, size_t alignment) {
+#if HYRISE_NUMA_SUPPORT
+  if (_is_node_local(bytes)) {
+    numa_free(pointer, bytes);
+    return;
+  }
+#endif
+
+  _upstream->deallocate(pointer, bytes, alignment);
+}
+
+bool NumaMemoryResource::do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+}  // namespace opossum
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <cstddef>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// NumaMemoryResource places large allocations on one NUMA node, no matter which thread first touches them. Tables
+// that use the default allocator allocate the columns of each chunk with the resource of the chunk's node (see
+// Table::create_new_chunk), so that rows appended by threads on other nodes still end up on that node.
+// Allocations smaller than min_allocation_size are passed to the upstream resource, because node-local memory is
+// allocated in whole pages. Without NUMA support (see Topology), all allocations are passed upstream.
+class NumaMemoryResource : public boost::container::pmr::memory_resource, private Noncopyable {
+ public:
+  static constexpr size_t DEFAULT_MIN_ALLOCATION_SIZE = 16 * 1024;
+
+  explicit NumaMemoryResource(
+      NodeID node_id, size_t min_allocation_size = DEFAULT_MIN_ALLOCATION_SIZE,
+      boost::container::pmr::memory_resource* upstream = boost::container::pmr::get_default_resource());
+
+  // returns a process-wide resource for the given node with the default settings
+  static NumaMemoryResource* get(NodeID node_id);
+
+  NodeID node_id() const;
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+  bool do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept override;
+
+  bool _is_node_local(size_t bytes) const;
+
+  const NodeID _node_id;
+  const size_t _min_allocation_size;
+  boost::container::pmr::memory_resource* const _upstream;
+  bool _numa_enabled = false;
+};
+
+}  // namespace opossum
@@ -12,6 +12,7 @@
 #include "table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
 #include "value_column.hpp"
 
 namespace opossum {
@@ -22,18 +23,32 @@ class ReferenceColumn : public BaseColumn {
   // creates a reference column
   // the parameters specify the positions and the referenced column
   ReferenceColumn(const std::shared_ptr<const Table> referenced_table, const ColumnID referenced_column_id,
-                  const std::shared_ptr<const PosList> pos);
+                  const std::shared_ptr<const PosList> pos)
+      : _referenced_table(referenced_table), _referenced_column_id(referenced_column_id), _pos_list(pos) {}
 
-  const AllTypeVariant operator[](const size_t i) const override;
+  const AllTypeVariant operator[](const size_t i) const override {
+    PerformanceWarning("operator[] used");
+
+    const auto row_id = _pos_list->at(i);
+    const auto chunk = _referenced_table->get_chunk(row_id.chunk_id);
+    return (*chunk->get_column(_referenced_column_id))[row_id.chunk_offset];
+  }
 
   void append(const AllTypeVariant&) override { throw std::logic_error("ReferenceColumn is immutable"); };
 
-  size_t size() const override;
+  size_t size() const override { return _pos_list->size(); }
+
+  size_t estimate_memory_usage() const override { return sizeof(*this) + _pos_list->capacity() * sizeof(RowID); }
+
+  const std::shared_ptr<const PosList> pos_list() const { return _pos_list; }
+  const std::shared_ptr<const Table> referenced_table() const { return _referenced_table; }
 
-  const std::shared_ptr<const PosList> pos_list() const;
-  const std::shared_ptr<const Table> referenced_table() const;
+  ColumnID referenced_column_id() const { return _referenced_column_id; }
 
-  ColumnID referenced_column_id() const;
+ protected:
+  const std::shared_ptr<const Table> _referenced_table;
+  const ColumnID _referenced_column_id;
+  const std::shared_ptr<const PosList> _pos_list;
 };
 
 }  // namespace opossum
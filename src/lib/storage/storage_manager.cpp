@@ -5,40 +5,46 @@
 #include <utility>
 #include <vector>
 
+#include "buffer_manager.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-StorageManager& StorageManager::get() { throw std::runtime_error("Implement StorageManager::get"); }
-
-void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
-  // Implementation goes here
+StorageManager& StorageManager::get() {
+  static StorageManager instance;
+  return instance;
 }
 
+void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) { _tables[name] = table; }
+
 void StorageManager::drop_table(const std::string& name) {
-  // Implementation goes here
+  const auto num_deleted = _tables.erase(name);
+  Assert(num_deleted == 1, "Table " + name + " does not exist");
 }
 
-std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const {
-  // Implementation goes here
-  return nullptr;
-}
+std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const { return _tables.at(name); }
 
-bool StorageManager::has_table(const std::string& name) const {
-  // Implementation goes here
-  return false;
-}
+bool StorageManager::has_table(const std::string& name) const { return _tables.find(name) != _tables.end(); }
 
 std::vector<std::string> StorageManager::table_names() const {
-  throw std::runtime_error("Implement StorageManager::table_names");
+  std::vector<std::string> table_names;
+  table_names.reserve(_tables.size());
+  for (const auto& [name, table] : _tables) {
+    table_names.push_back(name);
+  }
+  return table_names;
 }
 
 void StorageManager::print(std::ostream& out) const {
-  // Implementation goes here
+  for (const auto& [name, table] : _tables) {
+    out << name << " #columns: " << table->col_count() << " #rows: " << table->row_count()
+        << " #chunks: " << table->chunk_count() << std::endl;
+  }
 }
 
 void StorageManager::reset() {
-  // Implementation goes here;
+  get() = StorageManager();
+  BufferManager::reset();
 }
 
 }  // namespace opossum
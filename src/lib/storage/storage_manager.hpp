@@ -44,6 +44,6 @@ class StorageManager : private Noncopyable {
   StorageManager() {}
   StorageManager& operator=(StorageManager&&) = default;
 
-  // Implementation goes here
+  std::map<std::string, std::shared_ptr<Table>> _tables;
 };
 }  // namespace opossum
@@ -0,0 +1,224 @@
+#include "string_vector.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// lengths in the FrontCoded layout are stored as LEB128 varints, i.e., 7 bits per byte, least significant bits first.
+// Most prefix and suffix lengths take a single byte.
+size_t varint_size(size_t value) {
+  auto size = size_t{1};
+  while (value >= 0x80) {
+    value >>= 7;
+    ++size;
+  }
+  return size;
+}
+
+void write_varint(pmr_vector<char>& chars, size_t value) {
+  while (value >= 0x80) {
+    chars.push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  chars.push_back(static_cast<char>(value));
+}
+
+size_t read_varint(const pmr_vector<char>& chars, size_t& position) {
+  auto value = size_t{0};
+  auto shift = 0u;
+  while (true) {
+    const auto byte = static_cast<uint8_t>(chars[position++]);
+    value |= static_cast<size_t>(byte & 0x7F) << shift;
+    if (byte < 0x80) return value;
+    shift += 7;
+  }
+}
+
+size_t common_prefix_length(const std::string_view lhs, const std::string_view rhs) {
+  const auto length = std::min(lhs.size(), rhs.size());
+  return std::mismatch(lhs.cbegin(), lhs.cbegin() + length, rhs.cbegin()).first - lhs.cbegin();
+}
+
+}  // namespace
+
+StringVector::StringVector(const PolymorphicAllocator<char>& alloc) : _chars(alloc), _offsets(1, 0, alloc) {}
+
+StringVector::StringVector(const Layout layout, const size_t size, const size_t fixed_length,
+                           pmr_vector<char>&& chars, pmr_vector<Offset>&& offsets)
+    : _layout(layout),
+      _size(size),
+      _fixed_length(fixed_length),
+      _chars(std::move(chars)),
+      _offsets(std::move(offsets)) {
+  DebugAssert(_layout != Layout::FixedLength || (_fixed_length > 0 && _chars.size() == _size * _fixed_length),
+              "Invalid FixedLength layout");
+  DebugAssert(_layout != Layout::VariableLength || _offsets.size() == _size + 1, "Invalid VariableLength layout");
+}
+
+void StringVector::_initialize(const std::vector<std::string_view>& strings) {
+  _size = strings.size();
+
+  auto char_count = size_t{0};
+  auto max_length = size_t{0};
+  auto contains_null_character = false;
+  auto front_coded_size = (_size + FRONT_CODING_BLOCK_SIZE - 1) / FRONT_CODING_BLOCK_SIZE * sizeof(Offset);
+  for (size_t i = 0; i < _size; ++i) {
+    const auto string = strings[i];
+    char_count += string.size();
+    max_length = std::max(max_length, string.size());
+    contains_null_character |= string.find('\0') != std::string_view::npos;
+
+    if (i % FRONT_CODING_BLOCK_SIZE == 0) {
+      front_coded_size += varint_size(string.size()) + string.size();
+    } else {
+      const auto prefix_length = common_prefix_length(strings[i - 1], string);
+      const auto suffix_length = string.size() - prefix_length;
+      front_coded_size += varint_size(prefix_length) + varint_size(suffix_length) + suffix_length;
+    }
+  }
+
+  const auto variable_length_size = char_count + (_size + 1) * sizeof(Offset);
+  const auto use_fixed_length =
+      max_length > 0 && !contains_null_character && _size * max_length <= variable_length_size;
+  const auto uncompressed_size = use_fixed_length ? _size * max_length : variable_length_size;
+
+  if (_size > 0 && front_coded_size * 4 <= uncompressed_size * 3) {
+    _layout = Layout::FrontCoded;
+    _chars.reserve(front_coded_size);
+    for (size_t i = 0; i < _size; ++i) {
+      const auto string = strings[i];
+      if (i % FRONT_CODING_BLOCK_SIZE == 0) {
+        Assert(_chars.size() <= std::numeric_limits<Offset>::max(), "StringVector cannot address more than 4 GB");
+        _offsets.push_back(static_cast<Offset>(_chars.size()));
+        write_varint(_chars, string.size());
+        _chars.insert(_chars.end(), string.cbegin(), string.cend());
+      } else {
+        const auto prefix_length = common_prefix_length(strings[i - 1], string);
+        write_varint(_chars, prefix_length);
+        write_varint(_chars, string.size() - prefix_length);
+        _chars.insert(_chars.end(), string.cbegin() + prefix_length, string.cend());
+      }
+    }
+    _chars.shrink_to_fit();
+    return;
+  }
+
+  if (use_fixed_length) {
+    _layout = Layout::FixedLength;
+    _fixed_length = max_length;
+    _chars.resize(_size * max_length, '\0');
+    for (size_t i = 0; i < _size; ++i) {
+      std::copy(strings[i].cbegin(), strings[i].cend(), _chars.begin() + i * max_length);
+    }
+    return;
+  }
+
+  Assert(char_count <= std::numeric_limits<Offset>::max(), "StringVector cannot address more than 4 GB");
+  _layout = Layout::VariableLength;
+  _chars.reserve(char_count);
+  _offsets.reserve(_size + 1);
+  for (const auto& string : strings) {
+    _offsets.push_back(static_cast<Offset>(_chars.size()));
+    _chars.insert(_chars.end(), string.cbegin(), string.cend());
+  }
+  _offsets.push_back(static_cast<Offset>(_chars.size()));
+}
+
+std::string StringVector::operator[](const size_t i) const {
+  if (_layout != Layout::FrontCoded) return std::string{_plain_string(i)};
+
+  std::string string;
+  auto position = size_t{_offsets[i / FRONT_CODING_BLOCK_SIZE]};
+  for (size_t block_index = 0; block_index <= i % FRONT_CODING_BLOCK_SIZE; ++block_index) {
+    _decode_next(position, block_index == 0, string);
+  }
+  return string;
+}
+
+std::string StringVector::at(const size_t i) const {
+  if (i >= _size) throw std::out_of_range("StringVector index " + std::to_string(i) + " is out of range");
+  return (*this)[i];
+}
+
+size_t StringVector::lower_bound(const std::string_view value) const {
+  return _partition_point([&](const std::string_view string) { return string >= value; });
+}
+
+size_t StringVector::upper_bound(const std::string_view value) const {
+  return _partition_point([&](const std::string_view string) { return string > value; });
+}
+
+std::string_view StringVector::_plain_string(const size_t i) const {
+  if (_layout == Layout::FixedLength) {
+    const auto begin = _chars.data() + i * _fixed_length;
+    return std::string_view{begin, static_cast<size_t>(std::find(begin, begin + _fixed_length, '\0') - begin)};
+  }
+  return std::string_view{_chars.data() + _offsets[i], _offsets[i + 1] - _offsets[i]};
+}
+
+std::string_view StringVector::_block_header(const size_t block) const {
+  auto position = size_t{_offsets[block]};
+  const auto length = read_varint(_chars, position);
+  return std::string_view{_chars.data() + position, length};
+}
+
+void StringVector::_decode_next(size_t& position, const bool is_block_header, std::string& string) const {
+  if (is_block_header) {
+    const auto length = read_varint(_chars, position);
+    string.assign(_chars.data() + position, length);
+    position += length;
+    return;
+  }
+
+  const auto prefix_length = read_varint(_chars, position);
+  const auto suffix_length = read_varint(_chars, position);
+  string.resize(prefix_length);
+  string.append(_chars.data() + position, suffix_length);
+  position += suffix_length;
+}
+
+template <typename Predicate>
+size_t StringVector::_partition_point(const Predicate& predicate) const {
+  const auto partition_point = [](size_t begin, size_t end, const auto& is_behind) {
+    while (begin < end) {
+      const auto middle = begin + (end - begin) / 2;
+      if (is_behind(middle)) {
+        end = middle;
+      } else {
+        begin = middle + 1;
+      }
+    }
+    return begin;
+  };
+
+  if (_layout != Layout::FrontCoded) {
+    return partition_point(0, _size, [&](const size_t i) { return predicate(_plain_string(i)); });
+  }
+
+  // The first strings of the blocks are stored completely, so the blocks are found by binary search. Only the block
+  // in front of the first block whose first string satisfies the predicate has to be decoded.
+  const auto block_count = _offsets.size();
+  const auto block = partition_point(0, block_count, [&](const size_t i) { return predicate(_block_header(i)); });
+  if (block == 0) return 0;
+
+  std::string string;
+  auto position = size_t{_offsets[block - 1]};
+  const auto begin = (block - 1) * FRONT_CODING_BLOCK_SIZE;
+  const auto end = std::min(_size, block * FRONT_CODING_BLOCK_SIZE);
+  for (auto i = begin; i < end; ++i) {
+    _decode_next(position, i == begin, string);
+    if (i > begin && predicate(std::string_view{string})) return i;
+  }
+  return end;
+}
+
+}  // namespace opossum
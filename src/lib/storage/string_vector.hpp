@@ -0,0 +1,158 @@
+#pragma once
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// StringVector is an immutable, sorted sequence of strings that are stored back to back in one character buffer. A
+// pmr_vector<std::string> takes 32 bytes per string and allocates every string that does not fit into these bytes
+// separately, which is why the string dictionaries of DictionaryColumns use a StringVector instead. ValueColumns keep
+// their std::strings, as they are appended to (see ValueColumn).
+//
+// The strings are laid out in one of three ways:
+// - VariableLength: the strings are concatenated, and offsets[i] marks where string i starts. offsets has one entry
+//   more than there are strings, so that string i ends at offsets[i + 1].
+// - FixedLength: every string takes fixed_length characters and is padded with '\0'. This suits short codes of
+//   similar length (e.g., "MAIL", "SHIP") that would otherwise pay four bytes per offset. Strings that contain '\0'
+//   are never stored with fixed length.
+// - FrontCoded: the strings are split into blocks of FRONT_CODING_BLOCK_SIZE strings, and offsets[b] marks where block
+//   b starts. The first string of a block is stored completely, every other string only as the length of the prefix
+//   it shares with its predecessor and the remaining suffix. This pays off for sorted values with long common
+//   prefixes, such as URLs or paths, but accessing a string means decoding its block up to the string.
+// The two uncompressed layouts are chosen by size. FrontCoded is only chosen if it saves at least a quarter of the
+// smaller one, as it makes random accesses slower.
+//
+// As the strings are sorted, lower_bound and upper_bound binary search the buffer without decoding every string.
+class StringVector {
+ public:
+  using Offset = uint32_t;
+
+  enum class Layout : uint8_t { VariableLength, FixedLength, FrontCoded };
+
+  static constexpr auto FRONT_CODING_BLOCK_SIZE = size_t{16};
+
+  class Iterator
+      : public boost::iterator_facade<Iterator, std::string, std::random_access_iterator_tag, std::string> {
+   public:
+    Iterator() = default;
+    Iterator(const StringVector* strings, const size_t index) : _strings(strings), _index(index) {}
+
+   private:
+    friend class boost::iterator_core_access;
+
+    std::string dereference() const { return (*_strings)[_index]; }
+    bool equal(const Iterator& other) const { return _index == other._index; }
+    void increment() { ++_index; }
+    void decrement() { --_index; }
+    void advance(const std::ptrdiff_t n) { _index += n; }
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._index) - static_cast<std::ptrdiff_t>(_index);
+    }
+
+    const StringVector* _strings = nullptr;
+    size_t _index = 0;
+  };
+
+  explicit StringVector(const PolymorphicAllocator<char>& alloc = {});
+
+  // copies the strings of the range, which have to be sorted and convertible to std::string_view, into the buffer
+  template <typename InputIterator>
+  StringVector(const InputIterator begin, const InputIterator end, const PolymorphicAllocator<char>& alloc = {})
+      : _chars(alloc), _offsets(alloc) {
+    std::vector<std::string_view> strings;
+    for (auto it = begin; it != end; ++it) strings.emplace_back(*it);
+    _initialize(strings);
+  }
+
+  // takes ownership of the buffers of another StringVector (see layout, chars, and offsets), e.g., when reading it
+  // back from disk
+  StringVector(Layout layout, size_t size, size_t fixed_length, pmr_vector<char>&& chars, pmr_vector<Offset>&& offsets);
+
+  // returns a copy of string i. Use for_each to visit all strings.
+  std::string operator[](size_t i) const;
+  std::string at(size_t i) const;
+
+  std::string front() const { return (*this)[0]; }
+  std::string back() const { return (*this)[_size - 1]; }
+
+  size_t size() const { return _size; }
+  bool empty() const { return _size == 0; }
+
+  Iterator begin() const { return Iterator{this, 0}; }
+  Iterator end() const { return Iterator{this, _size}; }
+  Iterator cbegin() const { return begin(); }
+  Iterator cend() const { return end(); }
+
+  // return the index of the first string >= (lower_bound) or > (upper_bound) the value, or size() if there is none
+  size_t lower_bound(std::string_view value) const;
+  size_t upper_bound(std::string_view value) const;
+
+  // calls functor(index, string_view) for every string in order. The string_views are only valid during the call.
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    if (_layout != Layout::FrontCoded) {
+      for (size_t i = 0; i < _size; ++i) functor(i, _plain_string(i));
+      return;
+    }
+
+    std::string string;
+    for (size_t block = 0; block * FRONT_CODING_BLOCK_SIZE < _size; ++block) {
+      auto position = size_t{_offsets[block]};
+      const auto block_end = std::min(_size, (block + 1) * FRONT_CODING_BLOCK_SIZE);
+      for (auto i = block * FRONT_CODING_BLOCK_SIZE; i < block_end; ++i) {
+        _decode_next(position, i % FRONT_CODING_BLOCK_SIZE == 0, string);
+        functor(i, std::string_view{string});
+      }
+    }
+  }
+
+  Layout layout() const { return _layout; }
+
+  // returns the length that every string is padded to if the layout is FixedLength, 0 otherwise
+  size_t fixed_length() const { return _fixed_length; }
+
+  // the underlying buffers. offsets is empty if the layout is FixedLength.
+  const pmr_vector<char>& chars() const { return _chars; }
+  const pmr_vector<Offset>& offsets() const { return _offsets; }
+
+  PolymorphicAllocator<char> get_allocator() const { return _chars.get_allocator(); }
+
+  size_t estimate_memory_usage() const {
+    return sizeof(*this) + _chars.capacity() + _offsets.capacity() * sizeof(Offset);
+  }
+
+ protected:
+  void _initialize(const std::vector<std::string_view>& strings);
+
+  // returns string i of the VariableLength or FixedLength layout
+  std::string_view _plain_string(size_t i) const;
+
+  // returns the first string of a block of the FrontCoded layout, which is stored completely
+  std::string_view _block_header(size_t block) const;
+
+  // decodes the string at position into string, which has to hold its predecessor unless it is the first of its
+  // block, and moves position to the next string
+  void _decode_next(size_t& position, bool is_block_header, std::string& string) const;
+
+  // returns the index of the first string that satisfies the predicate, which has to be false for the strings before
+  // and true for the strings behind it
+  template <typename Predicate>
+  size_t _partition_point(const Predicate& predicate) const;
+
+  Layout _layout = Layout::VariableLength;
+  size_t _size = 0;
+  size_t _fixed_length = 0;
+  pmr_vector<char> _chars;
+  pmr_vector<Offset> _offsets;
+};
+
+}  // namespace opossum
@@ -5,79 +5,316 @@
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "buffer_manager.hpp"
+#include "dictionary_column.hpp"
+#include "index/table_index.hpp"
+#include "numa_memory_resource.hpp"
 #include "value_column.hpp"
 
 #include "resolve_type.hpp"
+#include "scheduler/topology.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-void Table::add_column_definition(const std::string& name, const std::string& type) {
-  // Implementation goes here
+Table::Table(const uint32_t chunk_size, const PolymorphicAllocator<size_t>& alloc, const UseMvcc use_mvcc)
+    : _chunk_size(chunk_size),
+      _alloc(alloc),
+      _use_mvcc(use_mvcc),
+      _chunks_mutex(std::make_unique<std::shared_mutex>()),
+      _append_mutex(std::make_unique<std::mutex>()) {
+  Assert(use_mvcc == UseMvcc::No || chunk_size > 0, "MVCC tables need a maximum chunk size");
+
+  auto chunk = std::make_shared<Chunk>(_next_numa_node, _chunk_allocator(_next_numa_node));
+  if (use_mvcc == UseMvcc::Yes) chunk->set_mvcc_columns(std::make_shared<Chunk::MvccColumns>(_chunk_size));
+  _chunks.push_back(chunk);
+}
+
+void Table::add_column_definition(const std::string& name, const std::string& type, const bool nullable) {
+  _column_names.push_back(name);
+  _column_types.push_back(type);
+  _column_nullables.push_back(nullable);
 }
 
-void Table::add_column(const std::string& name, const std::string& type) {
-  // Implementation goes here
+void Table::add_column(const std::string& name, const std::string& type, const bool nullable) {
+  DebugAssert(row_count() == 0, "Columns can only be added to empty tables");
+
+  add_column_definition(name, type, nullable);
+  std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
+  for (auto& chunk : _chunks) {
+    chunk->add_column(_create_value_column(type, nullable, chunk->get_allocator()));
+  }
 }
 
 void Table::append(std::vector<AllTypeVariant> values) {
-  // Implementation goes here
+  std::lock_guard<std::mutex> lock(*_append_mutex);
+
+  if (_chunk_size > 0 && _chunks.back()->size() >= _chunk_size) create_new_chunk();
+
+  const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_count() - 1)};
+  auto& chunk = *_chunk_ptr(chunk_id);
+  chunk.append(values);
+
+  const auto row_id = RowID{chunk_id, chunk.size() - 1};
+  if (_use_mvcc == UseMvcc::Yes) chunk.mvcc_columns()->begin_cids[row_id.chunk_offset] = 0;
+
+  for (const auto& column_id_and_index : _table_indices) {
+    column_id_and_index.second->insert(values[column_id_and_index.first], row_id);
+  }
 }
 
-void Table::create_new_chunk() {
-  // Implementation goes here
+PosList Table::append_uncommitted(const std::vector<std::vector<AllTypeVariant>>& rows,
+                                  const TransactionID transaction_id) {
+  Assert(_use_mvcc == UseMvcc::Yes, "Only MVCC tables can be modified by transactions");
+  std::lock_guard<std::mutex> lock(*_append_mutex);
+
+  PosList row_ids;
+  row_ids.reserve(rows.size());
+  for (const auto& values : rows) {
+    if (_chunk_ptr(ChunkID{static_cast<ChunkID::base_type>(chunk_count() - 1)})->size() >= _chunk_size) {
+      create_new_chunk();
+    }
+
+    const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_count() - 1)};
+    auto& chunk = *_chunk_ptr(chunk_id);
+    const auto row_id = RowID{chunk_id, chunk.size()};
+
+    // the row stays invisible to other transactions, as its begin CommitID is MAX_COMMIT_ID until the commit
+    chunk.mvcc_columns()->tids[row_id.chunk_offset] = transaction_id;
+    chunk.append(values);
+
+    for (const auto& column_id_and_index : _table_indices) {
+      column_id_and_index.second->insert(values[column_id_and_index.first], row_id);
+    }
+    row_ids.push_back(row_id);
+  }
+
+  return row_ids;
+}
+
+ChunkID Table::append_uncommitted_chunk(Chunk chunk, const TransactionID transaction_id,
+                                        const std::optional<ChunkID> released_chunk_id) {
+  Assert(_use_mvcc == UseMvcc::Yes, "Only MVCC tables can be modified by transactions");
+  Assert(chunk.col_count() == col_count(), "The chunk does not have the columns of the table");
+
+  auto mvcc_columns = std::make_shared<Chunk::MvccColumns>(chunk.size());
+  for (ChunkOffset chunk_offset = 0; chunk_offset < chunk.size(); ++chunk_offset) {
+    mvcc_columns->tids[chunk_offset] = transaction_id;
+  }
+  chunk.set_mvcc_columns(std::move(mvcc_columns));
+  const auto appended_chunk = std::make_shared<Chunk>(std::move(chunk));
+  BufferManager::get().register_chunk(appended_chunk, _column_types);
+
+  std::lock_guard<std::mutex> append_lock(*_append_mutex);
+  auto chunk_id = ChunkID{0};
+  if (released_chunk_id) {
+    std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
+    Assert(*released_chunk_id + 1u < _chunks.size() && _chunks[*released_chunk_id]->size() == 0 &&
+               _chunks[*released_chunk_id]->mvcc_columns()->capacity() == 0,
+           "Only released chunks can be replaced");
+    _chunks[*released_chunk_id] = appended_chunk;
+    chunk_id = *released_chunk_id;
+  } else {
+    {
+      std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
+      if (_chunks.back()->size() == 0) {
+        _chunks.back() = appended_chunk;
+      } else {
+        _chunks.push_back(appended_chunk);
+      }
+      chunk_id = ChunkID{static_cast<ChunkID::base_type>(_chunks.size() - 1)};
+    }
+    create_new_chunk();
+  }
+
+  for (const auto& column_id_and_index : _table_indices) {
+    column_id_and_index.second->insert_column(*get_chunk(chunk_id)->get_column(column_id_and_index.first), chunk_id);
+  }
+
+  return chunk_id;
+}
+
+void Table::release_chunks(const std::vector<ChunkID>& chunk_ids) {
+  if (chunk_ids.empty()) return;
+
+  // modifications of the table indexes are serialized by the append mutex
+  std::lock_guard<std::mutex> append_lock(*_append_mutex);
+  for (const auto& chunk_id : chunk_ids) {
+    const auto chunk = _chunk_ptr(chunk_id);
+
+    auto released_chunk = std::make_shared<Chunk>(chunk->numa_node(), chunk->get_allocator());
+    for (ColumnID column_id{0}; column_id < col_count(); ++column_id) {
+      released_chunk->add_column(make_shared_by_column_type<BaseColumn, ValueColumn>(
+          _column_types[column_id], _column_nullables[column_id], chunk->get_allocator()));
+    }
+    if (_use_mvcc == UseMvcc::Yes) released_chunk->set_mvcc_columns(std::make_shared<Chunk::MvccColumns>(0));
+
+    std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
+    _chunks[chunk_id] = released_chunk;
+  }
+
+  for (const auto& column_id_and_index : _table_indices) {
+    column_id_and_index.second->remove_chunks(chunk_ids);
+  }
 }
 
-uint16_t Table::col_count() const {
-  // Implementation goes here
-  return 0;
+void Table::create_new_chunk() {
+  _next_numa_node = (_next_numa_node + 1) % Topology::get().node_count();
+
+  auto chunk = std::make_shared<Chunk>(_next_numa_node, _chunk_allocator(_next_numa_node));
+  for (ColumnID column_id{0}; column_id < col_count(); ++column_id) {
+    chunk->add_column(
+        _create_value_column(_column_types[column_id], _column_nullables[column_id], chunk->get_allocator()));
+  }
+  if (_use_mvcc == UseMvcc::Yes) chunk->set_mvcc_columns(std::make_shared<Chunk::MvccColumns>(_chunk_size));
+
+  std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
+  _chunks.push_back(chunk);
 }
 
+uint16_t Table::col_count() const { return static_cast<uint16_t>(_column_names.size()); }
+
+bool Table::uses_mvcc() const { return _use_mvcc == UseMvcc::Yes; }
+
 uint64_t Table::row_count() const {
-  // Implementation goes here
-  return 0;
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  uint64_t row_count = 0;
+  for (const auto& chunk : _chunks) {
+    row_count += chunk->size();
+  }
+  return row_count;
+}
+
+uint64_t Table::approx_valid_row_count() const {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  uint64_t row_count = 0;
+  for (const auto& chunk : _chunks) {
+    row_count += chunk->size() - chunk->invalid_row_count();
+  }
+  return row_count;
 }
 
 ChunkID Table::chunk_count() const {
-  // Implementation goes here
-  return ChunkID{0};
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  return ChunkID{static_cast<ChunkID::base_type>(_chunks.size())};
 }
 
 ColumnID Table::column_id_by_name(const std::string& column_name) const {
-  // Implementation goes here
-  return ColumnID{0};
+  const auto it = std::find(_column_names.cbegin(), _column_names.cend(), column_name);
+  Assert(it != _column_names.cend(), "Column " + column_name + " not found");
+  return ColumnID{static_cast<ColumnID::base_type>(std::distance(_column_names.cbegin(), it))};
 }
 
-uint32_t Table::chunk_size() const {
-  // Implementation goes here
-  return 0;
+uint32_t Table::chunk_size() const { return _chunk_size; }
+
+const std::vector<std::string>& Table::column_names() const { return _column_names; }
+
+const std::string& Table::column_name(ColumnID column_id) const { return _column_names.at(column_id); }
+
+const std::string& Table::column_type(ColumnID column_id) const { return _column_types.at(column_id); }
+
+bool Table::column_is_nullable(ColumnID column_id) const { return _column_nullables.at(column_id); }
+
+std::shared_ptr<Chunk> Table::get_chunk(ChunkID chunk_id) { return BufferManager::get().pin(_chunk_ptr(chunk_id)); }
+
+std::shared_ptr<const Chunk> Table::get_chunk(ChunkID chunk_id) const {
+  return BufferManager::get().pin(_chunk_ptr(chunk_id));
 }
 
-const std::vector<std::string>& Table::column_names() const {
-  throw std::runtime_error("Implement Table::column_names()");
+std::shared_ptr<const Chunk> Table::get_unpinned_chunk(ChunkID chunk_id) const { return _chunk_ptr(chunk_id); }
+
+NodeID Table::chunk_numa_node(ChunkID chunk_id) const { return _chunk_ptr(chunk_id)->numa_node(); }
+
+void Table::emplace_chunk(Chunk chunk) {
+  std::lock_guard<std::mutex> append_lock(*_append_mutex);
+
+  if (_use_mvcc == UseMvcc::Yes && !chunk.has_mvcc_columns()) {
+    auto mvcc_columns = std::make_shared<Chunk::MvccColumns>(std::max(chunk.size(), _chunk_size));
+    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk.size(); ++chunk_offset) {
+      mvcc_columns->begin_cids[chunk_offset] = 0;
+    }
+    chunk.set_mvcc_columns(std::move(mvcc_columns));
+  }
+
+  const auto emplaced_chunk = std::make_shared<Chunk>(std::move(chunk));
+  auto chunk_id = ChunkID{0};
+  {
+    std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
+    if (_chunks.size() == 1 && _chunks.front()->size() == 0) {
+      _chunks.front() = emplaced_chunk;
+    } else {
+      _chunks.push_back(emplaced_chunk);
+    }
+    chunk_id = ChunkID{static_cast<ChunkID::base_type>(_chunks.size() - 1)};
+  }
+
+  for (const auto& column_id_and_index : _table_indices) {
+    column_id_and_index.second->insert_column(*emplaced_chunk->get_column(column_id_and_index.first), chunk_id);
+  }
 }
 
-const std::string& Table::column_name(ColumnID column_id) const {
-  throw std::runtime_error("Implement Table::column_name");
+std::shared_ptr<const BaseTableIndex> Table::create_table_index(const ColumnID column_id) {
+  Assert(column_id < col_count(), "Column " + std::to_string(column_id) + " does not exist");
+
+  const auto table_index = make_shared_by_column_type<BaseTableIndex, TableIndex>(column_type(column_id));
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count(); ++chunk_id) {
+    table_index->insert_column(*get_chunk(chunk_id)->get_column(column_id), chunk_id);
+  }
+
+  _table_indices.emplace_back(column_id, table_index);
+  return table_index;
 }
 
-const std::string& Table::column_type(ColumnID column_id) const {
-  throw std::runtime_error("Implement Table::column_type");
+std::shared_ptr<const BaseTableIndex> Table::get_table_index(const ColumnID column_id) const {
+  for (const auto& column_id_and_index : _table_indices) {
+    if (column_id_and_index.first == column_id) return column_id_and_index.second;
+  }
+  return nullptr;
 }
 
-Chunk& Table::get_chunk(ChunkID chunk_id) { throw std::runtime_error("Implement Table::get_chunk"); }
+void Table::compress_chunk(ChunkID chunk_id) {
+  const auto chunk = get_chunk(chunk_id);
 
-const Chunk& Table::get_chunk(ChunkID chunk_id) const { throw std::runtime_error("Implement Table::get_chunk"); }
+  // the dictionaries and attribute vectors are built on the chunk's node and allocated with the chunk's allocator,
+  // which places them on that node unless the table uses a custom allocator
+  Chunk compressed_chunk(chunk->numa_node(), chunk->get_allocator());
+  Topology::get().run_on_node(chunk->numa_node(), [&]() {
+    for (ColumnID column_id{0}; column_id < col_count(); ++column_id) {
+      compressed_chunk.add_column(make_shared_by_column_type<BaseColumn, DictionaryColumn>(
+          column_type(column_id), chunk->get_column(column_id), chunk->get_allocator()));
+    }
+  });
+  if (chunk->has_mvcc_columns()) compressed_chunk.set_mvcc_columns(chunk->mvcc_columns());
 
-void emplace_chunk(Chunk chunk) {
-  // Implementation goes here
+  // compressed chunks are immutable and may therefore be spilled to disk. Operators that still hold the uncompressed
+  // chunk keep it alive until they are done.
+  const auto compressed_chunk_ptr = std::make_shared<Chunk>(std::move(compressed_chunk));
+  BufferManager::get().register_chunk(compressed_chunk_ptr, _column_types);
+
+  std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
+  _chunks[chunk_id] = compressed_chunk_ptr;
+}
+
+std::shared_ptr<BaseColumn> Table::_create_value_column(const std::string& type, const bool nullable,
+                                                        const PolymorphicAllocator<size_t>& alloc) const {
+  if (_use_mvcc == UseMvcc::No) return make_shared_by_column_type<BaseColumn, ValueColumn>(type, nullable, alloc);
+  return make_shared_by_column_type<BaseColumn, ValueColumn>(type, static_cast<size_t>(_chunk_size), alloc, nullable);
 }
 
-void Table::compress_chunk(ChunkID chunk_id) { throw std::runtime_error("TODO"); }
+PolymorphicAllocator<size_t> Table::_chunk_allocator(const NodeID numa_node) const {
+  if (_alloc.resource() != boost::container::pmr::get_default_resource()) return _alloc;
+  return PolymorphicAllocator<size_t>(NumaMemoryResource::get(numa_node));
+}
+
+std::shared_ptr<Chunk> Table::_chunk_ptr(const ChunkID chunk_id) const {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  return _chunks.at(chunk_id);
+}
 
 }  // namespace opossum
@@ -1,8 +1,12 @@
 #pragma once
 
+// the linter wants this to be above everything else
+#include <shared_mutex>
+
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -16,6 +20,7 @@
 
 namespace opossum {
 
+class BaseTableIndex;
 class TableStatistics;
 
 // A table is partitioned horizontally into a number of chunks
@@ -24,7 +29,10 @@ class Table : private Noncopyable {
   // creates a table
   // the parameter specifies the maximum chunk size, i.e., partition size
   // default (0) is an unlimited size. A table holds always at least one chunk
-  explicit Table(const uint32_t chunk_size = 0);
+  // All columns of the table are allocated using alloc, which can be constructed from a memory resource.
+  // The chunks of MVCC tables have MVCC columns (see Chunk::MvccColumns), which requires a maximum chunk size.
+  explicit Table(const uint32_t chunk_size = 0, const PolymorphicAllocator<size_t>& alloc = {},
+                 UseMvcc use_mvcc = UseMvcc::No);
 
   // we need to explicitly set the move constructor to default when
   // we overwrite the copy constructor
@@ -34,19 +42,34 @@ class Table : private Noncopyable {
   // returns the number of columns (cannot exceed ColumnID (uint16_t))
   uint16_t col_count() const;
 
+  // returns whether the table keeps MVCC information for its rows
+  bool uses_mvcc() const;
+
   // Returns the number of rows.
   // This number includes invalidated (deleted) rows.
   // Use approx_valid_row_count() for an approximate count of valid rows instead.
   uint64_t row_count() const;
 
+  // Returns the number of rows minus the invalid rows of MVCC tables (see Chunk::invalid_row_count). This does not
+  // look at the rows and does not depend on a transaction: rows that are being inserted or deleted count as valid.
+  uint64_t approx_valid_row_count() const;
+
   // returns the number of chunks (cannot exceed ChunkID (uint32_t))
   ChunkID chunk_count() const;
 
-  // returns the chunk with the given id
-  Chunk& get_chunk(ChunkID chunk_id);
-  const Chunk& get_chunk(ChunkID chunk_id) const;
+  // Returns the chunk with the given id. Spilled chunks are loaded, and the chunk is pinned in memory until the
+  // returned pointer and all its copies are destroyed (see BufferManager::pin). Holding the pointer also keeps the
+  // chunk alive if the table replaces it in the meantime, e.g., in compress_chunk.
+  std::shared_ptr<Chunk> get_chunk(ChunkID chunk_id);
+  std::shared_ptr<const Chunk> get_chunk(ChunkID chunk_id) const;
+
+  // Returns the chunk without loading or pinning it, for bookkeeping that must not touch spilled chunks (e.g., the
+  // performance data of AbstractOperator). As the chunk may be spilled at any time, its columns have to be read with
+  // Chunk::get_column_if_loaded.
+  std::shared_ptr<const Chunk> get_unpinned_chunk(ChunkID chunk_id) const;
 
   // Adds a chunk to the table. If the first chunk is empty, it is replaced.
+  // In MVCC tables, chunks without MVCC columns get ones in which all rows are visible.
   void emplace_chunk(Chunk chunk);
 
   // Returns a list of all column names.
@@ -58,6 +81,9 @@ class Table : private Noncopyable {
   // returns the column type of the nth column
   const std::string& column_type(ColumnID column_id) const;
 
+  // returns whether the nth column may hold NULL values
+  bool column_is_nullable(ColumnID column_id) const;
+
   // Returns the column with the given name.
   // This method is intended for debugging purposes only.
   // It does not verify whether a column name is unambiguous.
@@ -69,23 +95,87 @@ class Table : private Noncopyable {
   // adds column definition without creating the actual columns
   // this is helpful when, e.g., an operator first creates the structure of the table
   // and then adds chunk by chunk
-  void add_column_definition(const std::string& name, const std::string& type);
+  void add_column_definition(const std::string& name, const std::string& type, bool nullable = false);
 
   // adds a column to the end, i.e., right, of the table
   // the added column should have the same length as existing columns (if any)
-  void add_column(const std::string& name, const std::string& type);
+  // Only nullable columns accept NULL values.
+  void add_column(const std::string& name, const std::string& type, bool nullable = false);
 
-  // inserts a row at the end of the table
+  // inserts a row at the end of the table and into the table indexes
   // note this is slow and not thread-safe and should be used for testing purposes only
+  // In MVCC tables, the row is visible to all transactions, as if it had been committed before they started.
   void append(std::vector<AllTypeVariant> values);
 
+  // Appends rows on behalf of the transaction transaction_id (see Insert) and returns their RowIDs. The rows are
+  // invisible to other transactions until their begin CommitIDs are set on commit. Appends are serialized, but the
+  // table can be read in the meantime, as the mutable chunk's columns are allocated for chunk_size rows upfront.
+  // Rows that are being appended may be present in some columns but not yet in others, which is why transactions
+  // have to filter the rows of MVCC tables with Validate before they read a second column.
+  PosList append_uncommitted(const std::vector<std::vector<AllTypeVariant>>& rows, TransactionID transaction_id);
+
+  // Adds an immutable chunk of DictionaryColumns on behalf of the transaction transaction_id and returns its ChunkID.
+  // Like the rows of append_uncommitted, its rows are invisible to other transactions until their begin CommitIDs are
+  // set on commit. If released_chunk_id is given, the chunk takes the place of that released chunk, whose RowIDs must
+  // not be held by any transaction anymore. Otherwise, it is placed behind the mutable chunk, which stays partially
+  // filled unless it is empty, and a new mutable chunk is created behind it. Used by the ChunkCompactor.
+  ChunkID append_uncommitted_chunk(Chunk chunk, TransactionID transaction_id,
+                                   std::optional<ChunkID> released_chunk_id = std::nullopt);
+
+  // Replaces the chunks by empty ones and removes their rows from the table indexes, so that their memory is freed once
+  // no operator holds on to their columns anymore. The chunk ids of the other chunks do not change. Pipelines release
+  // the chunks of their intermediate tables once these are consumed. In MVCC tables, the rows of the chunks must not be
+  // visible to any transaction anymore (see ChunkCompactor), and the empty chunks get empty MVCC columns. Validate
+  // filters the RowIDs of released chunks that active transactions obtained before, which is why a released chunk id
+  // may only be reused by append_uncommitted_chunk once these transactions have ended.
+  void release_chunks(const std::vector<ChunkID>& chunk_ids);
+
   // creates a new chunk and appends it
+  // chunks are placed on the NUMA nodes in a round-robin fashion. Unless the table uses a custom allocator, their
+  // columns are allocated on that node (see NumaMemoryResource).
   void create_new_chunk();
 
   // compresses a ValueColumn into a DictionaryColumn
+  // the compressed columns are allocated on the chunk's NUMA node
   void compress_chunk(ChunkID chunk_id);
 
+  // Creates an index over the column that spans all chunks (see BaseTableIndex) and indexes the existing rows.
+  // Rows added by append or emplace_chunk are indexed as well. Compressing or spilling chunks does not change the
+  // RowIDs, so the index stays valid. The table must consist of ValueColumns and DictionaryColumns.
+  // Like append, creating the index is not thread-safe. Lookups into the index may run concurrently to modifications
+  // of the table, see BaseTableIndex.
+  std::shared_ptr<const BaseTableIndex> create_table_index(ColumnID column_id);
+
+  // returns the table index over the column, or nullptr if there is none
+  std::shared_ptr<const BaseTableIndex> get_table_index(ColumnID column_id) const;
+
+  // returns the NUMA node of a chunk. Unlike get_chunk(chunk_id)->numa_node(), this does not load spilled chunks.
+  NodeID chunk_numa_node(ChunkID chunk_id) const;
+
  protected:
-  // Implementation goes here
+  // creates an empty ValueColumn that holds up to _chunk_size values without reallocation if the table uses MVCC
+  std::shared_ptr<BaseColumn> _create_value_column(const std::string& type, bool nullable,
+                                                   const PolymorphicAllocator<size_t>& alloc) const;
+
+  // returns the allocator for the columns of a chunk on the given node: the table's allocator if it is a custom one,
+  // otherwise one that allocates memory on the node
+  PolymorphicAllocator<size_t> _chunk_allocator(NodeID numa_node) const;
+
+  // returns the chunk without loading it if it is spilled
+  std::shared_ptr<Chunk> _chunk_ptr(ChunkID chunk_id) const;
+
+  uint32_t _chunk_size;
+  PolymorphicAllocator<size_t> _alloc;
+  UseMvcc _use_mvcc;
+  NodeID _next_numa_node = 0;
+  std::vector<std::shared_ptr<Chunk>> _chunks;
+  // Guards _chunks, which MVCC tables extend while they are read. Appends are serialized by _append_mutex. Both are
+  // held by pointer, so that the table stays movable.
+  std::unique_ptr<std::shared_mutex> _chunks_mutex;
+  std::unique_ptr<std::mutex> _append_mutex;
+  std::vector<std::string> _column_names;
+  std::vector<std::string> _column_types;
+  std::vector<bool> _column_nullables;
+  std::vector<std::pair<ColumnID, std::shared_ptr<BaseTableIndex>>> _table_indices;
 };
 }  // namespace opossum
@@ -1,5 +1,7 @@
 #include "value_column.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -13,22 +15,83 @@
 
 namespace opossum {
 
+template <typename T>
+ValueColumn<T>::ValueColumn(const PolymorphicAllocator<T>& alloc) : _values(alloc), _null_words(alloc) {}
+
+template <typename T>
+ValueColumn<T>::ValueColumn(const bool nullable, const PolymorphicAllocator<T>& alloc)
+    : _values(alloc), _nullable(nullable), _null_words(alloc) {}
+
+template <typename T>
+ValueColumn<T>::ValueColumn(const size_t capacity, const PolymorphicAllocator<T>& alloc, const bool nullable)
+    : _values(alloc), _nullable(nullable), _null_words(alloc) {
+  _values.reserve(capacity);
+  if (nullable) _grow_null_words((capacity + NULL_WORD_BITS - 1) / NULL_WORD_BITS);
+}
+
+template <typename T>
+ValueColumn<T>::ValueColumn(pmr_vector<T>&& values)
+    : _values(std::move(values)), _null_words(_values.get_allocator()) {}
+
+template <typename T>
+ValueColumn<T>::ValueColumn(pmr_vector<T>&& values, const pmr_vector<bool>& null_values)
+    : _values(std::move(values)), _nullable(true), _null_words(_values.get_allocator()) {
+  DebugAssert(_values.size() == null_values.size(), "The null bitmap needs one entry per value");
+  _grow_null_words((null_values.size() + NULL_WORD_BITS - 1) / NULL_WORD_BITS);
+  for (size_t i = 0; i < null_values.size(); ++i) {
+    if (null_values[i]) _null_words[i / NULL_WORD_BITS] |= uint64_t{1} << (i % NULL_WORD_BITS);
+  }
+}
+
 template <typename T>
 const AllTypeVariant ValueColumn<T>::operator[](const size_t i) const {
   PerformanceWarning("operator[] used");
 
-  throw std::runtime_error("Implement ValueColumn::operator[]");
+  if (is_null(i)) return NULL_VALUE;
+  return _values.at(i);
 }
 
 template <typename T>
 void ValueColumn<T>::append(const AllTypeVariant& val) {
-  // Implementation goes here
+  const auto is_null_value = variant_is_null(val);
+  if (is_null_value) Assert(_nullable, "NULL can only be appended to nullable columns");
+
+  if (_nullable) {
+    const auto i = _values.size();
+    const auto word_index = i / NULL_WORD_BITS;
+    if (word_index >= _null_words.size()) _grow_null_words(std::max(word_index + 1, 2 * _null_words.size()));
+    if (is_null_value) _null_words[word_index].fetch_or(uint64_t{1} << (i % NULL_WORD_BITS), std::memory_order_relaxed);
+  }
+  _values.push_back(is_null_value ? T{} : type_cast<T>(val));
 }
 
 template <typename T>
 size_t ValueColumn<T>::size() const {
-  // Implementation goes here
-  return 0;
+  return _values.size();
+}
+
+template <typename T>
+const pmr_vector<T>& ValueColumn<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+bool ValueColumn<T>::is_nullable() const {
+  return _nullable;
+}
+
+template <typename T>
+size_t ValueColumn<T>::estimate_memory_usage() const {
+  return sizeof(*this) + _values.capacity() * sizeof(T) + _null_words.capacity() * sizeof(uint64_t);
+}
+
+template <typename T>
+void ValueColumn<T>::_grow_null_words(const size_t word_count) {
+  pmr_vector<std::atomic<uint64_t>> null_words(word_count, _null_words.get_allocator());
+  for (size_t word_index = 0; word_index < word_count; ++word_index) {
+    null_words[word_index] = word_index < _null_words.size() ? _null_words[word_index].load() : uint64_t{0};
+  }
+  _null_words.swap(null_words);
 }
 
 EXPLICITLY_INSTANTIATE_COLUMN_TYPES(ValueColumn);
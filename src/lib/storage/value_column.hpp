@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
@@ -9,14 +10,40 @@
 
 namespace opossum {
 
-// ValueColumn is a specific column type that stores all its values in a vector
+// ValueColumn is a specific column type that stores all its values in a vector.
+// Nullable columns additionally keep a bitmap that marks the NULL values. The values at these positions are
+// default-constructed placeholders and must not be interpreted.
+//
+// The columns of MVCC tables are appended to while other threads read them (see Table::append_uncommitted). They
+// reserve room for a whole chunk, so that neither the values nor the words of the bitmap move, and the bits of NULL
+// values are set atomically, so that appending does not overwrite the bits of other rows in the same word. Readers
+// have to bound their loops by Chunk::size(), which only counts rows whose values have been written, not by size() or
+// the size of values().
+//
+// Unlike the dictionaries of DictionaryColumns, ValueColumn<std::string> keeps a pmr_vector<std::string> instead of a
+// StringVector. A StringVector is immutable and sorted, whereas value columns are appended to in insertion order, and
+// an appendable character buffer would reallocate and move strings that concurrent readers access. Strings get the
+// compact layout once their chunk is compressed (see Table::compress_chunk).
 template <typename T>
 class ValueColumn : public BaseColumn {
  public:
+  explicit ValueColumn(const PolymorphicAllocator<T>& alloc = {});
+  ValueColumn(bool nullable, const PolymorphicAllocator<T>& alloc);
+
+  // creates an empty column with room for capacity values, so that appending up to capacity values never moves the
+  // existing ones (see Table::append_uncommitted)
+  ValueColumn(size_t capacity, const PolymorphicAllocator<T>& alloc, bool nullable = false);
+
+  // creates a column that takes ownership of the given values
+  explicit ValueColumn(pmr_vector<T>&& values);
+
+  // creates a nullable column that takes ownership of the given values and marks the values whose flag is set as NULL
+  ValueColumn(pmr_vector<T>&& values, const pmr_vector<bool>& null_values);
+
   // return the value at a certain position. If you want to write efficient operators, back off!
   const AllTypeVariant operator[](const size_t i) const override;
 
-  // add a value to the end
+  // add a value to the end. Only nullable columns accept NULL.
   void append(const AllTypeVariant& val) override;
 
   // return the number of entries
@@ -25,10 +52,29 @@ class ValueColumn : public BaseColumn {
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. auto& values = col.values(); and then: values.at(i); in your loop.
-  const std::vector<T>& values() const;
+  const pmr_vector<T>& values() const;
+
+  // returns whether the column can hold NULL values
+  bool is_nullable() const;
+
+  // returns whether the value at a certain position is NULL
+  bool is_null(const size_t i) const {
+    return _nullable && (_null_words[i / NULL_WORD_BITS].load(std::memory_order_relaxed) >> (i % NULL_WORD_BITS)) & 1u;
+  }
+
+  size_t estimate_memory_usage() const override;
 
  protected:
-  // Implementation goes here
+  static constexpr auto NULL_WORD_BITS = size_t{64};
+
+  // grows the bitmap to word_count words. The words are atomics, which cannot be moved, so they are copied into a new
+  // vector. This only happens for columns that are not read while they are appended to.
+  void _grow_null_words(size_t word_count);
+
+  pmr_vector<T> _values;
+  bool _nullable = false;
+  // the NULL bitmap, bit i % 64 of word i / 64 is set if value i is NULL
+  pmr_vector<std::atomic<uint64_t>> _null_words;
 };
 
 }  // namespace opossum
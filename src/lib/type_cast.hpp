@@ -34,11 +34,12 @@ const T& get(const AllTypeVariant& value) {
 }
 
 // cast methods - from variant to specific type
+// NULL is cast like the string "NULL", so that casting it to a number throws
 
 // Template specialization for everything but integral types
 template <typename T>
 std::enable_if_t<!std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
-  if (value.which() == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
+  if (value.which() == detail::index_of(types_including_null, hana::type_c<T>)) return get<T>(value);
 
   return boost::lexical_cast<T>(value);
 }
@@ -46,7 +47,7 @@ std::enable_if_t<!std::is_integral<T>::value, T> type_cast(const AllTypeVariant&
 // Template specialization for integral types
 template <typename T>
 std::enable_if_t<std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
-  if (value.which() == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
+  if (value.which() == detail::index_of(types_including_null, hana::type_c<T>)) return get<T>(value);
 
   try {
     return boost::lexical_cast<T>(value);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <boost/container/pmr/polymorphic_allocator.hpp>
+
 #include <cstdint>
 #include <iostream>
 #include <limits>
@@ -34,9 +36,36 @@ STRONG_TYPEDEF(uint32_t, ValueID);  // Cannot be larger than ChunkOffset
 
 namespace opossum {
 
+/**
+ * Containers that hold column data use polymorphic allocators, so that the memory of a table can be provided by a
+ * memory resource of the caller's choice, e.g., a monotonic buffer resource for query-local intermediate results.
+ * By default, memory is allocated using new and delete.
+ *
+ * We use boost's implementation, because std::pmr is not available in all standard libraries that we support.
+ */
+template <typename T>
+using PolymorphicAllocator = boost::container::pmr::polymorphic_allocator<T>;
+
+template <typename T>
+using pmr_vector = std::vector<T, PolymorphicAllocator<T>>;
+
 using ChunkOffset = uint32_t;
 using AttributeVectorWidth = uint8_t;
 
+// Identifies a NUMA node. Machines without NUMA support are treated as a single node with id 0.
+using NodeID = uint32_t;
+
+// Transactions are identified by a TransactionID, commits are numbered in the order in which they happen (see
+// TransactionManager). Rows that are loaded outside of transactions (e.g., by Table::append) have CommitID 0.
+using TransactionID = uint32_t;
+using CommitID = uint32_t;
+
+constexpr TransactionID INVALID_TRANSACTION_ID = 0;
+constexpr CommitID MAX_COMMIT_ID = std::numeric_limits<CommitID>::max();
+
+// Specifies whether a table keeps multi-version concurrency control (MVCC) information for its rows (see Chunk)
+enum class UseMvcc : bool { No, Yes };
+
 struct RowID {
   ChunkID chunk_id;
   ChunkOffset chunk_offset;
@@ -51,9 +80,32 @@ struct RowID {
   }
 };
 
-enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
+// OpIsNull and OpIsNotNull ignore the search value. For OpLike and OpNotLike, it is an SQL LIKE pattern (see
+// LikeMatcher), and the column has to be a string column.
+enum class ScanType {
+  OpEquals,
+  OpNotEquals,
+  OpLessThan,
+  OpLessThanEquals,
+  OpGreaterThan,
+  OpGreaterThanEquals,
+  OpIsNull,
+  OpIsNotNull,
+  OpLike,
+  OpNotLike
+};
+
+inline bool is_null_scan_type(const ScanType scan_type) {
+  return scan_type == ScanType::OpIsNull || scan_type == ScanType::OpIsNotNull;
+}
+
+inline bool is_like_scan_type(const ScanType scan_type) {
+  return scan_type == ScanType::OpLike || scan_type == ScanType::OpNotLike;
+}
+
+enum class OrderByMode { Ascending, Descending };
 
-using PosList = std::vector<RowID>;
+using PosList = pmr_vector<RowID>;
 
 class Noncopyable {
  protected:
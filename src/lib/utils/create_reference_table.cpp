@@ -0,0 +1,151 @@
+#include "create_reference_table.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Describes where the positions of an output column point to. Columns with the same source share their PosLists.
+struct PosListSource {
+  std::shared_ptr<const Table> referenced_table;
+  // the PosList of each input chunk, nullptr if the input holds the data itself or the chunk is not referenced
+  std::vector<std::shared_ptr<const PosList>> chunk_pos_lists;
+
+  bool operator==(const PosListSource& rhs) const {
+    return referenced_table == rhs.referenced_table && chunk_pos_lists == rhs.chunk_pos_lists;
+  }
+};
+
+}  // namespace
+
+std::shared_ptr<Table> create_reference_table(const std::shared_ptr<const Table>& input_table, const PosList& row_ids,
+                                              const uint32_t output_chunk_size,
+                                              const PolymorphicAllocator<size_t>& alloc) {
+  auto output_table = std::make_shared<Table>(output_chunk_size, alloc);
+  for (ColumnID column_id{0}; column_id < input_table->col_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id),
+                                        input_table->column_is_nullable(column_id));
+  }
+
+  if (row_ids.empty()) return output_table;
+
+  std::vector<bool> is_chunk_referenced(input_table->chunk_count(), false);
+  for (const auto& row_id : row_ids) {
+    is_chunk_referenced[row_id.chunk_id] = true;
+  }
+
+  // find out where each column's positions point to
+  std::vector<PosListSource> sources;
+  std::vector<size_t> column_source_ids(input_table->col_count());
+  std::vector<ColumnID> referenced_column_ids(input_table->col_count());
+
+  for (ColumnID column_id{0}; column_id < input_table->col_count(); ++column_id) {
+    PosListSource source{nullptr, std::vector<std::shared_ptr<const PosList>>(input_table->chunk_count())};
+    auto referenced_column_id = column_id;
+
+    for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+      if (!is_chunk_referenced[chunk_id]) continue;
+
+      auto chunk_referenced_table = input_table;
+      auto chunk_referenced_column_id = column_id;
+      const auto column = input_table->get_chunk(chunk_id)->get_column(column_id);
+      if (const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
+        chunk_referenced_table = reference_column->referenced_table();
+        chunk_referenced_column_id = reference_column->referenced_column_id();
+        source.chunk_pos_lists[chunk_id] = reference_column->pos_list();
+      }
+
+      if (!source.referenced_table) {
+        source.referenced_table = chunk_referenced_table;
+        referenced_column_id = chunk_referenced_column_id;
+      }
+      Assert(source.referenced_table == chunk_referenced_table && referenced_column_id == chunk_referenced_column_id,
+             "All chunks of a column have to reference the same column");
+    }
+
+    const auto source_it = std::find(sources.cbegin(), sources.cend(), source);
+    column_source_ids[column_id] = std::distance(sources.cbegin(), source_it);
+    if (source_it == sources.cend()) sources.push_back(std::move(source));
+    referenced_column_ids[column_id] = referenced_column_id;
+  }
+
+  // translate the positions in input_table into positions in the referenced tables
+  std::vector<PosList> resolved_row_ids;
+  for (const auto& source : sources) {
+    PosList source_row_ids(alloc);
+    source_row_ids.reserve(row_ids.size());
+    for (const auto& row_id : row_ids) {
+      const auto& pos_list = source.chunk_pos_lists[row_id.chunk_id];
+      source_row_ids.push_back(pos_list ? (*pos_list)[row_id.chunk_offset] : row_id);
+    }
+    resolved_row_ids.push_back(std::move(source_row_ids));
+  }
+
+  const size_t rows_per_chunk = output_chunk_size > 0 ? output_chunk_size : row_ids.size();
+  for (size_t chunk_begin = 0; chunk_begin < row_ids.size(); chunk_begin += rows_per_chunk) {
+    const auto chunk_end = std::min(chunk_begin + rows_per_chunk, row_ids.size());
+
+    std::vector<std::shared_ptr<const PosList>> chunk_pos_lists;
+    for (const auto& source_row_ids : resolved_row_ids) {
+      chunk_pos_lists.push_back(std::make_shared<PosList>(source_row_ids.cbegin() + chunk_begin,
+                                                          source_row_ids.cbegin() + chunk_end, alloc));
+    }
+
+    // the output chunk is placed on the node of the input chunk its first row comes from
+    Chunk chunk(input_table->chunk_numa_node(row_ids[chunk_begin].chunk_id), alloc);
+    for (ColumnID column_id{0}; column_id < input_table->col_count(); ++column_id) {
+      const auto source_id = column_source_ids[column_id];
+      chunk.add_column(std::make_shared<ReferenceColumn>(sources[source_id].referenced_table,
+                                                         referenced_column_ids[column_id], chunk_pos_lists[source_id]));
+    }
+    output_table->emplace_chunk(std::move(chunk));
+  }
+
+  return output_table;
+}
+
+Chunk create_reference_chunk(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id,
+                             const std::vector<ChunkOffset>& chunk_offsets, const PolymorphicAllocator<size_t>& alloc) {
+  const auto input_chunk = input_table->get_chunk(chunk_id);
+
+  // columns that reference the same positions share their output PosList. nullptr stands for the input's data columns.
+  std::map<std::shared_ptr<const PosList>, std::shared_ptr<const PosList>> output_pos_lists;
+  const auto get_output_pos_list = [&](const std::shared_ptr<const PosList>& input_pos_list) {
+    auto& output_pos_list = output_pos_lists[input_pos_list];
+    if (!output_pos_list) {
+      auto pos_list = std::make_shared<PosList>(alloc);
+      pos_list->reserve(chunk_offsets.size());
+      for (const auto chunk_offset : chunk_offsets) {
+        pos_list->push_back(input_pos_list ? (*input_pos_list)[chunk_offset] : RowID{chunk_id, chunk_offset});
+      }
+      output_pos_list = std::move(pos_list);
+    }
+    return output_pos_list;
+  };
+
+  Chunk output_chunk(input_chunk->numa_node(), alloc);
+  for (ColumnID column_id{0}; column_id < input_table->col_count(); ++column_id) {
+    const auto column = input_chunk->get_column(column_id);
+    if (const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
+      output_chunk.add_column(std::make_shared<ReferenceColumn>(reference_column->referenced_table(),
+                                                                reference_column->referenced_column_id(),
+                                                                get_output_pos_list(reference_column->pos_list())));
+    } else {
+      output_chunk.add_column(std::make_shared<ReferenceColumn>(input_table, column_id, get_output_pos_list(nullptr)));
+    }
+  }
+
+  return output_chunk;
+}
+
+}  // namespace opossum
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+// Creates a table that consists of ReferenceColumns and holds the rows of input_table at the given positions, in this
+// order. If input_table consists of ReferenceColumns itself, the output references the tables they reference, so
+// that ReferenceColumns never point to ReferenceColumns. Columns that reference the same positions share their
+// PosLists. Only the chunks of input_table that row_ids point into are accessed.
+// The output is split into chunks of output_chunk_size rows (0 means a single chunk).
+std::shared_ptr<Table> create_reference_table(const std::shared_ptr<const Table>& input_table, const PosList& row_ids,
+                                              uint32_t output_chunk_size, const PolymorphicAllocator<size_t>& alloc);
+
+// Creates a chunk of ReferenceColumns that holds the rows at the given offsets of the chunk chunk_id of input_table.
+// ReferenceColumns of the input are forwarded in the same way as by create_reference_table.
+Chunk create_reference_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id,
+                             const std::vector<ChunkOffset>& chunk_offsets, const PolymorphicAllocator<size_t>& alloc);
+
+}  // namespace opossum
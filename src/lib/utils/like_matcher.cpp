@@ -0,0 +1,90 @@
+#include "like_matcher.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace opossum {
+
+LikeMatcher::LikeMatcher(std::string pattern) : _pattern(std::move(pattern)) {
+  _has_single_character_wildcard = _pattern.find('_') != std::string::npos;
+
+  auto segment_begin = size_t{0};
+  while (true) {
+    const auto segment_end = _pattern.find('%', segment_begin);
+    _segments.emplace_back(_pattern.substr(segment_begin, segment_end - segment_begin));
+    if (segment_end == std::string::npos) break;
+    segment_begin = segment_end + 1;
+  }
+
+  // "abc%" and "abc%%" match the values starting with "abc"
+  const auto is_prefix_pattern = !_has_single_character_wildcard && _segments.size() >= 2 &&
+                                 std::all_of(_segments.cbegin() + 1, _segments.cend(),
+                                             [](const auto& segment) { return segment.empty(); });
+  if (is_prefix_pattern) _prefix = _segments.front();
+}
+
+bool LikeMatcher::matches(const std::string_view value) const {
+  if (_has_single_character_wildcard) return _matches_wildcards(value);
+
+  const auto& first = _segments.front();
+  if (_segments.size() == 1) return value == first;
+
+  const auto& last = _segments.back();
+  if (value.size() < first.size() + last.size()) return false;
+  if (value.compare(0, first.size(), first) != 0) return false;
+  if (value.compare(value.size() - last.size(), last.size(), last) != 0) return false;
+
+  // the segments in between have to occur in order, without overlapping the prefix or the suffix
+  auto remainder = value.substr(first.size(), value.size() - first.size() - last.size());
+  for (auto segment = _segments.cbegin() + 1; segment + 1 < _segments.cend(); ++segment) {
+    const auto position = remainder.find(*segment);
+    if (position == std::string_view::npos) return false;
+    remainder.remove_prefix(position + segment->size());
+  }
+  return true;
+}
+
+const std::optional<std::string>& LikeMatcher::prefix() const { return _prefix; }
+
+std::optional<std::string> LikeMatcher::prefix_upper_bound(const std::string& prefix) {
+  // increment the last character that can be incremented and drop the ones behind it
+  auto upper_bound = prefix;
+  while (!upper_bound.empty() && static_cast<unsigned char>(upper_bound.back()) == 0xFF) upper_bound.pop_back();
+  if (upper_bound.empty()) return std::nullopt;
+
+  upper_bound.back() = static_cast<char>(static_cast<unsigned char>(upper_bound.back()) + 1);
+  return upper_bound;
+}
+
+bool LikeMatcher::_matches_wildcards(const std::string_view value) const {
+  auto pattern_position = size_t{0};
+  auto value_position = size_t{0};
+  // the position after the last '%' and the value position it was tried at, to backtrack to if a mismatch occurs
+  auto backtrack_pattern_position = std::string::npos;
+  auto backtrack_value_position = size_t{0};
+
+  while (value_position < value.size()) {
+    if (pattern_position < _pattern.size() && _pattern[pattern_position] == '%') {
+      backtrack_pattern_position = ++pattern_position;
+      backtrack_value_position = value_position;
+    } else if (pattern_position < _pattern.size() &&
+               (_pattern[pattern_position] == '_' || _pattern[pattern_position] == value[value_position])) {
+      ++pattern_position;
+      ++value_position;
+    } else if (backtrack_pattern_position != std::string::npos) {
+      // let the last '%' consume one more character
+      pattern_position = backtrack_pattern_position;
+      value_position = ++backtrack_value_position;
+    } else {
+      return false;
+    }
+  }
+
+  while (pattern_position < _pattern.size() && _pattern[pattern_position] == '%') ++pattern_position;
+  return pattern_position == _pattern.size();
+}
+
+}  // namespace opossum
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * Matches strings against an SQL LIKE pattern, in which '%' stands for any sequence of characters and '_' for any
+ * single character. There is no escape character.
+ *
+ * The pattern is analyzed once. Patterns without '_' are split at '%' into literal segments: the first segment has
+ * to be a prefix of the value, the last one a suffix, and the segments in between have to occur in order. These are
+ * found with std::string_view::find, which goes through memchr and memcmp and thereby glibc's vectorized
+ * implementations. Patterns with '_' fall back to a backtracking wildcard match.
+ *
+ * Patterns of the form "abc%" select a range of sorted values, which is why prefix() is exposed (see TableScan).
+ */
+class LikeMatcher {
+ public:
+  explicit LikeMatcher(std::string pattern);
+
+  bool matches(std::string_view value) const;
+
+  // returns the prefix if the pattern matches exactly the values that start with it, e.g., "abc" for "abc%"
+  const std::optional<std::string>& prefix() const;
+
+  // Returns the smallest string that is greater than all strings starting with prefix, or std::nullopt if there is
+  // none (i.e., if prefix is empty or consists of '\xff' only). Together with prefix, it bounds a range of sorted
+  // values.
+  static std::optional<std::string> prefix_upper_bound(const std::string& prefix);
+
+ protected:
+  // matches the complete pattern, including '_', by backtracking to the last '%'
+  bool _matches_wildcards(std::string_view value) const;
+
+  const std::string _pattern;
+  bool _has_single_character_wildcard = false;
+  // the pattern split at '%'
+  std::vector<std::string> _segments;
+  std::optional<std::string> _prefix;
+};
+
+}  // namespace opossum
@@ -0,0 +1,104 @@
+#include "performance_warning.hpp"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+PerformanceWarningSite::PerformanceWarningSite(const std::string& text, const std::string& location)
+    : _text(text), _location(location) {}
+
+const std::string& PerformanceWarningSite::text() const { return _text; }
+
+const std::string& PerformanceWarningSite::location() const { return _location; }
+
+uint64_t PerformanceWarningSite::count() const { return _count.load(std::memory_order_relaxed); }
+
+void PerformanceWarningSite::_print() const {
+#if IS_DEBUG
+  if (PerformanceWarningRegistry::get()._printing_disabled) return;
+  std::cout << "[PERF] " << _text << " at " << _location
+            << "\n\tPerformance can be affected. This warning is only shown once." << std::endl;
+#endif
+}
+
+PerformanceWarningRegistry& PerformanceWarningRegistry::get() {
+  static PerformanceWarningRegistry instance;
+  return instance;
+}
+
+PerformanceWarningSite& PerformanceWarningRegistry::register_site(const std::string& text,
+                                                                  const std::string& location) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  for (auto& site : _sites) {
+    if (site.location() == location && site.text() == text) return site;
+  }
+  _sites.emplace_back(text, location);
+  return _sites.back();
+}
+
+std::vector<const PerformanceWarningSite*> PerformanceWarningRegistry::fired_sites() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  std::vector<const PerformanceWarningSite*> fired_sites;
+  for (const auto& site : _sites) {
+    if (site.count() > 0) fired_sites.push_back(&site);
+  }
+  std::stable_sort(fired_sites.begin(), fired_sites.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs->count() > rhs->count(); });
+  return fired_sites;
+}
+
+uint64_t PerformanceWarningRegistry::count(const std::string& text) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  uint64_t count = 0;
+  for (const auto& site : _sites) {
+    if (site.text() == text) count += site.count();
+  }
+  return count;
+}
+
+void PerformanceWarningRegistry::dump(std::ostream& out) const {
+  const auto sites = fired_sites();
+
+  // group the sites by their text, keeping the order of the most frequent site per text
+  std::vector<std::string> texts;
+  std::map<std::string, std::vector<const PerformanceWarningSite*>> sites_by_text;
+  for (const auto site : sites) {
+    auto& text_sites = sites_by_text[site->text()];
+    if (text_sites.empty()) texts.push_back(site->text());
+    text_sites.push_back(site);
+  }
+
+  for (const auto& text : texts) {
+    const auto& text_sites = sites_by_text[text];
+    uint64_t count = 0;
+    for (const auto site : text_sites) count += site->count();
+
+    out << text << ": " << count << std::endl;
+    for (const auto site : text_sites) {
+      out << "  " << site->location() << ": " << site->count() << std::endl;
+    }
+  }
+}
+
+void PerformanceWarningRegistry::reset_counts() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  for (auto& site : _sites) {
+    site._count = 0;
+  }
+}
+
+PerformanceWarningDisabler::PerformanceWarningDisabler()
+    : _previously_disabled(PerformanceWarningRegistry::get()._printing_disabled.exchange(true)) {}
+
+PerformanceWarningDisabler::~PerformanceWarningDisabler() {
+  if (!_previously_disabled) PerformanceWarningRegistry::get()._printing_disabled = false;
+}
+
+}  // namespace opossum
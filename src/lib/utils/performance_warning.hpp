@@ -1,72 +1,117 @@
 #pragma once
 
 #include <boost/preprocessor/stringize.hpp>
+
+#include <atomic>
+#include <cstdint>
 #include <iostream>
+#include <list>
+#include <mutex>
 #include <string>
+#include <vector>
 
 /**
  * Performance Warnings can be used in places where slow workarounds are used. This includes BaseColumn[] or the
  * use of a cross join followed by a projection instead of an equijoin.
  *
- * The warnings are printed only once per program execution. This is achieved by using static variables.
+ * Every call site of PerformanceWarning has a counter that is incremented whenever the site is reached, in debug and
+ * in release builds. After the site has registered itself on its first execution, this only costs a relaxed atomic
+ * increment. The counters are kept by the PerformanceWarningRegistry, which can report them:
+ *
+ * PerformanceWarningRegistry::get().dump(std::cout);
+ * // operator[] used: 1200
+ * //   src/lib/storage/value_column.cpp:24: 1000
+ * //   src/lib/storage/dictionary_column.hpp:66: 200
  *
- * Performance warnings can be disabled using the RAII-style PerformanceWarningDisabler:
+ * In debug builds, every site additionally prints its warning when it is reached for the first time.
+ * Printing can be disabled using the RAII-style PerformanceWarningDisabler, which does not affect the counters:
  *
  * {
  *   PerformanceWarningDisabler pwd;
- *   std::cout << base_column[5] << std::endl; // this does not cause a warning
+ *   std::cout << base_column[5] << std::endl; // this does not print a warning
  * }
- * // warnings are enabled again
+ * // warnings are printed again
  *
  * Warnings do not print in tests.
  */
 
-class PerformanceWarningDisabler;
-
-class PerformanceWarningClass {
-  static bool& disabled() {
-    // hacky hack that allows us to have state in a header file
-    static bool _disabled{false};
-    return _disabled;
-  }
+namespace opossum {
 
+// The counter of a single call site of PerformanceWarning
+class PerformanceWarningSite {
  public:
-  explicit PerformanceWarningClass(const std::string& text) {
-    if (PerformanceWarningClass::disabled()) return;
-    std::cout << "[PERF] " << text << "\n\tPerformance can be affected. This warning is only shown once." << std::endl;
+  PerformanceWarningSite(const std::string& text, const std::string& location);
+
+  PerformanceWarningSite(const PerformanceWarningSite&) = delete;
+  PerformanceWarningSite& operator=(const PerformanceWarningSite&) = delete;
+
+  void fire() {
+    if (_count.fetch_add(1, std::memory_order_relaxed) == 0) _print();
   }
 
+  const std::string& text() const;
+  const std::string& location() const;
+  uint64_t count() const;
+
  protected:
-  static bool disable() {
-    bool previous = PerformanceWarningClass::disabled();
-    PerformanceWarningClass::disabled() = true;
-    return previous;
-  }
+  friend class PerformanceWarningRegistry;
+
+  void _print() const;
+
+  const std::string _text;
+  const std::string _location;
+  std::atomic<uint64_t> _count{0};
+};
+
+class PerformanceWarningRegistry {
+ public:
+  static PerformanceWarningRegistry& get();
+
+  // returns the site at the given location, creating it if necessary. This is called once per call site (and per
+  // template instantiation), so it is not optimized for speed.
+  PerformanceWarningSite& register_site(const std::string& text, const std::string& location);
 
-  static void enable() { PerformanceWarningClass::disabled() = false; }
+  // returns the sites that have been reached at least once, the most frequent ones first
+  std::vector<const PerformanceWarningSite*> fired_sites() const;
 
+  // returns how often warnings with the given text have been issued, summed up over all sites
+  uint64_t count(const std::string& text) const;
+
+  // prints the number of warnings per text, followed by the sites that issued them
+  void dump(std::ostream& out) const;
+
+  // sets all counters to zero, e.g., to measure the warnings of a single query
+  void reset_counts();
+
+ protected:
   friend class PerformanceWarningDisabler;
+  friend class PerformanceWarningSite;
+
+  PerformanceWarningRegistry() = default;
+
+  mutable std::mutex _mutex;
+  // a list, so that the sites keep their addresses
+  std::list<PerformanceWarningSite> _sites;
+  std::atomic<bool> _printing_disabled{false};
 };
 
 class PerformanceWarningDisabler {
-  bool _previously_disabled;
-
  public:
-  PerformanceWarningDisabler() : _previously_disabled(PerformanceWarningClass::disable()) {}
-  ~PerformanceWarningDisabler() {
-    if (!_previously_disabled) PerformanceWarningClass::enable();
-  }
+  PerformanceWarningDisabler();
+  ~PerformanceWarningDisabler();
+
+ protected:
+  bool _previously_disabled;
 };
 
-#if IS_DEBUG
+}  // namespace opossum
+
 #ifndef __FILENAME__
 #define __FILENAME__ (__FILE__ + SOURCE_PATH_SIZE)
 #endif
-#define PerformanceWarning(text)                                                                 \
-  {                                                                                              \
-    static PerformanceWarningClass warn(std::string(text) + " at " + std::string(__FILENAME__) + \
-                                        ":" BOOST_PP_STRINGIZE(__LINE__));                       \
+#define PerformanceWarning(text)                                                                      \
+  {                                                                                                   \
+    static auto& performance_warning_site = opossum::PerformanceWarningRegistry::get().register_site( \
+        text, std::string(__FILENAME__) + ":" BOOST_PP_STRINGIZE(__LINE__));                          \
+    performance_warning_site.fire();                                                                  \
   }  // NOLINT
-#else
-#define PerformanceWarning(text)
-#endif
@@ -0,0 +1,127 @@
+#include "plan_visualizer.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "operators/abstract_operator.hpp"
+
+namespace opossum {
+
+namespace {
+
+// returns all operators of the plan, every operator once, consumers before their inputs
+std::vector<const AbstractOperator*> collect_operators(const AbstractOperator& root) {
+  std::vector<const AbstractOperator*> operators;
+  std::unordered_set<const AbstractOperator*> visited;
+  std::vector<const AbstractOperator*> stack{&root};
+
+  while (!stack.empty()) {
+    const auto op = stack.back();
+    stack.pop_back();
+    if (!visited.insert(op).second) continue;
+
+    operators.push_back(op);
+    if (op->input_right()) stack.push_back(op->input_right().get());
+    if (op->input_left()) stack.push_back(op->input_left().get());
+  }
+
+  return operators;
+}
+
+std::chrono::nanoseconds total_walltime(const std::vector<const AbstractOperator*>& operators) {
+  std::chrono::nanoseconds walltime{0};
+  for (const auto op : operators) {
+    walltime += op->performance_data().walltime;
+  }
+  return walltime;
+}
+
+// returns the performance data of the operator and its share of the plan's walltime
+std::string annotate(const AbstractOperator& op, const std::chrono::nanoseconds plan_walltime) {
+  if (!op.get_output()) return "not executed";
+
+  const auto& performance_data = op.performance_data();
+  const auto share = plan_walltime.count() > 0
+                         ? 100.0 * static_cast<double>(performance_data.walltime.count()) / plan_walltime.count()
+                         : 0.0;
+
+  std::ostringstream stream;
+  stream << performance_data.to_string() << " (" << std::fixed << std::setprecision(1) << share << "% of plan)";
+  return stream.str();
+}
+
+void print_text_recursively(const AbstractOperator& op, const std::chrono::nanoseconds plan_walltime, size_t depth,
+                            std::unordered_set<const AbstractOperator*>& printed, std::ostream& out) {
+  out << std::string(2 * depth, ' ');
+  if (!printed.insert(&op).second) {
+    out << op.description() << ": see above" << std::endl;
+    return;
+  }
+
+  out << op.description() << ": " << annotate(op, plan_walltime) << std::endl;
+  if (op.input_left()) print_text_recursively(*op.input_left(), plan_walltime, depth + 1, printed, out);
+  if (op.input_right()) print_text_recursively(*op.input_right(), plan_walltime, depth + 1, printed, out);
+}
+
+std::string escape_dot_label(const std::string& label) {
+  std::string escaped;
+  for (const auto character : label) {
+    if (character == '"' || character == '\\') escaped += '\\';
+    escaped += character;
+  }
+  return escaped;
+}
+
+}  // namespace
+
+void PlanVisualizer::print_text(const std::shared_ptr<const AbstractOperator>& root, std::ostream& out) {
+  const auto plan_walltime = total_walltime(collect_operators(*root));
+  std::unordered_set<const AbstractOperator*> printed;
+  print_text_recursively(*root, plan_walltime, 0, printed, out);
+}
+
+void PlanVisualizer::print_dot(const std::shared_ptr<const AbstractOperator>& root, std::ostream& out) {
+  const auto operators = collect_operators(*root);
+  const auto plan_walltime = total_walltime(operators);
+
+  const AbstractOperator* slowest_operator = nullptr;
+  std::unordered_map<const AbstractOperator*, size_t> node_ids;
+  for (const auto op : operators) {
+    node_ids.emplace(op, node_ids.size());
+    if (!slowest_operator || op->performance_data().walltime > slowest_operator->performance_data().walltime) {
+      slowest_operator = op;
+    }
+  }
+
+  out << "digraph {" << std::endl;
+  out << "  rankdir=BT;" << std::endl;
+  out << "  node [shape=box, fontname=\"Helvetica\"];" << std::endl;
+
+  for (const auto op : operators) {
+    const auto& performance_data = op->performance_data();
+    out << "  operator" << node_ids.at(op) << " [label=\"" << escape_dot_label(op->description()) << "\\n"
+        << escape_dot_label(annotate(*op, plan_walltime)) << "\"";
+    if (op == slowest_operator && performance_data.walltime.count() > 0) {
+      out << ", style=filled, fillcolor=\"#f4cccc\"";
+    }
+    out << "];" << std::endl;
+  }
+
+  for (const auto op : operators) {
+    for (const auto& input : {op->input_left(), op->input_right()}) {
+      if (!input) continue;
+      out << "  operator" << node_ids.at(input.get()) << " -> operator" << node_ids.at(op) << " [label=\""
+          << input->performance_data().output_row_count << " rows\"];" << std::endl;
+    }
+  }
+
+  out << "}" << std::endl;
+}
+
+}  // namespace opossum
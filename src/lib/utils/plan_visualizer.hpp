@@ -0,0 +1,27 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+
+namespace opossum {
+
+class AbstractOperator;
+
+// PlanVisualizer renders a tree of executed operators, annotated with their OperatorPerformanceData and the share of
+// the plan's total walltime that each operator took. Operators that are the input of several others are shown once.
+//
+// Example:
+//   std::ofstream file("plan.dot");
+//   PlanVisualizer::print_dot(root, file);
+//   $ dot -Tpng plan.dot > plan.png
+class PlanVisualizer {
+ public:
+  // prints one line per operator, the inputs of an operator are indented below it
+  static void print_text(const std::shared_ptr<const AbstractOperator>& root, std::ostream& out = std::cout);
+
+  // prints the plan as a Graphviz graph in the DOT language. Edges are labeled with the number of rows that flow
+  // along them, and the slowest operator is highlighted.
+  static void print_dot(const std::shared_ptr<const AbstractOperator>& root, std::ostream& out);
+};
+
+}  // namespace opossum
@@ -0,0 +1,189 @@
+#include "table_generator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/chunk_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk.hpp"
+#include "storage/numa_memory_resource.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Draws ranks from a Zipf distribution over 1 ... distinct_value_count by inverting the integral of x^-skew, which
+// takes constant time and memory per value, even for a billion distinct values. The probability of rank k is the
+// integral of x^-skew from k to k + 1, which approximates the exact distribution well for benchmarking purposes.
+class ZipfRankGenerator {
+ public:
+  ZipfRankGenerator(const size_t distinct_value_count, const double skew)
+      : _distinct_value_count(distinct_value_count),
+        _skew(skew),
+        _distribution(0.0, _integral(static_cast<double>(distinct_value_count) + 1.0)) {}
+
+  template <typename Generator>
+  size_t operator()(Generator& generator) {
+    const auto x = std::max(_inverse_integral(_distribution(generator)), 1.0);
+    return std::min(static_cast<size_t>(x) - 1, _distinct_value_count - 1);
+  }
+
+ protected:
+  bool _is_harmonic() const { return std::abs(_skew - 1.0) < 1e-9; }
+
+  // integral of t^-skew from 1 to x
+  double _integral(const double x) const {
+    return _is_harmonic() ? std::log(x) : (std::pow(x, 1.0 - _skew) - 1.0) / (1.0 - _skew);
+  }
+
+  double _inverse_integral(const double y) const {
+    return _is_harmonic() ? std::exp(y) : std::pow(1.0 + y * (1.0 - _skew), 1.0 / (1.0 - _skew));
+  }
+
+  const size_t _distinct_value_count;
+  const double _skew;
+  std::uniform_real_distribution<double> _distribution;
+};
+
+struct ChunkLocation {
+  ChunkID chunk_id;
+  ChunkID chunk_count;
+  // index of the first row of the chunk within the table
+  size_t first_row;
+  size_t row_count;
+};
+
+template <typename T>
+std::shared_ptr<BaseColumn> generate_column(const ColumnSpecification& column_specification,
+                                            const size_t table_row_count, const ChunkLocation& chunk,
+                                            std::mt19937_64& generator, const PolymorphicAllocator<T>& alloc) {
+  const auto& distribution = column_specification.distribution;
+  const auto distinct_value_count = distribution.distinct_value_count;
+  Assert(distinct_value_count > 0, "Generated columns need at least one distinct value");
+
+  pmr_vector<T> values(alloc);
+  values.reserve(chunk.row_count);
+
+  // the distribution is resolved once per column and chunk, not per value
+  const auto generate_values = [&](auto&& rank_for_row) {
+    for (size_t row = chunk.first_row; row < chunk.first_row + chunk.row_count; ++row) {
+      values.push_back(TableGenerator::generated_value<T>(rank_for_row(row), column_specification.string_length,
+                                                          column_specification.max_string_length));
+    }
+  };
+
+  switch (distribution.distribution_type) {
+    case DataDistributionType::Uniform: {
+      std::uniform_int_distribution<size_t> uniform(0, distinct_value_count - 1);
+      generate_values([&](size_t) { return uniform(generator); });
+      break;
+    }
+    case DataDistributionType::Zipf: {
+      ZipfRankGenerator zipf(distinct_value_count, distribution.zipf_skew);
+      generate_values([&](size_t) { return zipf(generator); });
+      break;
+    }
+    case DataDistributionType::Sorted: {
+      const auto ranks_per_row = static_cast<double>(distinct_value_count) / static_cast<double>(table_row_count);
+      generate_values([&](size_t row) {
+        return std::min(static_cast<size_t>(static_cast<double>(row) * ranks_per_row), distinct_value_count - 1);
+      });
+      break;
+    }
+    case DataDistributionType::Clustered: {
+      // chunk i covers the ranks [i * d / c, (i + 1) * d / c), or a single rank if there are fewer ranks than chunks
+      const auto cluster_begin = chunk.chunk_id.t * distinct_value_count / chunk.chunk_count.t;
+      const auto cluster_end = (chunk.chunk_id.t + 1) * distinct_value_count / chunk.chunk_count.t;
+      std::uniform_int_distribution<size_t> uniform(cluster_begin, std::max(cluster_begin, cluster_end - 1));
+      generate_values([&](size_t) { return uniform(generator); });
+      break;
+    }
+  }
+
+  return std::make_shared<ValueColumn<T>>(std::move(values));
+}
+
+}  // namespace
+
+ColumnDataDistribution ColumnDataDistribution::make_uniform_config(const size_t distinct_value_count) {
+  return ColumnDataDistribution{DataDistributionType::Uniform, distinct_value_count};
+}
+
+ColumnDataDistribution ColumnDataDistribution::make_zipf_config(const size_t distinct_value_count, const double skew) {
+  Assert(skew > 0.0, "Zipf skew must be positive");
+  return ColumnDataDistribution{DataDistributionType::Zipf, distinct_value_count, skew};
+}
+
+ColumnDataDistribution ColumnDataDistribution::make_sorted_config(const size_t distinct_value_count) {
+  return ColumnDataDistribution{DataDistributionType::Sorted, distinct_value_count};
+}
+
+ColumnDataDistribution ColumnDataDistribution::make_clustered_config(const size_t distinct_value_count) {
+  return ColumnDataDistribution{DataDistributionType::Clustered, distinct_value_count};
+}
+
+TableGenerator::TableGenerator(const uint32_t seed) : _seed(seed) {}
+
+std::shared_ptr<Table> TableGenerator::generate_table(const std::vector<ColumnSpecification>& column_specifications,
+                                                      const size_t row_count, const uint32_t chunk_size,
+                                                      const bool compress) const {
+  auto table = std::make_shared<Table>(chunk_size);
+  for (const auto& column_specification : column_specifications) {
+    table->add_column(column_specification.name, column_specification.type);
+  }
+  if (row_count == 0) return table;
+
+  const auto rows_per_chunk = chunk_size > 0 ? size_t{chunk_size} : row_count;
+  const auto chunk_count = (row_count + rows_per_chunk - 1) / rows_per_chunk;
+  Assert(chunk_count <= std::numeric_limits<ChunkID::base_type>::max(), "Too many chunks");
+
+  const auto node_count = Topology::get().node_count();
+  std::vector<NodeID> chunk_nodes(chunk_count);
+  for (size_t chunk_index = 0; chunk_index < chunk_count; ++chunk_index) {
+    chunk_nodes[chunk_index] = static_cast<NodeID>(chunk_index % node_count);
+  }
+
+  // like the chunks of Table::create_new_chunk, the chunks allocate their values on their node, and the scheduler's
+  // workers are bound to that node
+  std::vector<Chunk> chunks(chunk_count);
+  ChunkScheduler::schedule_and_wait(chunk_nodes, [&](size_t chunk_index) {
+    const auto first_row = chunk_index * rows_per_chunk;
+    const auto chunk_location =
+        ChunkLocation{ChunkID{static_cast<ChunkID::base_type>(chunk_index)},
+                      ChunkID{static_cast<ChunkID::base_type>(chunk_count)}, first_row,
+                      std::min(rows_per_chunk, row_count - first_row)};
+
+    std::seed_seq seed_sequence{_seed, static_cast<uint32_t>(chunk_index)};
+    std::mt19937_64 generator(seed_sequence);
+
+    const auto numa_node = chunk_nodes[chunk_index];
+    Chunk chunk(numa_node, PolymorphicAllocator<size_t>(NumaMemoryResource::get(numa_node)));
+    for (const auto& column_specification : column_specifications) {
+      resolve_data_type(column_specification.type, [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        chunk.add_column(generate_column<ColumnDataType>(column_specification, row_count, chunk_location, generator,
+                                                         chunk.get_allocator()));
+      });
+    }
+    chunks[chunk_index] = std::move(chunk);
+  });
+
+  for (auto& chunk : chunks) table->emplace_chunk(std::move(chunk));
+
+  if (compress) {
+    ChunkScheduler::schedule_per_chunk_and_wait(*table, [&](ChunkID chunk_id) { table->compress_chunk(chunk_id); });
+  }
+
+  return table;
+}
+
+}  // namespace opossum
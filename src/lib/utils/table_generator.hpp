@@ -0,0 +1,102 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+class Table;
+
+enum class DataDistributionType {
+  Uniform,    // every value is equally likely
+  Zipf,       // the probability of the value with rank k is roughly proportional to 1 / (k + 1)^skew
+  Sorted,     // the values increase with the row number, each value covers a contiguous range of rows
+  Clustered,  // every chunk draws uniformly from its own contiguous range of the values, ranges do not overlap
+};
+
+// Describes how the values of a generated column are distributed. The values are identified by their rank
+// 0 ... distinct_value_count - 1, which TableGenerator::generated_value maps to a value of the column's type.
+struct ColumnDataDistribution {
+  static ColumnDataDistribution make_uniform_config(size_t distinct_value_count);
+  static ColumnDataDistribution make_zipf_config(size_t distinct_value_count, double skew = 1.0);
+  static ColumnDataDistribution make_sorted_config(size_t distinct_value_count);
+  static ColumnDataDistribution make_clustered_config(size_t distinct_value_count);
+
+  DataDistributionType distribution_type = DataDistributionType::Uniform;
+  size_t distinct_value_count = 1'000;
+  double zipf_skew = 1.0;
+};
+
+struct ColumnSpecification {
+  std::string name;
+  // one of the types in COLUMN_TYPES, e.g. "int" or "string"
+  std::string type;
+  ColumnDataDistribution distribution = {};
+  // length of the generated strings, ignored for other types
+  size_t string_length = 10;
+  // If set, the lengths of the strings are uniformly distributed in [string_length, max_string_length] instead. All
+  // rows with the same value have the same length.
+  std::optional<size_t> max_string_length = std::nullopt;
+};
+
+/**
+ * The TableGenerator creates tables of arbitrary size with synthetic data, e.g., for benchmarks or for tests that need
+ * more rows than a .tbl file should hold. The chunks are generated in parallel by the ChunkScheduler and placed on the
+ * NUMA nodes round-robin, like the chunks of Table::append. Every chunk has its own random generator that is seeded
+ * with the generator's seed and the ChunkID, so a table only depends on the seed and the parameters, not on the
+ * order in which its chunks are generated.
+ */
+class TableGenerator {
+ public:
+  explicit TableGenerator(uint32_t seed = 42);
+
+  // generates a table with row_count rows in chunks of chunk_size rows (0 means a single chunk).
+  // If compress is set, all chunks are dictionary-compressed.
+  std::shared_ptr<Table> generate_table(const std::vector<ColumnSpecification>& column_specifications,
+                                        size_t row_count, uint32_t chunk_size, bool compress = false) const;
+
+  // maps a rank to a value of type T such that the order of the ranks is preserved. Strings consist of the letters
+  // a-z, are padded with 'a' to string_length characters, and are ordered lexicographically. If max_string_length is
+  // given, the string is padded on the right with 'a' to a length in [string_length, max_string_length] that is
+  // derived from a hash of the rank. As the first string_length characters already differ between ranks, the order
+  // is preserved.
+  template <typename T>
+  static T generated_value(size_t rank, size_t string_length = 10,
+                           std::optional<size_t> max_string_length = std::nullopt) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      Assert(!max_string_length || *max_string_length >= string_length,
+             "The maximum string length must not be below the string length");
+      auto length = string_length;
+      if (max_string_length) length += _hash_rank(rank) % (*max_string_length - string_length + 1);
+
+      std::string value(length, 'a');
+      auto remaining_rank = rank;
+      for (auto it = value.rend() - string_length; it != value.rend() && remaining_rank > 0; ++it) {
+        *it = static_cast<char>('a' + remaining_rank % 26);
+        remaining_rank /= 26;
+      }
+      Assert(remaining_rank == 0, "Rank does not fit into a string of length " + std::to_string(string_length));
+      return value;
+    } else {
+      return static_cast<T>(rank);
+    }
+  }
+
+ protected:
+  // mixes the bits of the rank (SplitMix64 finalizer), so that neighboring ranks get unrelated string lengths
+  static uint64_t _hash_rank(uint64_t rank) {
+    rank = (rank ^ (rank >> 30)) * 0xbf58476d1ce4e5b9ull;
+    rank = (rank ^ (rank >> 27)) * 0x94d049bb133111ebull;
+    return rank ^ (rank >> 31);
+  }
+
+  const uint32_t _seed;
+};
+
+}  // namespace opossum
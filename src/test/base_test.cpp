@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "concurrency/transaction_manager.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "type_cast.hpp"
@@ -37,19 +38,19 @@ BaseTest::Matrix BaseTest::_table_to_matrix(const Table& t) {
   // set values
   unsigned row_offset = 0;
   for (ChunkID chunk_id{0}; chunk_id < t.chunk_count(); chunk_id++) {
-    const Chunk& chunk = t.get_chunk(chunk_id);
+    const auto chunk = t.get_chunk(chunk_id);
 
     // an empty table's chunk might be missing actual columns
-    if (chunk.size() == 0) continue;
+    if (chunk->size() == 0) continue;
 
     for (ColumnID col_id{0}; col_id < t.col_count(); ++col_id) {
-      std::shared_ptr<BaseColumn> column = chunk.get_column(col_id);
+      std::shared_ptr<BaseColumn> column = chunk->get_column(col_id);
 
-      for (ChunkOffset chunk_offset = 0; chunk_offset < chunk.size(); ++chunk_offset) {
+      for (ChunkOffset chunk_offset = 0; chunk_offset < chunk->size(); ++chunk_offset) {
         matrix[row_offset + chunk_offset][col_id] = (*column)[chunk_offset];
       }
     }
-    row_offset += chunk.size();
+    row_offset += chunk->size();
   }
 
   return matrix;
@@ -123,7 +124,10 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& m) {
 
   for (unsigned row = 0; row < left.size(); row++)
     for (ColumnID col{0}; col < left[row].size(); col++) {
-      if (tleft.column_type(col) == "float") {
+      if (variant_is_null(left[row][col]) || variant_is_null(right[row][col])) {
+        EXPECT_TRUE(variant_is_null(left[row][col]) && variant_is_null(right[row][col]))
+            << "Row:" << row + 1 << " Col:" << col + 1;
+      } else if (tleft.column_type(col) == "float") {
         auto left_val = type_cast<float>(left[row][col]);
         auto right_val = type_cast<float>(right[row][col]);
 
@@ -157,6 +161,9 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& m) {
   return ::testing::AssertionSuccess();
 }
 
-BaseTest::~BaseTest() { StorageManager::reset(); }
+BaseTest::~BaseTest() {
+  StorageManager::reset();
+  TransactionManager::reset();
+}
 
 }  // namespace opossum
@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "benchmark_runner.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class BenchmarkRunnerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    for (int i = 0; i < 5; ++i) _table->append({i});
+
+    _queries.emplace_back(BenchmarkQuery{"Q\"1\"", "wraps a table", [&] {
+                                           ++_plan_count;
+                                           return QueryPlan{std::make_shared<TableWrapper>(_table)};
+                                         }});
+  }
+
+  // the report is only checked for balanced brackets, as there is no JSON parser in the tree
+  static void _expect_balanced(const std::string& report) {
+    EXPECT_EQ(std::count(report.cbegin(), report.cend(), '{'), std::count(report.cbegin(), report.cend(), '}'));
+    EXPECT_EQ(std::count(report.cbegin(), report.cend(), '['), std::count(report.cbegin(), report.cend(), ']'));
+  }
+
+  std::shared_ptr<Table> _table;
+  std::vector<BenchmarkQuery> _queries;
+  size_t _plan_count = 0;
+};
+
+TEST_F(BenchmarkRunnerTest, ReportsRuns) {
+  auto config = BenchmarkConfig{};
+  config.runs = 3;
+  config.warmup_runs = 2;
+
+  auto runner = BenchmarkRunner(_queries, config);
+  runner.add_context("benchmark", std::string{"a \"test\""});
+  runner.add_context("scale_factor", 0.5f);
+  runner.add_context("notes", std::string{"line 1\nline\t2\x01"});
+
+  std::ostringstream progress;
+  runner.run(progress);
+  EXPECT_EQ(_plan_count, 5u);
+
+  std::ostringstream out;
+  runner.write_report(out);
+  const auto report = out.str();
+
+  // the stream keeps its number format
+  out << 0.5;
+  EXPECT_EQ(out.str().substr(report.size()), "0.5");
+
+  _expect_balanced(report);
+  EXPECT_NE(report.find("\"benchmark\": \"a \\\"test\\\"\""), std::string::npos);
+  EXPECT_NE(report.find("\"scale_factor\": 0.500000"), std::string::npos);
+  EXPECT_NE(report.find("\"notes\": \"line 1\\nline\\t2\\u0001\""), std::string::npos);
+  EXPECT_NE(report.find("\"name\": \"Q\\\"1\\\"\""), std::string::npos);
+  EXPECT_NE(report.find("\"description\": \"wraps a table\""), std::string::npos);
+  EXPECT_NE(report.find("\"runs\": 3,"), std::string::npos);
+  EXPECT_NE(report.find("\"result_row_count\": 5,"), std::string::npos);
+  const auto keys = std::vector<std::string>{"min", "mean", "p50", "p90", "p99", "p99.9", "max", "queries_per_second"};
+  for (const auto& key : keys) {
+    EXPECT_NE(report.find("\"" + key + "\": "), std::string::npos) << key;
+  }
+  EXPECT_EQ(report.find("\"concurrent\""), std::string::npos);
+}
+
+TEST_F(BenchmarkRunnerTest, ReportsConcurrentRuns) {
+  auto config = BenchmarkConfig{};
+  config.client_counts = {1, 2};
+  config.duration_per_client_count = std::chrono::milliseconds{20};
+
+  auto runner = BenchmarkRunner(_queries, config);
+  std::ostringstream progress;
+  runner.run_concurrently(progress);
+
+  std::ostringstream out;
+  runner.write_report(out);
+  const auto report = out.str();
+
+  _expect_balanced(report);
+  EXPECT_NE(report.find("\"clients\": 1,"), std::string::npos);
+  EXPECT_NE(report.find("\"clients\": 2,"), std::string::npos);
+  EXPECT_NE(report.find("\"duration_ms\": "), std::string::npos);
+  EXPECT_EQ(report.find("\"result_row_count\""), std::string::npos);
+}
+
+TEST_F(BenchmarkRunnerTest, RequiresRunBeforeReport) {
+  auto runner = BenchmarkRunner(_queries, BenchmarkConfig{});
+  std::ostringstream out;
+  EXPECT_THROW(runner.write_report(out), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,84 @@
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "benchmark_runner.hpp"
+#include "tpch/tpch_benchmark_options.hpp"
+
+namespace opossum {
+
+class TpchBenchmarkOptionsTest : public BaseTest {
+ protected:
+  static std::vector<BenchmarkQuery> _queries(const std::vector<std::string>& names) {
+    auto queries = std::vector<BenchmarkQuery>{};
+    for (const auto& name : names) queries.emplace_back(BenchmarkQuery{name, "", [] { return QueryPlan{}; }});
+    return queries;
+  }
+
+  static std::vector<std::string> _names(const std::vector<BenchmarkQuery>& queries) {
+    auto names = std::vector<std::string>{};
+    for (const auto& query : queries) names.emplace_back(query.name);
+    return names;
+  }
+};
+
+TEST_F(TpchBenchmarkOptionsTest, UsesDefaultsWithoutArguments) {
+  const auto options = parse_tpch_benchmark_options({});
+
+  EXPECT_FLOAT_EQ(options.scale_factor, 0.1f);
+  EXPECT_EQ(options.chunk_size, 100'000u);
+  EXPECT_TRUE(options.compress);
+  EXPECT_EQ(options.config.runs, 10u);
+  EXPECT_EQ(options.config.warmup_runs, 1u);
+  EXPECT_TRUE(options.query_names.empty());
+  EXPECT_FALSE(options.concurrent);
+  EXPECT_TRUE(options.output_file.empty());
+  EXPECT_FALSE(options.show_help);
+}
+
+TEST_F(TpchBenchmarkOptionsTest, ParsesAllOptions) {
+  const auto options = parse_tpch_benchmark_options({"--scale", "0.5", "--chunk_size", "1000", "--no_compression",
+                                                     "--runs", "3", "--warmup", "0", "--time", "2", "--clients",
+                                                     "1,4", "--queries", "Q1,Q6", "--output", "report.json"});
+
+  EXPECT_FLOAT_EQ(options.scale_factor, 0.5f);
+  EXPECT_EQ(options.chunk_size, 1'000u);
+  EXPECT_FALSE(options.compress);
+  EXPECT_EQ(options.config.runs, 3u);
+  EXPECT_EQ(options.config.warmup_runs, 0u);
+  EXPECT_EQ(options.config.max_duration_per_query, std::chrono::seconds{2});
+  EXPECT_EQ(options.config.duration_per_client_count, std::chrono::seconds{2});
+  EXPECT_TRUE(options.concurrent);
+  EXPECT_EQ(options.config.client_counts, (std::vector<size_t>{1, 4}));
+  EXPECT_EQ(options.query_names, (std::vector<std::string>{"Q1", "Q6"}));
+  EXPECT_EQ(options.output_file, "report.json");
+}
+
+TEST_F(TpchBenchmarkOptionsTest, ParsesHelp) { EXPECT_TRUE(parse_tpch_benchmark_options({"--help"}).show_help); }
+
+TEST_F(TpchBenchmarkOptionsTest, RejectsInvalidArguments) {
+  EXPECT_THROW(parse_tpch_benchmark_options({"--unknown"}), std::logic_error);
+  EXPECT_THROW(parse_tpch_benchmark_options({"--runs"}), std::logic_error);
+  EXPECT_THROW(parse_tpch_benchmark_options({"--runs", "many"}), std::invalid_argument);
+}
+
+TEST_F(TpchBenchmarkOptionsTest, SelectsQueriesByName) {
+  const auto queries = _queries({"Q1", "Q3", "Q6"});
+
+  EXPECT_EQ(_names(BenchmarkRunner::select_queries(queries, {})), (std::vector<std::string>{"Q1", "Q3", "Q6"}));
+  EXPECT_EQ(_names(BenchmarkRunner::select_queries(queries, {"Q6", "Q1"})), (std::vector<std::string>{"Q1", "Q6"}));
+  EXPECT_THROW(BenchmarkRunner::select_queries(queries, {"Q1", "Q2"}), std::logic_error);
+}
+
+TEST_F(TpchBenchmarkOptionsTest, SelectsQueriesNamedTwiceOnce) {
+  const auto options = parse_tpch_benchmark_options({"--queries", "Q1,Q1"});
+  const auto queries = BenchmarkRunner::select_queries(_queries({"Q1", "Q6"}), options.query_names);
+
+  EXPECT_EQ(_names(queries), std::vector<std::string>{"Q1"});
+}
+
+}  // namespace opossum
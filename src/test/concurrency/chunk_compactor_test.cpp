@@ -0,0 +1,235 @@
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/chunk_compactor.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_index_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/buffer_manager.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class ChunkCompactorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4, PolymorphicAllocator<size_t>{}, UseMvcc::Yes);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto value = 0; value < 10; ++value) _table->append({value, std::to_string(value)});
+    _table->compress_chunk(ChunkID{0});
+    _table->compress_chunk(ChunkID{1});
+    StorageManager::get().add_table("table", _table);
+  }
+
+  // returns the rows that the transaction sees and that compare to value as specified by scan_type
+  std::shared_ptr<const AbstractOperator> _validated_rows(const ScanType scan_type, const int value,
+                                                          const std::shared_ptr<TransactionContext>& context) {
+    auto get_table = std::make_shared<GetTable>("table");
+    get_table->execute();
+    auto table_scan = std::make_shared<TableScan>(get_table, ColumnID{0}, scan_type, value);
+    table_scan->execute();
+    auto validate = std::make_shared<Validate>(table_scan);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate;
+  }
+
+  void _delete(const ScanType scan_type, const int value) {
+    const auto context = TransactionManager::get().new_transaction_context();
+    auto delete_operator = std::make_shared<Delete>("table", _validated_rows(scan_type, value, context));
+    delete_operator->set_transaction_context(context);
+    delete_operator->execute();
+    context->commit();
+  }
+
+  std::shared_ptr<const Table> _expected_rows(const std::vector<int>& values) {
+    auto expected = std::make_shared<Table>();
+    expected->add_column("a", "int");
+    expected->add_column("b", "string");
+    for (const auto value : values) expected->append({value, std::to_string(value)});
+    return expected;
+  }
+
+  std::shared_ptr<const Table> _all_rows(const std::shared_ptr<TransactionContext>& context) {
+    return _validated_rows(ScanType::OpGreaterThanEquals, 0, context)->get_output();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ChunkCompactorTest, CompactsHeavilyInvalidatedChunks) {
+  // chunk 0 holds 0-3, chunk 1 holds 4-7, and the mutable chunk 2 holds 8 and 9
+  _delete(ScanType::OpLessThan, 2);
+  _delete(ScanType::OpEquals, 4);
+  const auto old_context = TransactionManager::get().new_transaction_context();
+
+  ChunkCompactor compactor(0.5f);
+  EXPECT_EQ(compactor.compact_table("table"), 1u);
+
+  // rows 2 and 3 were moved to a compressed chunk behind the mutable chunk, which is not filled up anymore
+  ASSERT_EQ(_table->chunk_count(), 5u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{3})->size(), 2u);
+  const auto compacted_column = _table->get_chunk(ChunkID{3})->get_column(ColumnID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const DictionaryColumn<int>>(compacted_column));
+  EXPECT_EQ(_table->get_chunk(ChunkID{4})->size(), 0u);
+  EXPECT_EQ(_table->approx_valid_row_count(), 7u);
+
+  // all transactions see the same rows as before
+  EXPECT_TABLE_EQ(_all_rows(old_context), _expected_rows({2, 3, 5, 6, 7, 8, 9}));
+  EXPECT_TABLE_EQ(_all_rows(TransactionManager::get().new_transaction_context()),
+                  _expected_rows({2, 3, 5, 6, 7, 8, 9}));
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->is_fully_invalidated(TransactionManager::get().last_commit_id()));
+
+  // chunk 0 is now fully invalidated, and chunk 1 does not reach the threshold
+  EXPECT_EQ(compactor.compact_table("table"), 0u);
+}
+
+TEST_F(ChunkCompactorTest, ReleasesChunksOnceNoTransactionSeesThem) {
+  _delete(ScanType::OpLessThan, 3);
+  const auto old_context = TransactionManager::get().new_transaction_context();
+
+  ChunkCompactor compactor(0.5f);
+  EXPECT_EQ(compactor.compact_table("table"), 1u);
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto old_rows = _validated_rows(ScanType::OpLessThan, 5, context)->input_left()->get_output();
+
+  // the old transaction still sees row 3 in chunk 0
+  EXPECT_EQ(compactor.release_chunks("table"), 0u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 4u);
+
+  old_context->commit();
+  EXPECT_EQ(compactor.release_chunks("table"), 1u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 0u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->mvcc_columns()->capacity(), 0u);
+  EXPECT_EQ(_table->row_count(), 7u);
+  EXPECT_EQ(_table->approx_valid_row_count(), 7u);
+  EXPECT_EQ(compactor.release_chunks("table"), 0u);
+
+  // RowIDs that a transaction obtained before the release are filtered by Validate
+  auto table_wrapper = std::make_shared<TableWrapper>(old_rows);
+  table_wrapper->execute();
+  auto validate = std::make_shared<Validate>(table_wrapper);
+  validate->set_transaction_context(context);
+  validate->execute();
+  EXPECT_TABLE_EQ(validate->get_output(), _expected_rows({3, 4}));
+
+  EXPECT_TABLE_EQ(_all_rows(context), _expected_rows({3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST_F(ChunkCompactorTest, ReusesReleasedChunkIds) {
+  ChunkCompactor compactor(0.5f);
+  _delete(ScanType::OpLessThan, 3);
+  EXPECT_EQ(compactor.compact_table("table"), 1u);
+  const auto old_context = TransactionManager::get().new_transaction_context();
+  EXPECT_EQ(compactor.release_chunks("table"), 1u);
+  ASSERT_EQ(_table->chunk_count(), 5u);
+
+  // the old transaction might still hold RowIDs of chunk 0, so that the compacted rows of chunk 1 are appended
+  _delete(ScanType::OpEquals, 4);
+  _delete(ScanType::OpEquals, 5);
+  EXPECT_EQ(compactor.compact_table("table"), 1u);
+  ASSERT_EQ(_table->chunk_count(), 6u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 0u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{4})->size(), 2u);
+
+  // afterwards, the compacted rows of chunk 2 take the place of chunk 0
+  old_context->commit();
+  _delete(ScanType::OpEquals, 8);
+  EXPECT_EQ(compactor.compact_table("table"), 1u);
+  ASSERT_EQ(_table->chunk_count(), 6u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 1u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->mvcc_columns()->capacity(), 1u);
+
+  EXPECT_TABLE_EQ(_all_rows(TransactionManager::get().new_transaction_context()), _expected_rows({3, 6, 7, 9}));
+}
+
+TEST_F(ChunkCompactorTest, DoesNotLoadSpilledChunksThatStayAsTheyAre) {
+  _delete(ScanType::OpEquals, 5);
+  auto& buffer_manager = BufferManager::get();
+  buffer_manager.set_memory_budget(1);
+  ASSERT_TRUE(_table->get_unpinned_chunk(ChunkID{0})->is_spilled());
+
+  // chunk 1 does not reach the threshold, so neither chunk is compacted or released
+  const auto load_count = buffer_manager.load_count();
+  ChunkCompactor compactor(0.5f);
+  compactor.run_once();
+  EXPECT_EQ(buffer_manager.load_count(), load_count);
+  EXPECT_EQ(_table->chunk_count(), 3u);
+}
+
+TEST_F(ChunkCompactorTest, UpdatesTableIndexes) {
+  _table->create_table_index(ColumnID{0});
+  _delete(ScanType::OpLessThan, 3);
+
+  ChunkCompactor compactor(0.5f);
+  compactor.compact_table("table");
+  compactor.release_chunks("table");
+  EXPECT_EQ(_table->get_table_index(ColumnID{0})->size(), 7u);
+
+  auto get_table = std::make_shared<GetTable>("table");
+  get_table->execute();
+  auto table_index_scan = std::make_shared<TableIndexScan>(get_table, ColumnID{0}, ScanType::OpLessThan, 5);
+  table_index_scan->execute();
+  EXPECT_TABLE_EQ(table_index_scan->get_output(), _expected_rows({3, 4}));
+}
+
+TEST_F(ChunkCompactorTest, GivesUpOnConflicts) {
+  _delete(ScanType::OpLessThan, 2);
+
+  // another transaction locks row 3
+  const auto context = TransactionManager::get().new_transaction_context();
+  auto delete_operator = std::make_shared<Delete>("table", _validated_rows(ScanType::OpEquals, 3, context));
+  delete_operator->set_transaction_context(context);
+  delete_operator->execute();
+
+  ChunkCompactor compactor(0.5f);
+  EXPECT_EQ(compactor.compact_table("table"), 0u);
+  EXPECT_EQ(_table->chunk_count(), 3u);
+
+  context->commit();
+  EXPECT_EQ(compactor.compact_table("table"), 1u);
+  EXPECT_TABLE_EQ(_all_rows(TransactionManager::get().new_transaction_context()),
+                  _expected_rows({2, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST_F(ChunkCompactorTest, RunsInBackground) {
+  auto other_table = std::make_shared<Table>(4);
+  other_table->add_column("a", "int");
+  StorageManager::get().add_table("other_table", other_table);
+  _delete(ScanType::OpLessThan, 4);
+
+  ChunkCompactor compactor;
+  compactor.start(std::chrono::milliseconds(1));
+  EXPECT_TRUE(compactor.is_running());
+  EXPECT_THROW(compactor.start(std::chrono::milliseconds(1)), std::exception);
+
+  for (auto attempt = 0; attempt < 1000 && _table->get_chunk(ChunkID{0})->size() > 0; ++attempt) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  compactor.stop();
+  EXPECT_FALSE(compactor.is_running());
+
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 0u);
+  EXPECT_TABLE_EQ(_all_rows(TransactionManager::get().new_transaction_context()), _expected_rows({4, 5, 6, 7, 8, 9}));
+}
+
+TEST_F(ChunkCompactorTest, ThrowsOnInvalidThresholds) {
+  EXPECT_THROW(ChunkCompactor(0.0f), std::exception);
+  EXPECT_THROW(ChunkCompactor(1.5f), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,115 @@
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/abstract_read_write_operator.hpp"
+
+namespace opossum {
+
+class TransactionContextTest : public BaseTest {
+ protected:
+  // counts the rollbacks, of which the ones of failing operators throw
+  class TestReadWriteOperator : public AbstractReadWriteOperator {
+   public:
+    TestReadWriteOperator(size_t& rollback_count, const bool fails) : _rollback_count(rollback_count), _fails(fails) {}
+
+    const std::string name() const override { return "TestReadWriteOperator"; }
+    void commit_records(CommitID) override {}
+    void rollback_records() override {
+      ++_rollback_count;
+      if (_fails) throw std::logic_error("Rollback failed");
+    }
+
+   protected:
+    std::shared_ptr<const Table> _on_execute() override { return nullptr; }
+
+    size_t& _rollback_count;
+    const bool _fails;
+  };
+};
+
+TEST_F(TransactionContextTest, AssignsIds) {
+  auto& manager = TransactionManager::get();
+  EXPECT_EQ(manager.last_commit_id(), 0u);
+
+  const auto first_context = manager.new_transaction_context();
+  const auto second_context = manager.new_transaction_context();
+  EXPECT_NE(first_context->transaction_id(), INVALID_TRANSACTION_ID);
+  EXPECT_LT(first_context->transaction_id(), second_context->transaction_id());
+  EXPECT_EQ(first_context->snapshot_commit_id(), 0u);
+  EXPECT_EQ(first_context->commit_id(), MAX_COMMIT_ID);
+
+  first_context->commit();
+  EXPECT_EQ(first_context->commit_id(), 1u);
+  EXPECT_EQ(manager.last_commit_id(), 1u);
+
+  // the snapshot of a transaction does not change when others commit
+  EXPECT_EQ(second_context->snapshot_commit_id(), 0u);
+  EXPECT_EQ(manager.new_transaction_context()->snapshot_commit_id(), 1u);
+}
+
+TEST_F(TransactionContextTest, Phases) {
+  const auto committed_context = TransactionManager::get().new_transaction_context();
+  EXPECT_EQ(committed_context->phase(), TransactionPhase::Active);
+  committed_context->commit();
+  EXPECT_EQ(committed_context->phase(), TransactionPhase::Committed);
+  EXPECT_THROW(committed_context->commit(), std::exception);
+  EXPECT_THROW(committed_context->rollback(), std::exception);
+
+  const auto rolled_back_context = TransactionManager::get().new_transaction_context();
+  rolled_back_context->rollback();
+  EXPECT_EQ(rolled_back_context->phase(), TransactionPhase::RolledBack);
+  EXPECT_THROW(rolled_back_context->commit(), std::exception);
+
+  // rolling back does not use up a CommitID
+  EXPECT_EQ(TransactionManager::get().last_commit_id(), 1u);
+}
+
+TEST_F(TransactionContextTest, DestructorRollsBackDespiteFailures) {
+  auto& manager = TransactionManager::get();
+  auto rollback_count = size_t{0};
+
+  {
+    const auto context = manager.new_transaction_context();
+    context->register_read_write_operator(std::make_shared<TestReadWriteOperator>(rollback_count, true));
+    context->register_read_write_operator(std::make_shared<TestReadWriteOperator>(rollback_count, false));
+    EXPECT_EQ(manager.lowest_active_snapshot_commit_id(), 0u);
+    manager.new_transaction_context()->commit();
+  }
+
+  // both operators were rolled back and the transaction does not hold back the lowest active snapshot anymore
+  EXPECT_EQ(rollback_count, 2u);
+  EXPECT_EQ(manager.lowest_active_snapshot_commit_id(), 1u);
+}
+
+TEST_F(TransactionContextTest, LowestActiveSnapshot) {
+  auto& manager = TransactionManager::get();
+  EXPECT_EQ(manager.lowest_active_snapshot_commit_id(), 0u);
+
+  const auto old_context = manager.new_transaction_context();
+  manager.new_transaction_context()->commit();
+  const auto new_context = manager.new_transaction_context();
+  EXPECT_EQ(manager.lowest_active_snapshot_commit_id(), 0u);
+
+  old_context->rollback();
+  EXPECT_EQ(manager.lowest_active_snapshot_commit_id(), 1u);
+
+  // without active transactions, the next transaction's snapshot is the lowest one
+  new_context->commit();
+  EXPECT_EQ(manager.lowest_active_snapshot_commit_id(), 2u);
+}
+
+TEST_F(TransactionContextTest, Reset) {
+  TransactionManager::get().new_transaction_context()->commit();
+  TransactionManager::reset();
+
+  EXPECT_EQ(TransactionManager::get().last_commit_id(), 0u);
+  EXPECT_EQ(TransactionManager::get().new_transaction_context()->transaction_id(), INVALID_TRANSACTION_ID + 1);
+}
+
+}  // namespace opossum
@@ -4,7 +4,7 @@
 #include "utils/performance_warning.hpp"
 
 int main(int argc, char** argv) {
-  PerformanceWarningDisabler pwd;
+  opossum::PerformanceWarningDisabler pwd;
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
 }
@@ -0,0 +1,82 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/limit.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/buffer_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsAbstractOperatorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsAbstractOperatorTest, RecordsPerformanceData) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  scan->execute();
+
+  const auto& performance_data = scan->performance_data();
+  EXPECT_GT(performance_data.walltime.count(), 0);
+  EXPECT_EQ(performance_data.input_row_count, 3u);
+  EXPECT_EQ(performance_data.input_chunk_count, 2u);
+  EXPECT_EQ(performance_data.output_row_count, 2u);
+  EXPECT_EQ(performance_data.output_chunk_count, 2u);
+  EXPECT_GT(performance_data.allocated_bytes, 0u);
+
+  // the wrapped table is not allocated by the TableWrapper
+  EXPECT_EQ(_table_wrapper->performance_data().output_row_count, 3u);
+  EXPECT_EQ(_table_wrapper->performance_data().allocated_bytes, 0u);
+}
+
+TEST_F(OperatorsAbstractOperatorTest, DoesNotCountForwardedColumnsAsAllocated) {
+  const auto table = std::const_pointer_cast<Table>(_table_wrapper->get_output());
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) table->compress_chunk(chunk_id);
+
+  auto projection = std::make_shared<Projection>(_table_wrapper, std::vector<ColumnID>{ColumnID{1}});
+  projection->execute();
+
+  EXPECT_EQ(projection->performance_data().output_row_count, 3u);
+  EXPECT_EQ(projection->performance_data().allocated_bytes, 0u);
+}
+
+TEST_F(OperatorsAbstractOperatorTest, DoesNotLoadSpilledChunksForPerformanceData) {
+  const auto table = std::const_pointer_cast<Table>(_table_wrapper->get_output());
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) table->compress_chunk(chunk_id);
+  BufferManager::get().set_memory_budget(1);
+  ASSERT_TRUE(table->get_unpinned_chunk(ChunkID{1})->is_spilled());
+
+  // the Projection loads every chunk once, the bookkeeping of the forwarded columns does not load them again
+  auto projection = std::make_shared<Projection>(_table_wrapper, std::vector<ColumnID>{ColumnID{1}});
+  projection->execute();
+  EXPECT_EQ(projection->performance_data().input_row_count, 3u);
+  EXPECT_EQ(projection->performance_data().output_row_count, 3u);
+  EXPECT_EQ(BufferManager::get().load_count(), 2u);
+
+  // the Limit only loads the first chunk
+  auto limit = std::make_shared<Limit>(_table_wrapper, 1);
+  limit->execute();
+  EXPECT_EQ(limit->performance_data().output_row_count, 1u);
+  EXPECT_EQ(BufferManager::get().load_count(), 3u);
+}
+
+TEST_F(OperatorsAbstractOperatorTest, DescribesOperator) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpLessThan, 457.5f);
+  EXPECT_EQ(scan->name(), "TableScan");
+  EXPECT_EQ(scan->description(), "TableScan (#1 < 457.5)");
+  EXPECT_EQ(_table_wrapper->description(), "TableWrapper");
+}
+
+}  // namespace opossum
@@ -0,0 +1,192 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/buffer_manager.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsDeleteTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3, PolymorphicAllocator<size_t>{}, UseMvcc::Yes);
+    _table->add_column("a", "int");
+    for (auto value = 0; value < 7; ++value) _table->append({value});
+    StorageManager::get().add_table("table", _table);
+  }
+
+  // returns the rows that the transaction sees and that match a < value
+  std::shared_ptr<const AbstractOperator> _rows_less_than(const int value,
+                                                          const std::shared_ptr<TransactionContext>& context) {
+    auto get_table = std::make_shared<GetTable>("table");
+    get_table->execute();
+    auto table_scan = std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpLessThan, value);
+    table_scan->set_transaction_context(context);
+    table_scan->execute();
+    auto validate = std::make_shared<Validate>(table_scan);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate;
+  }
+
+  std::shared_ptr<Delete> _delete(const std::shared_ptr<const AbstractOperator>& rows,
+                                  const std::shared_ptr<TransactionContext>& context) {
+    auto delete_operator = std::make_shared<Delete>("table", rows);
+    delete_operator->set_transaction_context(context);
+    delete_operator->execute();
+    return delete_operator;
+  }
+
+  uint64_t _visible_row_count(const std::shared_ptr<TransactionContext>& context) {
+    return _rows_less_than(100, context)->get_output()->row_count();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsDeleteTest, DeletesRows) {
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto older_context = TransactionManager::get().new_transaction_context();
+  const auto delete_operator = _delete(_rows_less_than(4, context), context);
+  EXPECT_FALSE(delete_operator->execute_failed());
+  EXPECT_EQ(delete_operator->get_output(), nullptr);
+
+  // the deletion is only visible to the deleting transaction until it commits
+  EXPECT_EQ(_visible_row_count(context), 3u);
+  EXPECT_EQ(_visible_row_count(older_context), 7u);
+  EXPECT_EQ(_table->approx_valid_row_count(), 7u);
+
+  context->commit();
+  EXPECT_EQ(_visible_row_count(older_context), 7u);
+  EXPECT_EQ(_visible_row_count(TransactionManager::get().new_transaction_context()), 3u);
+
+  // rows are invalidated in place
+  EXPECT_EQ(_table->row_count(), 7u);
+  EXPECT_EQ(_table->approx_valid_row_count(), 3u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->invalid_row_count(), 3u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->invalid_row_count(), 1u);
+}
+
+TEST_F(OperatorsDeleteTest, RollbackRestoresRows) {
+  const auto context = TransactionManager::get().new_transaction_context();
+  _delete(_rows_less_than(4, context), context);
+  context->rollback();
+
+  EXPECT_EQ(_visible_row_count(TransactionManager::get().new_transaction_context()), 7u);
+  EXPECT_EQ(_table->approx_valid_row_count(), 7u);
+
+  // the rows are not locked anymore
+  const auto next_context = TransactionManager::get().new_transaction_context();
+  EXPECT_FALSE(_delete(_rows_less_than(4, next_context), next_context)->execute_failed());
+}
+
+TEST_F(OperatorsDeleteTest, ConflictingDeletesFail) {
+  const auto first_context = TransactionManager::get().new_transaction_context();
+  const auto second_context = TransactionManager::get().new_transaction_context();
+  const auto second_rows = _rows_less_than(2, second_context);
+
+  EXPECT_FALSE(_delete(_rows_less_than(4, first_context), first_context)->execute_failed());
+  // the rows are locked by the first transaction
+  EXPECT_TRUE(_delete(second_rows, second_context)->execute_failed());
+  EXPECT_THROW(second_context->commit(), std::exception);
+  second_context->rollback();
+
+  // the rows were deleted after the third transaction's snapshot was taken
+  const auto third_context = TransactionManager::get().new_transaction_context();
+  const auto third_rows = _rows_less_than(2, third_context);
+  first_context->commit();
+  EXPECT_TRUE(_delete(third_rows, third_context)->execute_failed());
+  third_context->rollback();
+
+  EXPECT_EQ(_visible_row_count(TransactionManager::get().new_transaction_context()), 3u);
+}
+
+TEST_F(OperatorsDeleteTest, DeletesOwnInsertions) {
+  auto values = std::make_shared<Table>();
+  values->add_column("a", "int");
+  values->append({-1});
+  auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  const auto context = TransactionManager::get().new_transaction_context();
+  auto insert = std::make_shared<Insert>("table", table_wrapper);
+  insert->set_transaction_context(context);
+  insert->execute();
+  EXPECT_EQ(_visible_row_count(context), 8u);
+
+  EXPECT_FALSE(_delete(_rows_less_than(0, context), context)->execute_failed());
+  EXPECT_EQ(_visible_row_count(context), 7u);
+
+  context->commit();
+  EXPECT_EQ(_visible_row_count(TransactionManager::get().new_transaction_context()), 7u);
+  EXPECT_EQ(_table->approx_valid_row_count(), 7u);
+}
+
+TEST_F(OperatorsDeleteTest, SkipsFullyInvalidatedChunks) {
+  const auto older_context = TransactionManager::get().new_transaction_context();
+  const auto context = TransactionManager::get().new_transaction_context();
+  _delete(_rows_less_than(3, context), context);
+  context->commit();
+
+  const auto newer_context = TransactionManager::get().new_transaction_context();
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->is_fully_invalidated(newer_context->snapshot_commit_id()));
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->is_fully_invalidated(older_context->snapshot_commit_id()));
+  EXPECT_FALSE(_table->get_chunk(ChunkID{1})->is_fully_invalidated(newer_context->snapshot_commit_id()));
+
+  // the scan produces no rows for the chunk, the older transaction still sees them
+  EXPECT_EQ(_rows_less_than(3, newer_context)->input_left()->get_output()->row_count(), 0u);
+  EXPECT_EQ(_rows_less_than(3, older_context)->get_output()->row_count(), 3u);
+}
+
+TEST_F(OperatorsDeleteTest, DoesNotLoadSpilledChunks) {
+  _table->compress_chunk(ChunkID{0});
+  _table->compress_chunk(ChunkID{1});
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto rows = _rows_less_than(4, context);
+
+  // the MVCC columns of spilled chunks stay in memory, so neither locking the rows nor the commit loads the chunks
+  auto& buffer_manager = BufferManager::get();
+  buffer_manager.set_memory_budget(1);
+  ASSERT_TRUE(_table->get_unpinned_chunk(ChunkID{0})->is_spilled());
+  const auto load_count = buffer_manager.load_count();
+  const auto delete_operator = _delete(rows, context);
+  EXPECT_FALSE(delete_operator->execute_failed());
+  context->commit();
+  EXPECT_EQ(buffer_manager.load_count(), load_count);
+
+  EXPECT_EQ(_visible_row_count(TransactionManager::get().new_transaction_context()), 3u);
+}
+
+TEST_F(OperatorsDeleteTest, ThrowsOnOtherTables) {
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", "int");
+  table->append({1});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 1);
+  table_scan->execute();
+
+  const auto context = TransactionManager::get().new_transaction_context();
+  EXPECT_THROW(_delete(table_scan, context), std::exception);
+}
+
+TEST_F(OperatorsDeleteTest, Description) {
+  const auto delete_operator = std::make_shared<Delete>("table", nullptr);
+  EXPECT_EQ(delete_operator->name(), "Delete");
+  EXPECT_EQ(delete_operator->description(), "Delete (table)");
+}
+
+}  // namespace opossum
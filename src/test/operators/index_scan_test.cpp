@@ -0,0 +1,113 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/index_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsIndexScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // chunks 0 and 1 are compressed and indexed, chunk 2 is neither
+    auto table = std::make_shared<Table>(5);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    for (auto row = 0; row < 13; ++row) {
+      table->append({row % 4, std::string(1, static_cast<char>('v' + row % 3))});
+    }
+
+    for (ChunkID chunk_id{0}; chunk_id < 2; ++chunk_id) {
+      table->compress_chunk(chunk_id);
+      table->get_chunk(chunk_id)->create_index<GroupKeyIndex>({ColumnID{0}});
+      table->get_chunk(chunk_id)->create_index<CompositeGroupKeyIndex>({ColumnID{0}, ColumnID{1}});
+    }
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  // returns the result of the equivalent TableScans
+  std::shared_ptr<const Table> _table_scans(const std::vector<ColumnID>& column_ids, const ScanType scan_type,
+                                            const std::vector<AllTypeVariant>& search_values) {
+    std::shared_ptr<const AbstractOperator> input = _table_wrapper;
+    for (size_t column_index = 0; column_index < column_ids.size(); ++column_index) {
+      const auto is_last_column = column_index + 1 == column_ids.size();
+      auto table_scan = std::make_shared<TableScan>(input, column_ids[column_index],
+                                                    is_last_column ? scan_type : ScanType::OpEquals,
+                                                    search_values[column_index]);
+      table_scan->execute();
+      input = table_scan;
+    }
+    return input->get_output();
+  }
+
+  std::shared_ptr<const Table> _index_scan(const ColumnIndexType index_type, const std::vector<ColumnID>& column_ids,
+                                           const ScanType scan_type, const std::vector<AllTypeVariant>& search_values) {
+    auto index_scan = std::make_shared<IndexScan>(_table_wrapper, index_type, column_ids, scan_type, search_values);
+    index_scan->execute();
+    return index_scan->get_output();
+  }
+
+  const std::vector<ScanType> _scan_types{ScanType::OpEquals,         ScanType::OpNotEquals,
+                                          ScanType::OpLessThan,       ScanType::OpLessThanEquals,
+                                          ScanType::OpGreaterThan,    ScanType::OpGreaterThanEquals};
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsIndexScanTest, SingleColumnMatchesTableScan) {
+  for (const auto scan_type : _scan_types) {
+    for (const auto search_value : {-1, 0, 2, 3, 7}) {
+      SCOPED_TRACE(to_string(scan_type) + " " + std::to_string(search_value));
+      const auto column_ids = std::vector<ColumnID>{ColumnID{0}};
+      EXPECT_TABLE_EQ(_index_scan(ColumnIndexType::GroupKey, column_ids, scan_type, {search_value}),
+                      _table_scans(column_ids, scan_type, {search_value}), true);
+    }
+  }
+}
+
+TEST_F(OperatorsIndexScanTest, CompositeMatchesTableScans) {
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}, ColumnID{1}};
+  for (const auto scan_type : _scan_types) {
+    for (const auto a : {0, 1, 5}) {
+      for (const auto& b : {"a", "v", "w", "x", "z"}) {
+        SCOPED_TRACE(std::to_string(a) + " " + to_string(scan_type) + " " + b);
+        EXPECT_TABLE_EQ(_index_scan(ColumnIndexType::CompositeGroupKey, column_ids, scan_type, {a, b}),
+                        _table_scans(column_ids, scan_type, {a, b}), true);
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsIndexScanTest, ScansChunksWithoutMatchingIndex) {
+  // the chunks only have a CompositeGroupKeyIndex on (a, b), so all chunks are scanned
+  const auto result = _index_scan(ColumnIndexType::CompositeGroupKey, {ColumnID{0}}, ScanType::OpEquals, {1});
+  EXPECT_TABLE_EQ(result, _table_scans({ColumnID{0}}, ScanType::OpEquals, {1}), true);
+  EXPECT_EQ(result->row_count(), 3u);
+}
+
+TEST_F(OperatorsIndexScanTest, Description) {
+  const auto index_scan = std::make_shared<IndexScan>(_table_wrapper, ColumnIndexType::CompositeGroupKey,
+                                                      std::vector<ColumnID>{ColumnID{0}, ColumnID{1}},
+                                                      ScanType::OpLessThan, std::vector<AllTypeVariant>{1, "w"});
+  EXPECT_EQ(index_scan->name(), "IndexScan");
+  EXPECT_EQ(index_scan->description(), "IndexScan (#0 = 1 AND #1 < w)");
+}
+
+TEST_F(OperatorsIndexScanTest, ThrowsForMissingSearchValues) {
+  EXPECT_THROW(IndexScan(_table_wrapper, ColumnIndexType::CompositeGroupKey, {ColumnID{0}, ColumnID{1}},
+                         ScanType::OpEquals, {1}),
+               std::exception);
+}
+
+}  // namespace opossum
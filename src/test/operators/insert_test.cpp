@@ -0,0 +1,134 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsInsertTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(3, PolymorphicAllocator<size_t>{}, UseMvcc::Yes);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->append({1, "one"});
+    table->append({2, "two"});
+    StorageManager::get().add_table("table", table);
+
+    auto values = std::make_shared<Table>(2);
+    values->add_column("a", "int");
+    values->add_column("b", "string");
+    values->append({3, "three"});
+    values->append({4, "four"});
+    values->append({5, "five"});
+    _values = std::make_shared<TableWrapper>(values);
+    _values->execute();
+  }
+
+  // returns the rows of the table that are visible to the transaction
+  std::shared_ptr<const Table> _visible_rows(const std::shared_ptr<TransactionContext>& context) {
+    auto get_table = std::make_shared<GetTable>("table");
+    get_table->execute();
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output();
+  }
+
+  std::shared_ptr<TableWrapper> _values;
+};
+
+TEST_F(OperatorsInsertTest, InsertsRows) {
+  const auto context = TransactionManager::get().new_transaction_context();
+  auto insert = std::make_shared<Insert>("table", _values);
+  insert->set_transaction_context(context);
+  insert->execute();
+  EXPECT_EQ(insert->get_output(), nullptr);
+
+  const auto table = StorageManager::get().get_table("table");
+  EXPECT_EQ(table->row_count(), 5u);
+  EXPECT_EQ(table->chunk_count(), 2u);
+  EXPECT_EQ(_visible_rows(context)->row_count(), 5u);
+
+  context->commit();
+  EXPECT_EQ(_visible_rows(TransactionManager::get().new_transaction_context())->row_count(), 5u);
+}
+
+TEST_F(OperatorsInsertTest, InsertsReferencedRows) {
+  auto table_scan = std::make_shared<TableScan>(_values, ColumnID{0}, ScanType::OpGreaterThan, 3);
+  table_scan->execute();
+
+  const auto context = TransactionManager::get().new_transaction_context();
+  auto insert = std::make_shared<Insert>("table", table_scan);
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "string");
+  expected->append({1, "one"});
+  expected->append({2, "two"});
+  expected->append({4, "four"});
+  expected->append({5, "five"});
+  EXPECT_TABLE_EQ(_visible_rows(TransactionManager::get().new_transaction_context()), expected, true);
+}
+
+TEST_F(OperatorsInsertTest, RollbackHidesRows) {
+  const auto context = TransactionManager::get().new_transaction_context();
+  auto insert = std::make_shared<Insert>("table", _values);
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->rollback();
+
+  EXPECT_EQ(_visible_rows(context)->row_count(), 2u);
+  EXPECT_EQ(_visible_rows(TransactionManager::get().new_transaction_context())->row_count(), 2u);
+}
+
+TEST_F(OperatorsInsertTest, DestroyedTransactionIsRolledBack) {
+  {
+    const auto context = TransactionManager::get().new_transaction_context();
+    auto insert = std::make_shared<Insert>("table", _values);
+    insert->set_transaction_context(context);
+    insert->execute();
+  }
+
+  EXPECT_EQ(_visible_rows(TransactionManager::get().new_transaction_context())->row_count(), 2u);
+}
+
+TEST_F(OperatorsInsertTest, ThrowsWithoutTransaction) {
+  auto insert = std::make_shared<Insert>("table", _values);
+  EXPECT_THROW(insert->execute(), std::exception);
+}
+
+TEST_F(OperatorsInsertTest, ThrowsOnMismatchingColumns) {
+  auto values = std::make_shared<Table>();
+  values->add_column("a", "int");
+  values->add_column("b", "int");
+  auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  const auto context = TransactionManager::get().new_transaction_context();
+  auto insert = std::make_shared<Insert>("table", table_wrapper);
+  insert->set_transaction_context(context);
+  EXPECT_THROW(insert->execute(), std::exception);
+}
+
+TEST_F(OperatorsInsertTest, Description) {
+  const auto insert = std::make_shared<Insert>("table", _values);
+  EXPECT_EQ(insert->name(), "Insert");
+  EXPECT_EQ(insert->description(), "Insert (table)");
+}
+
+}  // namespace opossum
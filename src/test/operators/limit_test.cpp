@@ -0,0 +1,62 @@
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/limit.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsLimitTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int");
+    for (int i = 0; i < 8; ++i) _table->append({i});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> _expected(int row_count) {
+    auto expected = std::make_shared<Table>();
+    expected->add_column("a", "int");
+    for (int i = 0; i < row_count; ++i) expected->append({i});
+    return expected;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsLimitTest, ReturnsFirstRows) {
+  auto limit = std::make_shared<Limit>(_table_wrapper, 5);
+  limit->execute();
+
+  const auto output = limit->get_output();
+  EXPECT_TABLE_EQ(output, _expected(5), true);
+  EXPECT_EQ(output->chunk_count(), ChunkID{2});
+
+  const auto column =
+      std::dynamic_pointer_cast<const ReferenceColumn>(output->get_chunk(ChunkID{0})->get_column(ColumnID{0}));
+  ASSERT_NE(column, nullptr);
+  EXPECT_EQ(column->referenced_table(), _table);
+}
+
+TEST_F(OperatorsLimitTest, ReturnsWholeInputIfLimitIsLarger) {
+  auto limit = std::make_shared<Limit>(_table_wrapper, 100);
+  limit->execute();
+  EXPECT_TABLE_EQ(limit->get_output(), _expected(8), true);
+}
+
+TEST_F(OperatorsLimitTest, ReturnsEmptyTableForZeroRows) {
+  auto limit = std::make_shared<Limit>(_table_wrapper, 0);
+  limit->execute();
+  EXPECT_EQ(limit->get_output()->row_count(), 0u);
+  EXPECT_EQ(limit->get_output()->col_count(), 1u);
+}
+
+}  // namespace opossum
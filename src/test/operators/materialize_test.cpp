@@ -0,0 +1,109 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/materialize.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/buffer_manager.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsMaterializeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("src/test/tables/int_float.tbl", 2);
+    _table->compress_chunk(ChunkID{0});
+  }
+
+  // creates an operator whose output references _table at the given positions, one chunk per PosList
+  std::shared_ptr<TableWrapper> _reference(const std::vector<PosList>& pos_lists) {
+    auto reference_table = std::make_shared<Table>();
+    reference_table->add_column_definition("a", "int");
+    reference_table->add_column_definition("b", "float");
+
+    for (const auto& pos_list : pos_lists) {
+      const auto shared_pos_list = std::make_shared<PosList>(pos_list);
+      Chunk chunk;
+      chunk.add_column(std::make_shared<ReferenceColumn>(_table, ColumnID{0}, shared_pos_list));
+      chunk.add_column(std::make_shared<ReferenceColumn>(_table, ColumnID{1}, shared_pos_list));
+      reference_table->emplace_chunk(std::move(chunk));
+    }
+
+    auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsMaterializeTest, MaterializesReferencedValues) {
+  auto materialize = std::make_shared<Materialize>(
+      _reference({{RowID{ChunkID{1}, 0}, RowID{ChunkID{0}, 1}}, {RowID{ChunkID{0}, 0}}}));
+  materialize->execute();
+
+  const auto output = materialize->get_output();
+  EXPECT_TABLE_EQ(output, _table);
+  ASSERT_EQ(output->chunk_count(), ChunkID{2});
+
+  // positions from different chunks are gathered into a ValueColumn
+  const auto value_column =
+      std::dynamic_pointer_cast<const ValueColumn<int>>(output->get_chunk(ChunkID{0})->get_column(ColumnID{0}));
+  ASSERT_NE(value_column, nullptr);
+  EXPECT_EQ(value_column->values()[0], 1234);
+  EXPECT_EQ(value_column->values()[1], 123);
+}
+
+TEST_F(OperatorsMaterializeTest, ReusesDictionaryOfSingleReferencedChunk) {
+  auto materialize = std::make_shared<Materialize>(_reference({{RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 1}}}));
+  materialize->execute();
+
+  const auto column = std::dynamic_pointer_cast<const DictionaryColumn<float>>(
+      materialize->get_output()->get_chunk(ChunkID{0})->get_column(ColumnID{1}));
+  const auto referenced_column =
+      std::dynamic_pointer_cast<const DictionaryColumn<float>>(_table->get_chunk(ChunkID{0})->get_column(ColumnID{1}));
+  ASSERT_NE(column, nullptr);
+  EXPECT_EQ(column->dictionary(), referenced_column->dictionary());
+  EXPECT_EQ(column->size(), 2u);
+  EXPECT_FLOAT_EQ(column->get(0), 456.7f);
+  EXPECT_FLOAT_EQ(column->get(1), 456.7f);
+}
+
+TEST_F(OperatorsMaterializeTest, GathersFromSpilledChunks) {
+  // every chunk that is not pinned is spilled, so the gather has to keep the chunks it reads from
+  _table->compress_chunk(ChunkID{1});
+  BufferManager::get().set_memory_budget(1);
+
+  auto materialize = std::make_shared<Materialize>(
+      _reference({{RowID{ChunkID{1}, 0}, RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 0}, RowID{ChunkID{0}, 0}}}));
+  materialize->execute();
+
+  const auto column = materialize->get_output()->get_chunk(ChunkID{0})->get_column(ColumnID{0});
+  ASSERT_EQ(column->size(), 4u);
+  EXPECT_EQ(type_cast<int>((*column)[0]), 1234);
+  EXPECT_EQ(type_cast<int>((*column)[1]), 123);
+  EXPECT_EQ(type_cast<int>((*column)[2]), 1234);
+  EXPECT_EQ(type_cast<int>((*column)[3]), 12345);
+}
+
+TEST_F(OperatorsMaterializeTest, ForwardsDataColumns) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto materialize = std::make_shared<Materialize>(table_wrapper);
+  materialize->execute();
+
+  const auto output = materialize->get_output();
+  EXPECT_TABLE_EQ(output, _table);
+  EXPECT_EQ(output->get_chunk(ChunkID{1})->get_column(ColumnID{0}),
+            _table->get_chunk(ChunkID{1})->get_column(ColumnID{0}));
+}
+
+}  // namespace opossum
@@ -0,0 +1,191 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/limit.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/projection.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+// Projection that counts the chunks it processes
+class CountingProjection : public Projection {
+ public:
+  using Projection::Projection;
+
+  size_t processed_chunk_count() const { return _processed_chunk_count; }
+
+ protected:
+  Chunk _on_execute_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id,
+                          size_t emitted_row_count) const override {
+    ++_processed_chunk_count;
+    return Projection::_on_execute_chunk(input_table, chunk_id, emitted_row_count);
+  }
+
+  mutable size_t _processed_chunk_count = 0;
+};
+
+// Pipeline that exposes its intermediate tables
+class TestPipeline : public Pipeline {
+ public:
+  using Pipeline::Pipeline;
+
+  const std::vector<std::shared_ptr<Table>>& intermediate_tables() const { return _intermediate_tables; }
+};
+
+class OperatorsPipelineTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4);
+    _table->add_column("a", "int");
+    _table->add_column("b", "int");
+    for (int i = 0; i < 20; ++i) _table->append({i, i % 3});
+    _table->compress_chunk(ChunkID{1});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsPipelineTest, ProducesSameResultAsOperatorAtATimeExecution) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpEquals, 0);
+  auto projection = std::make_shared<Projection>(scan, std::vector<ColumnID>{ColumnID{0}});
+  auto limit = std::make_shared<Limit>(projection, 5);
+
+  const auto pipelined_output = Pipeline(limit).execute();
+
+  scan->execute();
+  projection->execute();
+  limit->execute();
+
+  EXPECT_TABLE_EQ(pipelined_output, limit->get_output(), true);
+  EXPECT_EQ(pipelined_output->row_count(), 5u);
+}
+
+TEST_F(OperatorsPipelineTest, ReferencesOneTablePerOperator) {
+  // the Projection forwards DictionaryColumns, so the scan references the Projection's output instead of _table
+  for (ChunkID chunk_id{2}; chunk_id < _table->chunk_count(); ++chunk_id) _table->compress_chunk(chunk_id);
+  _table->compress_chunk(ChunkID{0});
+  auto projection = std::make_shared<Projection>(_table_wrapper, std::vector<ColumnID>{ColumnID{1}, ColumnID{0}});
+  auto scan = std::make_shared<TableScan>(projection, ColumnID{0}, ScanType::OpEquals, 0);
+
+  const std::shared_ptr<const Table> output = Pipeline(scan).execute();
+  ASSERT_GT(output->chunk_count(), 1u);
+  const auto referenced_table = std::dynamic_pointer_cast<const ReferenceColumn>(
+                                    output->get_chunk(ChunkID{0})->get_column(ColumnID{0}))
+                                    ->referenced_table();
+  for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto column =
+        std::dynamic_pointer_cast<const ReferenceColumn>(output->get_chunk(chunk_id)->get_column(ColumnID{0}));
+    EXPECT_EQ(column->referenced_table(), referenced_table);
+  }
+
+  // operators that require a single referenced table accept the output
+  auto table_wrapper = std::make_shared<TableWrapper>(output);
+  table_wrapper->execute();
+  auto sort = std::make_shared<Sort>(table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{1}}});
+  sort->execute();
+  EXPECT_EQ(sort->get_output()->row_count(), 7u);
+}
+
+TEST_F(OperatorsPipelineTest, ScansIntermediateTablesThatGrow) {
+  // the second scan reads an intermediate table that gains a chunk per input chunk while the scan's reader is kept
+  auto first_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 2);
+  auto second_scan = std::make_shared<TableScan>(first_scan, ColumnID{1}, ScanType::OpEquals, 0);
+
+  const auto pipelined_output = Pipeline(second_scan).execute();
+
+  first_scan->execute();
+  second_scan->execute();
+
+  EXPECT_TABLE_EQ(pipelined_output, second_scan->get_output(), true);
+  EXPECT_EQ(pipelined_output->row_count(), 6u);
+}
+
+TEST_F(OperatorsPipelineTest, ReleasesConsumedIntermediateChunks) {
+  auto first_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 2);
+  auto second_scan = std::make_shared<TableScan>(first_scan, ColumnID{1}, ScanType::OpEquals, 0);
+  auto projection = std::make_shared<Projection>(second_scan, std::vector<ColumnID>{ColumnID{0}});
+
+  TestPipeline pipeline(projection);
+  auto chunk = pipeline.next_chunk();
+  ASSERT_TRUE(chunk);
+  for (const auto& intermediate_table : pipeline.intermediate_tables()) {
+    EXPECT_EQ(intermediate_table->row_count(), 0u);
+  }
+
+  // the rows are still read through the released chunks' ReferenceColumns, which reference _table
+  const auto output = pipeline.execute();
+  EXPECT_EQ(chunk->size() + output->row_count(), 6u);
+  for (const auto& intermediate_table : pipeline.intermediate_tables()) {
+    EXPECT_EQ(intermediate_table->row_count(), 0u);
+  }
+}
+
+TEST_F(OperatorsPipelineTest, KeepsIntermediateChunksWithForwardedColumns) {
+  _table->compress_chunk(ChunkID{0});
+  auto projection = std::make_shared<Projection>(_table_wrapper, std::vector<ColumnID>{ColumnID{1}, ColumnID{0}});
+  auto scan = std::make_shared<TableScan>(projection, ColumnID{0}, ScanType::OpEquals, 0);
+
+  // the scan's output references the Projection's output, which holds the DictionaryColumns of chunks 0 and 1
+  TestPipeline pipeline(scan);
+  const auto output = pipeline.execute();
+  EXPECT_EQ(output->row_count(), 7u);
+  EXPECT_EQ(pipeline.intermediate_tables().front()->row_count(), 8u);
+}
+
+TEST_F(OperatorsPipelineTest, ReturnsOneChunkAtATime) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 6);
+  Pipeline pipeline(scan);
+
+  // chunk 0 (rows 0 to 3) does not contain any matches and is skipped
+  auto chunk = pipeline.next_chunk();
+  ASSERT_TRUE(chunk);
+  EXPECT_EQ(chunk->size(), 2u);
+
+  const auto column = std::dynamic_pointer_cast<const ReferenceColumn>(chunk->get_column(ColumnID{0}));
+  ASSERT_NE(column, nullptr);
+  EXPECT_EQ(column->referenced_table(), _table);
+  EXPECT_EQ((*column->pos_list())[0], (RowID{ChunkID{1}, 2}));
+
+  size_t chunk_count = 1;
+  while (pipeline.next_chunk()) ++chunk_count;
+  EXPECT_EQ(chunk_count, 4u);
+}
+
+TEST_F(OperatorsPipelineTest, StopsReadingOnceLimitIsReached) {
+  auto projection = std::make_shared<CountingProjection>(_table_wrapper, std::vector<ColumnID>{ColumnID{1}});
+  auto limit = std::make_shared<Limit>(projection, 6);
+
+  const auto output = Pipeline(limit).execute();
+  EXPECT_EQ(output->row_count(), 6u);
+  EXPECT_EQ(projection->processed_chunk_count(), 2u);
+}
+
+TEST_F(OperatorsPipelineTest, KeepsColumnsOfEmptyResult) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 0);
+  auto projection = std::make_shared<Projection>(scan, std::vector<ColumnID>{ColumnID{1}});
+
+  const auto output = Pipeline(projection).execute();
+  EXPECT_EQ(output->row_count(), 0u);
+  ASSERT_EQ(output->chunk_count(), ChunkID{1});
+  EXPECT_EQ(output->get_chunk(ChunkID{0})->col_count(), 1u);
+}
+
+TEST_F(OperatorsPipelineTest, RequiresExecutedInput) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 0);
+  EXPECT_THROW(Pipeline{scan}, std::exception);
+}
+
+}  // namespace opossum
@@ -12,109 +12,109 @@
 
 namespace opossum {
 
-// class OperatorsPrintTest : public BaseTest {
-//  protected:
-//   void SetUp() override {
-//     t = std::make_shared<Table>(Table(chunk_size));
-//     t->add_column("col_1", "int");
-//     t->add_column("col_2", "string");
-//     StorageManager::get().add_table(table_name, t);
+class OperatorsPrintTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    t = std::make_shared<Table>(Table(chunk_size));
+    t->add_column("col_1", "int");
+    t->add_column("col_2", "string");
+    StorageManager::get().add_table(table_name, t);
 
-//     gt = std::make_shared<GetTable>(table_name);
-//     gt->execute();
-//   }
+    gt = std::make_shared<GetTable>(table_name);
+    gt->execute();
+  }
 
-//   std::ostringstream output;
+  std::ostringstream output;
 
-//   std::string table_name = "printTestTable";
+  std::string table_name = "printTestTable";
 
-//   uint32_t chunk_size = 10;
+  uint32_t chunk_size = 10;
 
-//   std::shared_ptr<GetTable>(gt);
-//   std::shared_ptr<Table> t = nullptr;
-// };
+  std::shared_ptr<GetTable> gt;
+  std::shared_ptr<Table> t = nullptr;
+};
 
-// // class used to make protected methods visible without
-// // modifying the base class with testing code.
-// class PrintWrapper : public Print {
-//   std::shared_ptr<const Table> tab;
+// class used to make protected methods visible without
+// modifying the base class with testing code.
+class PrintWrapper : public Print {
+  std::shared_ptr<const Table> tab;
 
-//  public:
-//   explicit PrintWrapper(const std::shared_ptr<AbstractOperator> in) : Print(in), tab(in->get_output()) {}
-//   std::vector<uint16_t> test_column_string_widths(uint16_t min, uint16_t max) {
-//     return column_string_widths(min, max, tab);
-//   }
-// };
+ public:
+  explicit PrintWrapper(const std::shared_ptr<AbstractOperator> in) : Print(in), tab(in->get_output()) {}
+  std::vector<uint16_t> test_column_string_widths(uint16_t min, uint16_t max) {
+    return column_string_widths(min, max, tab);
+  }
+};
 
-// TEST_F(OperatorsPrintTest, EmptyTable) {
-//   auto pr = std::make_shared<Print>(gt, output);
-//   pr->execute();
+TEST_F(OperatorsPrintTest, EmptyTable) {
+  auto pr = std::make_shared<Print>(gt, output);
+  pr->execute();
 
-//   // check if table is correctly passed
-//   EXPECT_EQ(pr->get_output(), t);
+  // check if table is correctly passed
+  EXPECT_EQ(pr->get_output(), t);
 
-//   auto output_str = output.str();
+  auto output_str = output.str();
 
-//   // rather hard-coded tests
-//   EXPECT_TRUE(output_str.find("col_1") != std::string::npos);
-//   EXPECT_TRUE(output_str.find("col_2") != std::string::npos);
-//   EXPECT_TRUE(output_str.find("int") != std::string::npos);
-//   EXPECT_TRUE(output_str.find("string") != std::string::npos);
+  // rather hard-coded tests
+  EXPECT_TRUE(output_str.find("col_1") != std::string::npos);
+  EXPECT_TRUE(output_str.find("col_2") != std::string::npos);
+  EXPECT_TRUE(output_str.find("int") != std::string::npos);
+  EXPECT_TRUE(output_str.find("string") != std::string::npos);
 
-//   EXPECT_TRUE(output_str.find("Empty chunk.") != std::string::npos);
-// }
+  EXPECT_TRUE(output_str.find("Empty chunk.") != std::string::npos);
+}
 
-// TEST_F(OperatorsPrintTest, FilledTable) {
-//   auto tab = StorageManager::get().get_table(table_name);
-//   for (size_t i = 0; i < chunk_size * 2; i++) {
-//     // char 97 is an 'a'
-//     tab->append({static_cast<int>(i % chunk_size), std::string(1, 97 + static_cast<int>(i / chunk_size))});
-//   }
+TEST_F(OperatorsPrintTest, FilledTable) {
+  auto tab = StorageManager::get().get_table(table_name);
+  for (size_t i = 0; i < chunk_size * 2; i++) {
+    // char 97 is an 'a'
+    tab->append({static_cast<int>(i % chunk_size), std::string(1, 97 + static_cast<int>(i / chunk_size))});
+  }
 
-//   auto pr = std::make_shared<Print>(gt, output);
-//   pr->execute();
+  auto pr = std::make_shared<Print>(gt, output);
+  pr->execute();
 
-//   // check if table is correctly passed
-//   EXPECT_EQ(pr->get_output(), tab);
+  // check if table is correctly passed
+  EXPECT_EQ(pr->get_output(), tab);
 
-//   auto output_str = output.str();
+  auto output_str = output.str();
 
-//   EXPECT_TRUE(output_str.find("Chunk 0") != std::string::npos);
-//   // there should not be a third chunk (at least that's the current impl)
-//   EXPECT_TRUE(output_str.find("Chunk 3") == std::string::npos);
+  EXPECT_TRUE(output_str.find("Chunk 0") != std::string::npos);
+  // there should not be a third chunk (at least that's the current impl)
+  EXPECT_TRUE(output_str.find("Chunk 3") == std::string::npos);
 
-//   // remove spaces
-//   output_str.erase(remove_if(output_str.begin(), output_str.end(), isspace), output_str.end());
+  // remove spaces
+  output_str.erase(remove_if(output_str.begin(), output_str.end(), isspace), output_str.end());
 
-//   EXPECT_TRUE(output_str.find("|2|a|") != std::string::npos);
-//   EXPECT_TRUE(output_str.find("|9|b|") != std::string::npos);
-//   EXPECT_TRUE(output_str.find("|10|a|") == std::string::npos);
+  EXPECT_TRUE(output_str.find("|2|a|") != std::string::npos);
+  EXPECT_TRUE(output_str.find("|9|b|") != std::string::npos);
+  EXPECT_TRUE(output_str.find("|10|a|") == std::string::npos);
 
-//   // EXPECT_TRUE(output_str.find("Empty chunk.") != std::string::npos);
-// }
+  // EXPECT_TRUE(output_str.find("Empty chunk.") != std::string::npos);
+}
 
-// TEST_F(OperatorsPrintTest, GetColumnWidths) {
-//   uint16_t min = 8;
-//   uint16_t max = 20;
+TEST_F(OperatorsPrintTest, GetColumnWidths) {
+  uint16_t min = 8;
+  uint16_t max = 20;
 
-//   auto tab = StorageManager::get().get_table(table_name);
+  auto tab = StorageManager::get().get_table(table_name);
 
-//   auto pr_wrap = std::make_shared<PrintWrapper>(gt);
-//   auto print_lengths = pr_wrap->test_column_string_widths(min, max);
+  auto pr_wrap = std::make_shared<PrintWrapper>(gt);
+  auto print_lengths = pr_wrap->test_column_string_widths(min, max);
 
-//   // we have two columns, thus two 'lengths'
-//   ASSERT_EQ(print_lengths.size(), static_cast<size_t>(2));
-//   // with empty columns and short col names, we should see the minimal lengths
-//   EXPECT_EQ(print_lengths.at(0), static_cast<size_t>(min));
-//   EXPECT_EQ(print_lengths.at(1), static_cast<size_t>(min));
+  // we have two columns, thus two 'lengths'
+  ASSERT_EQ(print_lengths.size(), static_cast<size_t>(2));
+  // with empty columns and short col names, we should see the minimal lengths
+  EXPECT_EQ(print_lengths.at(0), static_cast<size_t>(min));
+  EXPECT_EQ(print_lengths.at(1), static_cast<size_t>(min));
 
-//   int ten_digits_ints = 1234567890;
+  int ten_digits_ints = 1234567890;
 
-//   tab->append({ten_digits_ints, "quite a long string with more than $max chars"});
+  tab->append({ten_digits_ints, "quite a long string with more than $max chars"});
 
-//   print_lengths = pr_wrap->test_column_string_widths(min, max);
-//   EXPECT_EQ(print_lengths.at(0), static_cast<size_t>(10));
-//   EXPECT_EQ(print_lengths.at(1), static_cast<size_t>(max));
-// }
+  print_lengths = pr_wrap->test_column_string_widths(min, max);
+  EXPECT_EQ(print_lengths.at(0), static_cast<size_t>(10));
+  EXPECT_EQ(print_lengths.at(1), static_cast<size_t>(max));
+}
 
 }  // namespace opossum
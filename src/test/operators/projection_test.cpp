@@ -0,0 +1,103 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/projection.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsProjectionTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("src/test/tables/int_float.tbl", 2);
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsProjectionTest, SelectsAndReordersColumns) {
+  auto projection = std::make_shared<Projection>(_table_wrapper, std::vector<ColumnID>{ColumnID{1}, ColumnID{0}});
+  projection->execute();
+
+  const auto expected = load_table("src/test/tables/float_int.tbl", 1);
+  EXPECT_TABLE_EQ(projection->get_output(), expected);
+}
+
+TEST_F(OperatorsProjectionTest, SharesColumnsOfInput) {
+  for (ChunkID chunk_id{0}; chunk_id < _table->chunk_count(); ++chunk_id) _table->compress_chunk(chunk_id);
+
+  auto projection = std::make_shared<Projection>(_table_wrapper, std::vector<ColumnID>{ColumnID{1}});
+  projection->execute();
+
+  const auto output = projection->get_output();
+  ASSERT_EQ(output->chunk_count(), _table->chunk_count());
+  for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(output->get_chunk(chunk_id)->get_column(ColumnID{0}),
+              _table->get_chunk(chunk_id)->get_column(ColumnID{1}));
+  }
+}
+
+TEST_F(OperatorsProjectionTest, ReferencesValueColumns) {
+  auto projection = std::make_shared<Projection>(_table_wrapper, std::vector<ColumnID>{ColumnID{1}, ColumnID{0}});
+  projection->execute();
+
+  // rows appended later do not show up in the output
+  _table->append({17, 17.0f});
+
+  const auto output = projection->get_output();
+  ASSERT_EQ(output->chunk_count(), 2u);
+  const auto chunk = output->get_chunk(ChunkID{1});
+  const auto float_column = std::dynamic_pointer_cast<const ReferenceColumn>(chunk->get_column(ColumnID{0}));
+  const auto int_column = std::dynamic_pointer_cast<const ReferenceColumn>(chunk->get_column(ColumnID{1}));
+  ASSERT_NE(float_column, nullptr);
+  ASSERT_NE(int_column, nullptr);
+  EXPECT_EQ(float_column->referenced_table(), _table);
+  EXPECT_EQ(float_column->referenced_column_id(), ColumnID{1});
+  EXPECT_EQ(float_column->pos_list(), int_column->pos_list());
+  EXPECT_EQ(chunk->size(), 1u);
+  EXPECT_EQ(output->row_count(), 3u);
+}
+
+TEST_F(OperatorsProjectionTest, ForwardsReferenceColumns) {
+  auto pos_list = std::make_shared<PosList>();
+  pos_list->emplace_back(RowID{ChunkID{1}, 0});
+  pos_list->emplace_back(RowID{ChunkID{0}, 0});
+
+  auto reference_table = std::make_shared<Table>();
+  reference_table->add_column_definition("a", "int");
+  reference_table->add_column_definition("b", "float");
+  Chunk chunk;
+  chunk.add_column(std::make_shared<ReferenceColumn>(_table, ColumnID{0}, pos_list));
+  chunk.add_column(std::make_shared<ReferenceColumn>(_table, ColumnID{1}, pos_list));
+  reference_table->emplace_chunk(std::move(chunk));
+
+  auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  table_wrapper->execute();
+  auto projection = std::make_shared<Projection>(table_wrapper, std::vector<ColumnID>{ColumnID{1}});
+  projection->execute();
+
+  const auto column = std::dynamic_pointer_cast<const ReferenceColumn>(
+      projection->get_output()->get_chunk(ChunkID{0})->get_column(ColumnID{0}));
+  ASSERT_NE(column, nullptr);
+  EXPECT_EQ(column->referenced_table(), _table);
+  EXPECT_EQ(column->referenced_column_id(), ColumnID{1});
+  EXPECT_EQ(column->pos_list(), pos_list);
+  EXPECT_FLOAT_EQ(type_cast<float>((*column)[0]), 457.7f);
+}
+
+TEST_F(OperatorsProjectionTest, ThrowsOnInvalidColumnID) {
+  auto projection = std::make_shared<Projection>(_table_wrapper, std::vector<ColumnID>{ColumnID{2}});
+  EXPECT_THROW(projection->execute(), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,165 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsSortTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->append({2, "x"});
+    _table->append({1, "y"});
+    _table->append({2, "z"});
+    _table->append({1, "x"});
+    _table->append({3, "y"});
+    _table->append({2, "y"});
+    _table->append({1, "z"});
+    _table->compress_chunk(ChunkID{1});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> _expected(const std::vector<std::pair<int, std::string>>& rows) {
+    auto expected = std::make_shared<Table>();
+    expected->add_column("a", "int");
+    expected->add_column("b", "string");
+    for (const auto& row : rows) expected->append({row.first, row.second});
+    return expected;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsSortTest, SortsByOneColumn) {
+  auto table = load_table("src/test/tables/int_float.tbl", 2);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort = std::make_shared<Sort>(table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}}});
+  sort->execute();
+
+  EXPECT_TABLE_EQ(sort->get_output(), load_table("src/test/tables/int_float_sorted.tbl", 1), true);
+}
+
+TEST_F(OperatorsSortTest, KeepsOrderOfEqualRows) {
+  auto sort = std::make_shared<Sort>(_table_wrapper,
+                                     std::vector<SortColumnDefinition>{{ColumnID{0}, OrderByMode::Descending}});
+  sort->execute();
+
+  const auto expected = _expected({{3, "y"}, {2, "x"}, {2, "z"}, {2, "y"}, {1, "y"}, {1, "x"}, {1, "z"}});
+  EXPECT_TABLE_EQ(sort->get_output(), expected, true);
+}
+
+TEST_F(OperatorsSortTest, SortsByMultipleColumns) {
+  auto sort = std::make_shared<Sort>(
+      _table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}, OrderByMode::Ascending},
+                                                        {ColumnID{1}, OrderByMode::Descending}});
+  sort->execute();
+
+  const auto expected = _expected({{1, "z"}, {1, "y"}, {1, "x"}, {2, "z"}, {2, "y"}, {2, "x"}, {3, "y"}});
+  EXPECT_TABLE_EQ(sort->get_output(), expected, true);
+}
+
+TEST_F(OperatorsSortTest, SplitsOutputIntoChunks) {
+  auto sort = std::make_shared<Sort>(_table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{1}}}, 2);
+  sort->execute();
+
+  const auto output = sort->get_output();
+  EXPECT_EQ(output->chunk_count(), ChunkID{4});
+  EXPECT_EQ(output->row_count(), 7u);
+
+  // all columns share their positions
+  const auto chunk = output->get_chunk(ChunkID{0});
+  const auto column_a = std::dynamic_pointer_cast<const ReferenceColumn>(chunk->get_column(ColumnID{0}));
+  const auto column_b = std::dynamic_pointer_cast<const ReferenceColumn>(chunk->get_column(ColumnID{1}));
+  ASSERT_NE(column_a, nullptr);
+  ASSERT_NE(column_b, nullptr);
+  EXPECT_EQ(column_a->pos_list(), column_b->pos_list());
+  EXPECT_EQ(column_a->referenced_table(), _table);
+
+  // output chunks are placed on the node of the chunk their first row comes from
+  for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto column = std::dynamic_pointer_cast<const ReferenceColumn>(
+        output->get_chunk(chunk_id)->get_column(ColumnID{0}));
+    EXPECT_EQ(output->chunk_numa_node(chunk_id), _table->chunk_numa_node(column->pos_list()->front().chunk_id));
+  }
+}
+
+TEST_F(OperatorsSortTest, ForwardsReferencedPositions) {
+  auto pos_list = std::make_shared<PosList>();
+  pos_list->emplace_back(RowID{ChunkID{0}, 0});
+  pos_list->emplace_back(RowID{ChunkID{1}, 1});
+  pos_list->emplace_back(RowID{ChunkID{2}, 0});
+
+  auto reference_table = std::make_shared<Table>();
+  reference_table->add_column_definition("a", "int");
+  reference_table->add_column_definition("b", "string");
+  Chunk chunk;
+  chunk.add_column(std::make_shared<ReferenceColumn>(_table, ColumnID{0}, pos_list));
+  chunk.add_column(std::make_shared<ReferenceColumn>(_table, ColumnID{1}, pos_list));
+  reference_table->emplace_chunk(std::move(chunk));
+
+  auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  table_wrapper->execute();
+  auto sort = std::make_shared<Sort>(table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{1}}});
+  sort->execute();
+
+  const auto output = sort->get_output();
+  EXPECT_TABLE_EQ(output, _expected({{2, "x"}, {3, "y"}, {1, "z"}}), true);
+
+  const auto column = std::dynamic_pointer_cast<const ReferenceColumn>(
+      output->get_chunk(ChunkID{0})->get_column(ColumnID{0}));
+  ASSERT_NE(column, nullptr);
+  EXPECT_EQ(column->referenced_table(), _table);
+  EXPECT_EQ((*column->pos_list())[2], (RowID{ChunkID{2}, 0}));
+}
+
+TEST_F(OperatorsSortTest, SortsNullValuesFirst) {
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", "int", true);
+  for (const auto& value : {AllTypeVariant{2}, NULL_VALUE, AllTypeVariant{1}, NULL_VALUE, AllTypeVariant{3}}) {
+    table->append({value});
+  }
+  table->compress_chunk(ChunkID{0});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int", true);
+  for (const auto& value : {NULL_VALUE, NULL_VALUE, AllTypeVariant{1}, AllTypeVariant{2}, AllTypeVariant{3}}) {
+    expected->append({value});
+  }
+
+  auto sort = std::make_shared<Sort>(table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}}});
+  sort->execute();
+  EXPECT_TABLE_EQ(sort->get_output(), expected, true);
+
+  auto sort_descending = std::make_shared<Sort>(
+      table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}, OrderByMode::Descending}});
+  sort_descending->execute();
+  const auto output = sort_descending->get_output();
+  EXPECT_TRUE(variant_is_null((*output->get_chunk(ChunkID{0})->get_column(ColumnID{0}))[4]));
+  EXPECT_EQ((*output->get_chunk(ChunkID{0})->get_column(ColumnID{0}))[0], AllTypeVariant{3});
+}
+
+TEST_F(OperatorsSortTest, ThrowsOnInvalidColumnID) {
+  auto sort = std::make_shared<Sort>(_table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{2}}});
+  EXPECT_THROW(sort->execute(), std::exception);
+}
+
+}  // namespace opossum
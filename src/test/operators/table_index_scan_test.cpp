@@ -0,0 +1,59 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_index_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsTableIndexScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(5);
+    table->add_column("a", "int");
+    table->add_column("b", "float");
+    for (auto row = 0; row < 23; ++row) table->append({(row * 7) % 11, row * 0.5f});
+    table->compress_chunk(ChunkID{1});
+    table->create_table_index(ColumnID{0});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsTableIndexScanTest, MatchesTableScan) {
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                               ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+    for (const auto search_value : {-1, 0, 4, 10, 11}) {
+      SCOPED_TRACE(to_string(scan_type) + " " + std::to_string(search_value));
+      auto table_index_scan = std::make_shared<TableIndexScan>(_table_wrapper, ColumnID{0}, scan_type, search_value);
+      table_index_scan->execute();
+      auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, scan_type, search_value);
+      table_scan->execute();
+
+      EXPECT_TABLE_EQ(table_index_scan->get_output(), table_scan->get_output(), true);
+    }
+  }
+}
+
+TEST_F(OperatorsTableIndexScanTest, Description) {
+  const auto table_index_scan = std::make_shared<TableIndexScan>(_table_wrapper, ColumnID{0}, ScanType::OpEquals, 4);
+  EXPECT_EQ(table_index_scan->name(), "TableIndexScan");
+  EXPECT_EQ(table_index_scan->description(), "TableIndexScan (#0 = 4)");
+}
+
+TEST_F(OperatorsTableIndexScanTest, ThrowsWithoutIndex) {
+  auto table_index_scan = std::make_shared<TableIndexScan>(_table_wrapper, ColumnID{1}, ScanType::OpEquals, 1.0f);
+  EXPECT_THROW(table_index_scan->execute(), std::exception);
+}
+
+}  // namespace opossum
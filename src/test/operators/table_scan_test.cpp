@@ -1,9 +1,11 @@
 #include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -20,251 +22,448 @@
 
 namespace opossum {
 
-// class OperatorsTableScanTest : public BaseTest {
-//  protected:
-//   void SetUp() override {
-//     _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
-//     _table_wrapper->execute();
-
-//     std::shared_ptr<Table> test_even_dict = std::make_shared<Table>(5);
-//     test_even_dict->add_column("a", "int");
-//     test_even_dict->add_column("b", "int");
-//     for (int i = 0; i <= 24; i += 2) test_even_dict->append({i, 100 + i});
-
-//     test_even_dict->compress_chunk(ChunkID(0));
-//     test_even_dict->compress_chunk(ChunkID(1));
-
-//     _table_wrapper_even_dict = std::make_shared<TableWrapper>(std::move(test_even_dict));
-//     _table_wrapper_even_dict->execute();
-//   }
-
-//   std::shared_ptr<TableWrapper> get_table_op_part_dict() {
-//     auto table = std::make_shared<Table>(5);
-//     table->add_column("a", "int");
-//     table->add_column("b", "float");
-
-//     for (int i = 1; i < 20; ++i) {
-//       table->append({i, 100.1 + i});
-//     }
-
-//     table->compress_chunk(ChunkID(0));
-//     table->compress_chunk(ChunkID(1));
-
-//     auto table_wrapper = std::make_shared<TableWrapper>(table);
-//     table_wrapper->execute();
-
-//     return table_wrapper;
-//   }
-
-//   std::shared_ptr<TableWrapper> get_table_op_with_n_dict_entries(const int num_entries) {
-//     // Set up dictionary encoded table with a dictionary consisting of num_entries entries.
-//     auto table = std::make_shared<opossum::Table>(0);
-//     table->add_column("a", "int");
-//     table->add_column("b", "float");
-
-//     for (int i = 0; i <= num_entries; i++) {
-//       table->append({i, 100.0f + i});
-//     }
-
-//     table->compress_chunk(ChunkID(0));
-
-//     auto table_wrapper = std::make_shared<opossum::TableWrapper>(std::move(table));
-//     table_wrapper->execute();
-//     return table_wrapper;
-//   }
-
-//   void ASSERT_COLUMN_EQ(std::shared_ptr<const Table> table, const ColumnID& column_id,
-//                         std::vector<AllTypeVariant> expected) {
-//     for (auto chunk_id = ChunkID{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
-//       const auto& chunk = table->get_chunk(chunk_id);
-
-//       for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < chunk.size(); ++chunk_offset) {
-//         const auto& column = *chunk.get_column(column_id);
-
-//         const auto found_value = column[chunk_offset];
-//         const auto comparator = [found_value](const AllTypeVariant expected_value) {
-//           // returns equivalency, not equality to simulate std::multiset.
-//           // multiset cannot be used because it triggers a compiler / lib bug when built in CI
-//           return !(found_value < expected_value) && !(expected_value < found_value);
-//         };
-
-//         auto search = std::find_if(expected.begin(), expected.end(), comparator);
-
-//         ASSERT_TRUE(search != expected.end());
-//         expected.erase(search);
-//       }
-//     }
-
-//     ASSERT_EQ(expected.size(), 0u);
-//   }
-
-//   std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_even_dict;
-// };
-
-// TEST_F(OperatorsTableScanTest, DoubleScan) {
-//   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered.tbl", 2);
-
-//   auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
-//   scan_1->execute();
-
-//   auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpLessThan, 457.9);
-//   scan_2->execute();
-
-//   EXPECT_TABLE_EQ(scan_2->get_output(), expected_result);
-// }
-
-// TEST_F(OperatorsTableScanTest, EmptyResultScan) {
-//   auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 90000);
-//   scan_1->execute();
-
-//   for (auto i = ChunkID{0}; i < scan_1->get_output()->chunk_count(); i++)
-//     EXPECT_EQ(scan_1->get_output()->get_chunk(i).col_count(), 2u);
-// }
-
-// TEST_F(OperatorsTableScanTest, SingleScanReturnsCorrectRowCount) {
-//   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered2.tbl", 1);
-
-//   auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
-//   scan->execute();
-
-//   EXPECT_TABLE_EQ(scan->get_output(), expected_result);
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnDictColumn) {
-//   // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = {104};
-//   tests[ScanType::OpNotEquals] = {100, 102, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   tests[ScanType::OpLessThan] = {100, 102};
-//   tests[ScanType::OpLessThanEquals] = {100, 102, 104};
-//   tests[ScanType::OpGreaterThan] = {106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   tests[ScanType::OpGreaterThanEquals] = {104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   for (const auto& test : tests) {
-//     auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 4);
-//     scan->execute();
-
-//     ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnReferencedDictColumn) {
-//   // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = {104};
-//   tests[ScanType::OpNotEquals] = {100, 102, 106};
-//   tests[ScanType::OpLessThan] = {100, 102};
-//   tests[ScanType::OpLessThanEquals] = {100, 102, 104};
-//   tests[ScanType::OpGreaterThan] = {106};
-//   tests[ScanType::OpGreaterThanEquals] = {104, 106};
-//   for (const auto& test : tests) {
-//     auto scan1 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{1}, ScanType::OpLessThan, 108);
-//     scan1->execute();
-
-//     auto scan2 = std::make_shared<TableScan>(scan1, ColumnID{0}, test.first, 4);
-//     scan2->execute();
-
-//     ASSERT_COLUMN_EQ(scan2->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanPartiallyCompressed) {
-//   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_seq_filtered.tbl", 2);
-
-//   auto table_wrapper = get_table_op_part_dict();
-//   auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10);
-//   scan_1->execute();
-
-//   EXPECT_TABLE_EQ(scan_1->get_output(), expected_result);
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueGreaterThanMaxDictionaryValue) {
-//   const auto all_rows = std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   const auto no_rows = std::vector<AllTypeVariant>{};
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = no_rows;
-//   tests[ScanType::OpNotEquals] = all_rows;
-//   tests[ScanType::OpLessThan] = all_rows;
-//   tests[ScanType::OpLessThanEquals] = all_rows;
-//   tests[ScanType::OpGreaterThan] = no_rows;
-//   tests[ScanType::OpGreaterThanEquals] = no_rows;
-
-//   for (const auto& test : tests) {
-//     auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 30);
-//     scan->execute();
-
-//     ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueLessThanMinDictionaryValue) {
-//   const auto all_rows = std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   const auto no_rows = std::vector<AllTypeVariant>{};
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = no_rows;
-//   tests[ScanType::OpNotEquals] = all_rows;
-//   tests[ScanType::OpLessThan] = no_rows;
-//   tests[ScanType::OpLessThanEquals] = no_rows;
-//   tests[ScanType::OpGreaterThan] = all_rows;
-//   tests[ScanType::OpGreaterThanEquals] = all_rows;
-
-//   for (const auto& test : tests) {
-//     auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0} /* "a" */, test.first, -10);
-//     scan->execute();
-
-//     ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnDictColumnAroundBounds) {
-//   // scanning for a value that is around the dictionary's bounds
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = {100};
-//   tests[ScanType::OpLessThan] = {};
-//   tests[ScanType::OpLessThanEquals] = {100};
-//   tests[ScanType::OpGreaterThan] = {102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   tests[ScanType::OpGreaterThanEquals] = {100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   tests[ScanType::OpNotEquals] = {102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-
-//   for (const auto& test : tests) {
-//     auto scan = std::make_shared<opossum::TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 0);
-//     scan->execute();
-
-//     ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanWithEmptyInput) {
-//   auto scan_1 = std::make_shared<opossum::TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 12345);
-//   scan_1->execute();
-//   EXPECT_EQ(scan_1->get_output()->row_count(), static_cast<size_t>(0));
-
-//   // scan_1 produced an empty result
-//   auto scan_2 = std::make_shared<opossum::TableScan>(scan_1, ColumnID{1}, ScanType::OpEquals, 456.7);
-//   scan_2->execute();
-
-//   EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(0));
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnWideDictionaryColumn) {
-//   // 2**8 + 1 values require a data type of 16bit.
-//   const auto table_wrapper_dict_16 = get_table_op_with_n_dict_entries((1 << 8) + 1);
-//   auto scan_1 = std::make_shared<opossum::TableScan>(table_wrapper_dict_16, ColumnID{0}, ScanType::OpGreaterThan, 200);
-//   scan_1->execute();
-
-//   EXPECT_EQ(scan_1->get_output()->row_count(), static_cast<size_t>(57));
-
-//   // 2**16 + 1 values require a data type of 32bit.
-//   const auto table_wrapper_dict_32 = get_table_op_with_n_dict_entries((1 << 16) + 1);
-//   auto scan_2 =
-//       std::make_shared<opossum::TableScan>(table_wrapper_dict_32, ColumnID{0}, ScanType::OpGreaterThan, 65500);
-//   scan_2->execute();
-
-//   EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(37));
-// }
+class OperatorsTableScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    _table_wrapper->execute();
+
+    std::shared_ptr<Table> test_even_dict = std::make_shared<Table>(5);
+    test_even_dict->add_column("a", "int");
+    test_even_dict->add_column("b", "int");
+    for (int i = 0; i <= 24; i += 2) test_even_dict->append({i, 100 + i});
+
+    test_even_dict->compress_chunk(ChunkID(0));
+    test_even_dict->compress_chunk(ChunkID(1));
+
+    _table_wrapper_even_dict = std::make_shared<TableWrapper>(std::move(test_even_dict));
+    _table_wrapper_even_dict->execute();
+  }
+
+  std::shared_ptr<TableWrapper> get_table_op_part_dict() {
+    auto table = std::make_shared<Table>(5);
+    table->add_column("a", "int");
+    table->add_column("b", "float");
+
+    for (int i = 1; i < 20; ++i) {
+      table->append({i, 100.1 + i});
+    }
+
+    table->compress_chunk(ChunkID(0));
+    table->compress_chunk(ChunkID(1));
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    return table_wrapper;
+  }
+
+  std::shared_ptr<TableWrapper> get_table_op_with_n_dict_entries(const int num_entries) {
+    // Set up dictionary encoded table with a dictionary consisting of num_entries entries.
+    auto table = std::make_shared<opossum::Table>(0);
+    table->add_column("a", "int");
+    table->add_column("b", "float");
+
+    for (int i = 0; i <= num_entries; i++) {
+      table->append({i, 100.0f + i});
+    }
+
+    table->compress_chunk(ChunkID(0));
+
+    auto table_wrapper = std::make_shared<opossum::TableWrapper>(std::move(table));
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  void ASSERT_COLUMN_EQ(std::shared_ptr<const Table> table, const ColumnID& column_id,
+                        std::vector<AllTypeVariant> expected) {
+    for (auto chunk_id = ChunkID{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+
+      for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < chunk->size(); ++chunk_offset) {
+        const auto& column = *chunk->get_column(column_id);
+
+        const auto found_value = column[chunk_offset];
+        const auto comparator = [found_value](const AllTypeVariant expected_value) {
+          // returns equivalency, not equality to simulate std::multiset.
+          // multiset cannot be used because it triggers a compiler / lib bug when built in CI
+          return !(found_value < expected_value) && !(expected_value < found_value);
+        };
+
+        auto search = std::find_if(expected.begin(), expected.end(), comparator);
+
+        ASSERT_TRUE(search != expected.end());
+        expected.erase(search);
+      }
+    }
+
+    ASSERT_EQ(expected.size(), 0u);
+  }
+
+  // a = 0, NULL, 2, NULL, ..., 10 in chunks of 4 rows, the first of which is compressed
+  std::shared_ptr<TableWrapper> get_table_op_with_nulls() {
+    auto table = std::make_shared<Table>(4);
+    table->add_column("a", "int", true);
+    table->add_column("b", "int");
+    for (int i = 0; i <= 10; ++i) {
+      table->append({i % 2 == 0 ? AllTypeVariant{i} : NULL_VALUE, i});
+    }
+    table->compress_chunk(ChunkID{0});
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  // a = "/usr/bin/ls", NULL, "/usr/lib/x", ... in chunks of 4 rows, the first of which is compressed
+  std::shared_ptr<TableWrapper> get_table_op_with_strings() {
+    auto table = std::make_shared<Table>(4);
+    table->add_column("a", "string", true);
+    table->add_column("b", "int");
+    const auto values = std::vector<AllTypeVariant>{"/usr/bin/ls", NULL_VALUE,    "/usr/lib/x", "/etc/hosts",
+                                                    "/usr/bin/cat", "/usr/binx", NULL_VALUE,   "/var/usr/bin"};
+    for (auto i = size_t{0}; i < values.size(); ++i) {
+      table->append({values[i], static_cast<int>(i)});
+    }
+    table->compress_chunk(ChunkID{0});
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_even_dict;
+};
+
+TEST_F(OperatorsTableScanTest, DoubleScan) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered.tbl", 2);
+
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  scan_1->execute();
+
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpLessThan, 457.9);
+  scan_2->execute();
+
+  EXPECT_TABLE_EQ(scan_2->get_output(), expected_result);
+}
+
+TEST_F(OperatorsTableScanTest, EmptyResultScan) {
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 90000);
+  scan_1->execute();
+
+  for (auto i = ChunkID{0}; i < scan_1->get_output()->chunk_count(); i++)
+    EXPECT_EQ(scan_1->get_output()->get_chunk(i)->col_count(), 2u);
+}
+
+TEST_F(OperatorsTableScanTest, SingleScanReturnsCorrectRowCount) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered2.tbl", 1);
+
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  scan->execute();
+
+  EXPECT_TABLE_EQ(scan->get_output(), expected_result);
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumn) {
+  // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {104};
+  tests[ScanType::OpNotEquals] = {100, 102, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpLessThan] = {100, 102};
+  tests[ScanType::OpLessThanEquals] = {100, 102, 104};
+  tests[ScanType::OpGreaterThan] = {106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpGreaterThanEquals] = {104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 4);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnReferencedDictColumn) {
+  // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {104};
+  tests[ScanType::OpNotEquals] = {100, 102, 106};
+  tests[ScanType::OpLessThan] = {100, 102};
+  tests[ScanType::OpLessThanEquals] = {100, 102, 104};
+  tests[ScanType::OpGreaterThan] = {106};
+  tests[ScanType::OpGreaterThanEquals] = {104, 106};
+  for (const auto& test : tests) {
+    auto scan1 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{1}, ScanType::OpLessThan, 108);
+    scan1->execute();
+
+    auto scan2 = std::make_shared<TableScan>(scan1, ColumnID{0}, test.first, 4);
+    scan2->execute();
+
+    ASSERT_COLUMN_EQ(scan2->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanPartiallyCompressed) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_seq_filtered.tbl", 2);
+
+  auto table_wrapper = get_table_op_part_dict();
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10);
+  scan_1->execute();
+
+  EXPECT_TABLE_EQ(scan_1->get_output(), expected_result);
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueGreaterThanMaxDictionaryValue) {
+  const auto all_rows = std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  const auto no_rows = std::vector<AllTypeVariant>{};
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = no_rows;
+  tests[ScanType::OpNotEquals] = all_rows;
+  tests[ScanType::OpLessThan] = all_rows;
+  tests[ScanType::OpLessThanEquals] = all_rows;
+  tests[ScanType::OpGreaterThan] = no_rows;
+  tests[ScanType::OpGreaterThanEquals] = no_rows;
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 30);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueLessThanMinDictionaryValue) {
+  const auto all_rows = std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  const auto no_rows = std::vector<AllTypeVariant>{};
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = no_rows;
+  tests[ScanType::OpNotEquals] = all_rows;
+  tests[ScanType::OpLessThan] = no_rows;
+  tests[ScanType::OpLessThanEquals] = no_rows;
+  tests[ScanType::OpGreaterThan] = all_rows;
+  tests[ScanType::OpGreaterThanEquals] = all_rows;
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0} /* "a" */, test.first, -10);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumnAroundBounds) {
+  // scanning for a value that is around the dictionary's bounds
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {100};
+  tests[ScanType::OpLessThan] = {};
+  tests[ScanType::OpLessThanEquals] = {100};
+  tests[ScanType::OpGreaterThan] = {102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpGreaterThanEquals] = {100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpNotEquals] = {102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<opossum::TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 0);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithEmptyInput) {
+  auto scan_1 = std::make_shared<opossum::TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 12345);
+  scan_1->execute();
+  EXPECT_EQ(scan_1->get_output()->row_count(), static_cast<size_t>(0));
+
+  // scan_1 produced an empty result
+  auto scan_2 = std::make_shared<opossum::TableScan>(scan_1, ColumnID{1}, ScanType::OpEquals, 456.7);
+  scan_2->execute();
+
+  EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(0));
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnWideDictionaryColumn) {
+  // 2**8 + 1 values require a data type of 16bit.
+  const auto table_wrapper_dict_16 = get_table_op_with_n_dict_entries((1 << 8) + 1);
+  auto scan_1 = std::make_shared<opossum::TableScan>(table_wrapper_dict_16, ColumnID{0}, ScanType::OpGreaterThan, 200);
+  scan_1->execute();
+
+  EXPECT_EQ(scan_1->get_output()->row_count(), static_cast<size_t>(57));
+
+  // 2**16 + 1 values require a data type of 32bit.
+  const auto table_wrapper_dict_32 = get_table_op_with_n_dict_entries((1 << 16) + 1);
+  auto scan_2 =
+      std::make_shared<opossum::TableScan>(table_wrapper_dict_32, ColumnID{0}, ScanType::OpGreaterThan, 65500);
+  scan_2->execute();
+
+  EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(37));
+}
+
+TEST_F(OperatorsTableScanTest, ComparisonsSkipNullValues) {
+  const auto table_wrapper = get_table_op_with_nulls();
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {4};
+  tests[ScanType::OpNotEquals] = {0, 2, 6, 8, 10};
+  tests[ScanType::OpLessThan] = {0, 2};
+  tests[ScanType::OpLessThanEquals] = {0, 2, 4};
+  tests[ScanType::OpGreaterThan] = {6, 8, 10};
+  tests[ScanType::OpGreaterThanEquals] = {4, 6, 8, 10};
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 4);
+    scan->execute();
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+
+    // the same on ReferenceColumns
+    auto scan_all = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpGreaterThanEquals, 0);
+    scan_all->execute();
+    auto scan_reference = std::make_shared<TableScan>(scan_all, ColumnID{0}, test.first, 4);
+    scan_reference->execute();
+    ASSERT_COLUMN_EQ(scan_reference->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, NullSearchValueMatchesNothing) {
+  const auto table_wrapper = get_table_op_with_nulls();
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan}) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, NULL_VALUE);
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), 0u);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanForNullValues) {
+  const auto table_wrapper = get_table_op_with_nulls();
+
+  auto is_null = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpIsNull, NULL_VALUE);
+  is_null->execute();
+  ASSERT_COLUMN_EQ(is_null->get_output(), ColumnID{1}, {1, 3, 5, 7, 9});
+  EXPECT_EQ(is_null->description(), "TableScan (#0 IS NULL)");
+
+  auto is_not_null = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpIsNotNull, NULL_VALUE);
+  is_not_null->execute();
+  ASSERT_COLUMN_EQ(is_not_null->get_output(), ColumnID{1}, {0, 2, 4, 6, 8, 10});
+
+  auto is_null_reference = std::make_shared<TableScan>(is_not_null, ColumnID{0}, ScanType::OpIsNull, NULL_VALUE);
+  is_null_reference->execute();
+  EXPECT_EQ(is_null_reference->get_output()->row_count(), 0u);
+
+  // columns that are not nullable hold no NULL values
+  auto non_nullable = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpIsNotNull, NULL_VALUE);
+  non_nullable->execute();
+  EXPECT_EQ(non_nullable->get_output()->row_count(), 11u);
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithLike) {
+  const auto table_wrapper = get_table_op_with_strings();
+
+  std::map<std::string, std::vector<AllTypeVariant>> tests;
+  tests["/usr/bin/%"] = {0, 4};
+  tests["/usr/bin%"] = {0, 4, 5};
+  tests["%usr/bin%"] = {0, 4, 5, 7};
+  tests["%s"] = {0, 3};
+  tests["/usr/___/%"] = {0, 2, 4};
+  tests["%"] = {0, 2, 3, 4, 5, 7};
+  tests["/opt%"] = {};
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLike, test.first);
+    scan->execute();
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+
+    // the same on ReferenceColumns
+    auto scan_all = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpGreaterThanEquals, 0);
+    scan_all->execute();
+    auto scan_reference = std::make_shared<TableScan>(scan_all, ColumnID{0}, ScanType::OpLike, test.first);
+    scan_reference->execute();
+    ASSERT_COLUMN_EQ(scan_reference->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithNotLike) {
+  const auto table_wrapper = get_table_op_with_strings();
+
+  // as with comparisons, NULL values match neither LIKE nor NOT LIKE
+  std::map<std::string, std::vector<AllTypeVariant>> tests;
+  tests["/usr/bin/%"] = {2, 3, 5, 7};
+  tests["%usr/bin%"] = {2, 3};
+  tests["/usr/___/%"] = {3, 5, 7};
+  tests["%"] = {};
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotLike, test.first);
+    scan->execute();
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotLike, "%bin%");
+  scan->execute();
+  EXPECT_EQ(scan->description(), "TableScan (#0 NOT LIKE %bin%)");
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithLikeOnFrontCodedDictionary) {
+  auto table = std::make_shared<Table>(0);
+  table->add_column("a", "string");
+  table->add_column("b", "int");
+  for (int i = 0; i < 100; ++i) {
+    table->append({"https://www.example.com/articles/" + std::to_string(1000 + i), i});
+  }
+  table->compress_chunk(ChunkID{0});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto pattern = std::string{"https://www.example.com/articles/105%"};
+  auto prefix_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLike, pattern);
+  prefix_scan->execute();
+  ASSERT_COLUMN_EQ(prefix_scan->get_output(), ColumnID{1}, {50, 51, 52, 53, 54, 55, 56, 57, 58, 59});
+
+  auto suffix_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotLike, "%0");
+  suffix_scan->execute();
+  EXPECT_EQ(suffix_scan->get_output()->row_count(), 90u);
+}
+
+TEST_F(OperatorsTableScanTest, LikeOnlyAppliesToStrings) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLike, "1%");
+  EXPECT_THROW(scan->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsTableScanTest, ScansWhileRowsAreAppended) {
+  // a transaction appends to the mutable chunk of an MVCC table while it is scanned (see ValueColumn)
+  auto table = std::make_shared<Table>(10'000, PolymorphicAllocator<size_t>{}, UseMvcc::Yes);
+  table->add_column("a", "int", true);
+  table->add_column("b", "string", true);
+
+  std::atomic_bool done{false};
+  auto writer = std::thread([&]() {
+    for (auto row = 0; row < 10'000; ++row) {
+      const auto value = row % 2 == 1 ? AllTypeVariant{row} : NULL_VALUE;
+      table->append_uncommitted({{value, value}}, TransactionID{1});
+    }
+    done = true;
+  });
+
+  const auto scan = [&](const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& search_value) {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    auto table_scan = std::make_shared<TableScan>(table_wrapper, column_id, scan_type, search_value);
+    table_scan->execute();
+    return table_scan->get_output()->row_count();
+  };
+
+  // Validate is left out, so that the uncommitted rows are part of the results. Every odd row matches.
+  auto previous_match_count = uint64_t{0};
+  while (!done) {
+    const auto match_count = scan(ColumnID{0}, ScanType::OpGreaterThanEquals, 0);
+    EXPECT_GE(match_count, previous_match_count);
+    EXPECT_LE(match_count, 5'000u);
+    previous_match_count = match_count;
+    EXPECT_LE(scan(ColumnID{1}, ScanType::OpLike, "%1"), 5'000u);
+  }
+  writer.join();
+
+  EXPECT_EQ(scan(ColumnID{0}, ScanType::OpGreaterThanEquals, 0), 5'000u);
+  EXPECT_EQ(scan(ColumnID{0}, ScanType::OpIsNull, NULL_VALUE), 5'000u);
+}
 
 }  // namespace opossum
@@ -0,0 +1,84 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int");
+    _table->add_column("b", "int");
+    for (const auto& row : std::vector<std::pair<int, int>>{{5, 0}, {3, 1}, {9, 2}, {3, 3}, {7, 4}, {1, 5}, {8, 6},
+                                                            {9, 7}, {8, 8}, {2, 9}, {3, 10}}) {
+      _table->append({row.first, row.second});
+    }
+    _table->compress_chunk(ChunkID{1});
+    _table->compress_chunk(ChunkID{2});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  // TopK has to return the same rows as a Sort followed by a Limit
+  void _expect_same_as_sort(const SortColumnDefinition& sort_definition, const size_t k) {
+    auto top_k = std::make_shared<TopK>(_table_wrapper, sort_definition, k);
+    top_k->execute();
+
+    auto sort = std::make_shared<Sort>(_table_wrapper, std::vector<SortColumnDefinition>{sort_definition});
+    sort->execute();
+    auto limit = std::make_shared<Limit>(sort, k);
+    limit->execute();
+
+    EXPECT_TABLE_EQ(top_k->get_output(), limit->get_output(), true);
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsTopKTest, ReturnsBestRowsInOrder) {
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending}) {
+    for (const auto k : {size_t{0}, size_t{1}, size_t{3}, size_t{4}, size_t{11}, size_t{20}}) {
+      _expect_same_as_sort({ColumnID{0}, order_by_mode}, k);
+    }
+  }
+}
+
+TEST_F(OperatorsTopKTest, SkipsChunksThatCannotContribute) {
+  // Every task fills its heap with the values of its first chunk. The values of all following chunks are larger, so
+  // all chunks but the first one of each task can be skipped.
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "int");
+  for (int i = 0; i < 600; ++i) table->append({i});
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) table->compress_chunk(chunk_id);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto top_k = std::make_shared<TopK>(table_wrapper, SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}, 2);
+  top_k->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->append({0});
+  expected->append({1});
+  EXPECT_TABLE_EQ(top_k->get_output(), expected, true);
+  EXPECT_GT(top_k->skipped_chunk_count(), 0u);
+}
+
+TEST_F(OperatorsTopKTest, ThrowsOnInvalidColumnID) {
+  auto top_k = std::make_shared<TopK>(_table_wrapper, SortColumnDefinition{ColumnID{2}}, 3);
+  EXPECT_THROW(top_k->execute(), std::exception);
+}
+
+}  // namespace opossum
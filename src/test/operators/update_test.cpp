@@ -0,0 +1,119 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/update.hpp"
+#include "operators/validate.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsUpdateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2, PolymorphicAllocator<size_t>{}, UseMvcc::Yes);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->append({1, "one"});
+    _table->append({2, "two"});
+    _table->append({3, "three"});
+    StorageManager::get().add_table("table", _table);
+
+    auto updated_values = std::make_shared<Table>();
+    updated_values->add_column("a", "int");
+    updated_values->add_column("b", "string");
+    updated_values->append({2, "zwei"});
+    _updated_values = std::make_shared<TableWrapper>(updated_values);
+    _updated_values->execute();
+  }
+
+  std::shared_ptr<const AbstractOperator> _validated_rows(const ScanType scan_type, const int value,
+                                                          const std::shared_ptr<TransactionContext>& context) {
+    auto get_table = std::make_shared<GetTable>("table");
+    get_table->execute();
+    auto table_scan = std::make_shared<TableScan>(get_table, ColumnID{0}, scan_type, value);
+    table_scan->execute();
+    auto validate = std::make_shared<Validate>(table_scan);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate;
+  }
+
+  std::shared_ptr<Update> _update(const std::shared_ptr<TransactionContext>& context) {
+    auto update = std::make_shared<Update>("table", _validated_rows(ScanType::OpEquals, 2, context), _updated_values);
+    update->set_transaction_context(context);
+    update->execute();
+    return update;
+  }
+
+  std::shared_ptr<Table> _expected(const std::string& second_value) {
+    auto expected = std::make_shared<Table>();
+    expected->add_column("a", "int");
+    expected->add_column("b", "string");
+    expected->append({1, "one"});
+    expected->append({2, second_value});
+    expected->append({3, "three"});
+    return expected;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _updated_values;
+};
+
+TEST_F(OperatorsUpdateTest, ReplacesRows) {
+  const auto older_context = TransactionManager::get().new_transaction_context();
+  const auto context = TransactionManager::get().new_transaction_context();
+  EXPECT_FALSE(_update(context)->execute_failed());
+
+  EXPECT_TABLE_EQ(_validated_rows(ScanType::OpGreaterThan, 0, context)->get_output(), _expected("zwei"));
+  EXPECT_TABLE_EQ(_validated_rows(ScanType::OpGreaterThan, 0, older_context)->get_output(), _expected("two"));
+
+  context->commit();
+  const auto newer_context = TransactionManager::get().new_transaction_context();
+  EXPECT_TABLE_EQ(_validated_rows(ScanType::OpGreaterThan, 0, newer_context)->get_output(), _expected("zwei"));
+  EXPECT_TABLE_EQ(_validated_rows(ScanType::OpGreaterThan, 0, older_context)->get_output(), _expected("two"));
+
+  // the new version is appended to the mutable chunk, the old one is invalidated
+  EXPECT_EQ(_table->row_count(), 4u);
+  EXPECT_EQ(_table->approx_valid_row_count(), 3u);
+  EXPECT_EQ(_table->chunk_count(), 2u);
+}
+
+TEST_F(OperatorsUpdateTest, RollbackKeepsOldVersion) {
+  const auto context = TransactionManager::get().new_transaction_context();
+  _update(context);
+  context->rollback();
+
+  const auto newer_context = TransactionManager::get().new_transaction_context();
+  EXPECT_TABLE_EQ(_validated_rows(ScanType::OpGreaterThan, 0, newer_context)->get_output(), _expected("two"));
+  EXPECT_EQ(_table->approx_valid_row_count(), 3u);
+}
+
+TEST_F(OperatorsUpdateTest, ConflictingUpdatesFail) {
+  const auto first_context = TransactionManager::get().new_transaction_context();
+  const auto second_context = TransactionManager::get().new_transaction_context();
+
+  EXPECT_FALSE(_update(first_context)->execute_failed());
+  EXPECT_TRUE(_update(second_context)->execute_failed());
+  second_context->rollback();
+  first_context->commit();
+
+  const auto newer_context = TransactionManager::get().new_transaction_context();
+  EXPECT_TABLE_EQ(_validated_rows(ScanType::OpGreaterThan, 0, newer_context)->get_output(), _expected("zwei"));
+}
+
+TEST_F(OperatorsUpdateTest, Description) {
+  const auto update = std::make_shared<Update>("table", nullptr, nullptr);
+  EXPECT_EQ(update->name(), "Update");
+  EXPECT_EQ(update->description(), "Update (table)");
+}
+
+}  // namespace opossum
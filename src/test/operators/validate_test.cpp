@@ -0,0 +1,181 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsValidateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4, PolymorphicAllocator<size_t>{}, UseMvcc::Yes);
+    _table->add_column("a", "int");
+    for (auto value = 0; value < 6; ++value) _table->append({value});
+    StorageManager::get().add_table("table", _table);
+
+    _get_table = std::make_shared<GetTable>("table");
+    _get_table->execute();
+  }
+
+  // inserts rows with the given values in a transaction of its own, which is returned
+  std::shared_ptr<TransactionContext> _insert(const std::vector<int>& values) {
+    auto values_table = std::make_shared<Table>();
+    values_table->add_column("a", "int");
+    for (const auto value : values) values_table->append({value});
+    auto table_wrapper = std::make_shared<TableWrapper>(values_table);
+    table_wrapper->execute();
+
+    const auto context = TransactionManager::get().new_transaction_context();
+    auto insert = std::make_shared<Insert>("table", table_wrapper);
+    insert->set_transaction_context(context);
+    insert->execute();
+    return context;
+  }
+
+  std::shared_ptr<const Table> _validate(const std::shared_ptr<const AbstractOperator>& input,
+                                         const std::shared_ptr<TransactionContext>& context) {
+    auto validate = std::make_shared<Validate>(input);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output();
+  }
+
+  std::shared_ptr<Table> _expected(const std::vector<int>& values) {
+    auto expected = std::make_shared<Table>();
+    expected->add_column("a", "int");
+    for (const auto value : values) expected->append({value});
+    return expected;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<GetTable> _get_table;
+};
+
+TEST_F(OperatorsValidateTest, AppendedRowsAreVisible) {
+  const auto context = TransactionManager::get().new_transaction_context();
+  EXPECT_TABLE_EQ(_validate(_get_table, context), _expected({0, 1, 2, 3, 4, 5}), true);
+}
+
+TEST_F(OperatorsValidateTest, UncommittedRowsAreOnlyVisibleToTheirTransaction) {
+  const auto older_context = TransactionManager::get().new_transaction_context();
+  const auto insert_context = _insert({6, 7});
+
+  EXPECT_TABLE_EQ(_validate(_get_table, insert_context), _expected({0, 1, 2, 3, 4, 5, 6, 7}), true);
+  EXPECT_TABLE_EQ(_validate(_get_table, older_context), _expected({0, 1, 2, 3, 4, 5}), true);
+
+  insert_context->commit();
+  const auto newer_context = TransactionManager::get().new_transaction_context();
+
+  // the older transaction keeps its snapshot
+  EXPECT_TABLE_EQ(_validate(_get_table, older_context), _expected({0, 1, 2, 3, 4, 5}), true);
+  EXPECT_TABLE_EQ(_validate(_get_table, newer_context), _expected({0, 1, 2, 3, 4, 5, 6, 7}), true);
+}
+
+TEST_F(OperatorsValidateTest, ValidatesReferenceColumns) {
+  const auto insert_context = _insert({6, 7});
+
+  auto table_scan = std::make_shared<TableScan>(_get_table, ColumnID{0}, ScanType::OpGreaterThan, 3);
+  table_scan->execute();
+
+  EXPECT_TABLE_EQ(_validate(table_scan, insert_context), _expected({4, 5, 6, 7}), true);
+  EXPECT_TABLE_EQ(_validate(table_scan, TransactionManager::get().new_transaction_context()), _expected({4, 5}), true);
+}
+
+TEST_F(OperatorsValidateTest, ValidatesRowsOfSeveralReferencedChunks) {
+  const auto older_context = TransactionManager::get().new_transaction_context();
+  const auto insert_context = _insert({6, 7});
+
+  // the rows alternate between the chunks of the table, the inserted ones are the last two of chunk 1
+  auto pos_list = std::make_shared<PosList>(PosList{RowID{ChunkID{1}, 2}, RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 0},
+                                                    RowID{ChunkID{0}, 3}, RowID{ChunkID{1}, 3}});
+  auto reference_table = std::make_shared<Table>();
+  reference_table->add_column_definition("a", "int");
+  Chunk chunk;
+  chunk.add_column(std::make_shared<ReferenceColumn>(_table, ColumnID{0}, pos_list));
+  reference_table->emplace_chunk(std::move(chunk));
+  auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  table_wrapper->execute();
+
+  EXPECT_TABLE_EQ(_validate(table_wrapper, insert_context), _expected({6, 1, 4, 3, 7}), true);
+  EXPECT_TABLE_EQ(_validate(table_wrapper, older_context), _expected({1, 4, 3}), true);
+}
+
+TEST_F(OperatorsValidateTest, RowVisibility) {
+  const auto our_tid = TransactionID{5};
+  const auto other_tid = TransactionID{6};
+  const auto snapshot = CommitID{10};
+
+  // committed rows
+  EXPECT_TRUE(Validate::is_row_visible(our_tid, snapshot, INVALID_TRANSACTION_ID, 10, MAX_COMMIT_ID));
+  EXPECT_FALSE(Validate::is_row_visible(our_tid, snapshot, INVALID_TRANSACTION_ID, 11, MAX_COMMIT_ID));
+  EXPECT_TRUE(Validate::is_row_visible(our_tid, snapshot, INVALID_TRANSACTION_ID, 3, 11));
+  EXPECT_FALSE(Validate::is_row_visible(our_tid, snapshot, INVALID_TRANSACTION_ID, 3, 10));
+
+  // uncommitted insertions
+  EXPECT_TRUE(Validate::is_row_visible(our_tid, snapshot, our_tid, MAX_COMMIT_ID, MAX_COMMIT_ID));
+  EXPECT_FALSE(Validate::is_row_visible(our_tid, snapshot, other_tid, MAX_COMMIT_ID, MAX_COMMIT_ID));
+  EXPECT_FALSE(Validate::is_row_visible(our_tid, snapshot, INVALID_TRANSACTION_ID, MAX_COMMIT_ID, MAX_COMMIT_ID));
+
+  // uncommitted deletions
+  EXPECT_FALSE(Validate::is_row_visible(our_tid, snapshot, our_tid, 3, MAX_COMMIT_ID));
+  EXPECT_TRUE(Validate::is_row_visible(our_tid, snapshot, other_tid, 3, MAX_COMMIT_ID));
+}
+
+TEST_F(OperatorsValidateTest, ThrowsWithoutTransactionOrMvcc) {
+  auto validate = std::make_shared<Validate>(_get_table);
+  EXPECT_THROW(validate->execute(), std::exception);
+
+  auto table = std::make_shared<Table>(4);
+  table->add_column("a", "int");
+  table->append({1});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto context = TransactionManager::get().new_transaction_context();
+  EXPECT_THROW(_validate(table_wrapper, context), std::exception);
+}
+
+TEST_F(OperatorsValidateTest, ReadsConsistentSnapshotsDuringInserts) {
+  // every transaction inserts a batch of rows, which readers either see entirely or not at all
+  const auto batch_size = 5;
+  const auto batch_count = 40;
+  std::atomic_bool done{false};
+
+  std::thread writer([&]() {
+    for (auto batch = 0; batch < batch_count; ++batch) {
+      _insert(std::vector<int>(batch_size, batch))->commit();
+    }
+    done = true;
+  });
+
+  auto last_row_count = size_t{0};
+  while (!done) {
+    auto get_table = std::make_shared<GetTable>("table");
+    get_table->execute();
+    const auto row_count = _validate(get_table, TransactionManager::get().new_transaction_context())->row_count();
+    EXPECT_EQ((row_count - 6) % batch_size, 0u);
+    EXPECT_GE(row_count, last_row_count);
+    last_row_count = row_count;
+  }
+  writer.join();
+
+  const auto context = TransactionManager::get().new_transaction_context();
+  EXPECT_EQ(_validate(_get_table, context)->row_count(), 6u + batch_size * batch_count);
+}
+
+}  // namespace opossum
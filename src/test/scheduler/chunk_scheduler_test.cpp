@@ -0,0 +1,108 @@
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/chunk_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class SchedulerChunkSchedulerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    t = std::make_shared<Table>(2);
+    t->add_column("col_1", "int");
+    for (int i = 0; i < 11; ++i) t->append({i});
+  }
+
+  std::shared_ptr<Table> t = nullptr;
+};
+
+TEST_F(SchedulerChunkSchedulerTest, ExecutesEveryTaskOnce) {
+  std::vector<std::atomic<int>> executions(100);
+  std::vector<NodeID> task_nodes(executions.size());
+  for (size_t task_id = 0; task_id < task_nodes.size(); ++task_id) task_nodes[task_id] = task_id % 3;
+
+  ChunkScheduler::schedule_and_wait(task_nodes, [&](size_t task_id) { ++executions[task_id]; });
+
+  for (const auto& execution_count : executions) EXPECT_EQ(execution_count, 1);
+}
+
+TEST_F(SchedulerChunkSchedulerTest, DoesNotRunTasksOfTheSameWorkerConcurrently) {
+  std::vector<std::atomic<int>> running_task_counts(ChunkScheduler::max_worker_count());
+  std::atomic<int> execution_count{0};
+  std::atomic_bool overlapped{false};
+  std::vector<NodeID> task_nodes(200, NodeID{0});
+
+  ChunkScheduler::schedule_and_wait(task_nodes, [&](size_t, size_t worker_id) {
+    ASSERT_LT(worker_id, running_task_counts.size());
+    if (++running_task_counts[worker_id] > 1) overlapped = true;
+    ++execution_count;
+    --running_task_counts[worker_id];
+  });
+
+  EXPECT_EQ(execution_count, 200);
+  EXPECT_FALSE(overlapped);
+}
+
+TEST_F(SchedulerChunkSchedulerTest, ExecutesTaskPerChunk) {
+  std::atomic<uint64_t> row_count{0};
+  ChunkScheduler::schedule_per_chunk_and_wait(
+      *t, [&](ChunkID chunk_id) { row_count += t->get_chunk(chunk_id)->size(); });
+
+  EXPECT_EQ(row_count, 11u);
+}
+
+TEST_F(SchedulerChunkSchedulerTest, RethrowsExceptions) {
+  std::vector<NodeID> task_nodes(10, NodeID{0});
+  EXPECT_THROW(ChunkScheduler::schedule_and_wait(task_nodes,
+                                                 [](size_t task_id) {
+                                                   if (task_id == 5) throw std::logic_error("Task failed");
+                                                 }),
+               std::logic_error);
+}
+
+TEST_F(SchedulerChunkSchedulerTest, ExecutesNestedTasks) {
+  std::atomic<int> execution_count{0};
+  std::vector<NodeID> task_nodes(20, NodeID{0});
+
+  ChunkScheduler::schedule_and_wait(task_nodes, [&](size_t) {
+    ChunkScheduler::schedule_and_wait(task_nodes, [&](size_t) { ++execution_count; });
+  });
+
+  EXPECT_EQ(execution_count, 400);
+}
+
+TEST_F(SchedulerChunkSchedulerTest, RunsOnNode) {
+  const auto& topology = Topology::get();
+  const auto last_node = static_cast<NodeID>(topology.node_count() - 1);
+
+  auto executed = false;
+  topology.run_on_node(last_node, [&]() {
+    if (topology.node_count() > 1) {
+      EXPECT_EQ(topology.current_node(), last_node);
+    }
+    executed = true;
+  });
+  EXPECT_TRUE(executed);
+
+  EXPECT_THROW(topology.run_on_node(last_node, []() { throw std::logic_error("Function failed"); }), std::logic_error);
+}
+
+TEST_F(SchedulerChunkSchedulerTest, PlacesChunksRoundRobin) {
+  const auto node_count = Topology::get().node_count();
+  for (ChunkID chunk_id{0}; chunk_id < t->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(t->chunk_numa_node(chunk_id), chunk_id % node_count);
+  }
+
+  // compressed chunks stay on their node
+  t->compress_chunk(ChunkID{1});
+  EXPECT_EQ(t->get_chunk(ChunkID{1})->numa_node(), 1u % node_count);
+}
+
+}  // namespace opossum
@@ -0,0 +1,181 @@
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "resolve_type.hpp"
+#include "storage/base_column.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_nodes.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageAdaptiveRadixTreeIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto value_column = make_shared_by_column_type<BaseColumn, ValueColumn>("string");
+    for (const auto& value : {"hotel", "delta", "delta1", "frank", "delta", "apple", "hotel", "de", "golf"}) {
+      value_column->append(value);
+    }
+    _string_column = make_shared_by_column_type<BaseColumn, DictionaryColumn>("string", value_column);
+    _string_index = std::make_shared<AdaptiveRadixTreeIndex>(_columns(_string_column));
+  }
+
+  // returns a dictionary-compressed int column with row_count rows and distinct_value_count distinct values
+  static std::shared_ptr<BaseColumn> _int_column(const int32_t row_count, const int32_t distinct_value_count) {
+    auto value_column = make_shared_by_column_type<BaseColumn, ValueColumn>("int");
+    for (auto row = 0; row < row_count; ++row) {
+      value_column->append(static_cast<int32_t>((row * 7919ll) % distinct_value_count) * 2);
+    }
+    return make_shared_by_column_type<BaseColumn, DictionaryColumn>("int", value_column);
+  }
+
+  static std::vector<std::shared_ptr<const BaseColumn>> _columns(const std::shared_ptr<BaseColumn>& column) {
+    return {column};
+  }
+
+  static PosList _pos_list(const std::vector<ChunkOffset>& chunk_offsets) {
+    auto pos_list = PosList{};
+    for (const auto chunk_offset : chunk_offsets) pos_list.emplace_back(RowID{ChunkID{3}, chunk_offset});
+    return pos_list;
+  }
+
+  std::shared_ptr<BaseColumn> _string_column;
+  std::shared_ptr<AdaptiveRadixTreeIndex> _string_index;
+};
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, MatchesGroupKeyIndex) {
+  // the distinct value counts lead to inner nodes of all sizes
+  for (const auto distinct_value_count : {3, 12, 40, 1'500, 70'000}) {
+    SCOPED_TRACE(distinct_value_count);
+    const auto column = _int_column(100'000, distinct_value_count);
+    const auto art_index = AdaptiveRadixTreeIndex(_columns(column));
+    const auto group_key_index = GroupKeyIndex(_columns(column));
+
+    EXPECT_EQ(art_index.type(), ColumnIndexType::AdaptiveRadixTree);
+    EXPECT_TRUE(std::equal(art_index.cbegin(), art_index.cend(), group_key_index.cbegin(), group_key_index.cend()));
+
+    // even values are in the column, odd ones are not
+    for (auto value = -1; value <= distinct_value_count * 2 + 1; value += 1 + value / 64) {
+      EXPECT_EQ(std::distance(art_index.cbegin(), art_index.lower_bound({value})),
+                std::distance(group_key_index.cbegin(), group_key_index.lower_bound({value})));
+      EXPECT_EQ(std::distance(art_index.cbegin(), art_index.upper_bound({value})),
+                std::distance(group_key_index.cbegin(), group_key_index.upper_bound({value})));
+    }
+  }
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, KeysAreBinaryComparable) {
+  const auto expect_sorted_keys = [](const auto& sorted_values) {
+    for (size_t index = 1; index < sorted_values.size(); ++index) {
+      SCOPED_TRACE(index);
+      EXPECT_LT(art_key_from_value(sorted_values[index - 1]), art_key_from_value(sorted_values[index]));
+    }
+  };
+
+  expect_sorted_keys(std::vector<int32_t>{std::numeric_limits<int32_t>::min(), -256, -1, 0, 1, 255, 256,
+                                          std::numeric_limits<int32_t>::max()});
+  expect_sorted_keys(std::vector<int64_t>{std::numeric_limits<int64_t>::min(), -1, 0, 1ll << 40,
+                                          std::numeric_limits<int64_t>::max()});
+  expect_sorted_keys(std::vector<float>{-std::numeric_limits<float>::infinity(), -2.5f, -1.0f, -0.5f, 0.0f,
+                                        std::numeric_limits<float>::denorm_min(), 0.5f, 1.0f, 2.5f});
+  expect_sorted_keys(std::vector<double>{std::numeric_limits<double>::lowest(), -1e-300, 0.0, 1e-300, 1.0});
+  expect_sorted_keys(std::vector<std::string>{"", std::string(1, '\0'), std::string("\0\0", 2), "\x01", "a",
+                                              std::string("a\0", 2), "a\x01", "ab", "b", "\xff"});
+
+  EXPECT_EQ(art_key_from_value(-0.0), art_key_from_value(0.0));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, MatchesGroupKeyIndexForAllTypes) {
+  for (const auto& type : {"int", "long", "float", "double", "string"}) {
+    SCOPED_TRACE(type);
+    auto value_column = make_shared_by_column_type<BaseColumn, ValueColumn>(type);
+    resolve_data_type(type, [&](auto data_type) {
+      using Type = typename decltype(data_type)::type;
+      for (auto row = 0; row < 2'000; ++row) {
+        const auto value = (row * 7919 % 500) - 250;
+        if constexpr (std::is_same_v<Type, std::string>) {
+          value_column->append(std::to_string(value));
+        } else {
+          value_column->append(static_cast<Type>(value) / 2);
+        }
+      }
+    });
+    const auto column = make_shared_by_column_type<BaseColumn, DictionaryColumn>(type, value_column);
+    const auto art_index = AdaptiveRadixTreeIndex(_columns(column));
+    const auto group_key_index = GroupKeyIndex(_columns(column));
+
+    for (auto offset = ChunkOffset{0}; offset < 2'000; offset += 7) {
+      const auto value = (*column)[offset];
+      EXPECT_EQ(std::distance(art_index.cbegin(), art_index.lower_bound({value})),
+                std::distance(group_key_index.cbegin(), group_key_index.lower_bound({value})));
+      EXPECT_EQ(std::distance(art_index.cbegin(), art_index.upper_bound({value})),
+                std::distance(group_key_index.cbegin(), group_key_index.upper_bound({value})));
+    }
+  }
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, PointLookup) {
+  EXPECT_EQ(_string_index->point_lookup(ChunkID{3}, "hotel"), _pos_list({0, 6}));
+  EXPECT_EQ(_string_index->point_lookup(ChunkID{3}, "golf"), _pos_list({8}));
+  EXPECT_EQ(_string_index->point_lookup(ChunkID{3}, "echo"), _pos_list({}));
+  EXPECT_EQ(_string_index->point_lookup(ChunkID{3}, "zulu"), _pos_list({}));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, RangeLookup) {
+  EXPECT_EQ(_string_index->range_lookup(ChunkID{3}, "delta", "golf"), _pos_list({1, 2, 3, 4, 8}));
+  EXPECT_EQ(_string_index->range_lookup(ChunkID{3}, "b", "e"), _pos_list({1, 2, 4, 7}));
+  EXPECT_EQ(_string_index->range_lookup(ChunkID{3}, "a", "z"), _pos_list({0, 1, 2, 3, 4, 5, 6, 7, 8}));
+  EXPECT_EQ(_string_index->range_lookup(ChunkID{3}, "golf", "delta"), _pos_list({}));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, PrefixLookup) {
+  EXPECT_EQ(_string_index->prefix_lookup(ChunkID{3}, "de"), _pos_list({1, 2, 4, 7}));
+  EXPECT_EQ(_string_index->prefix_lookup(ChunkID{3}, "delta"), _pos_list({1, 2, 4}));
+  EXPECT_EQ(_string_index->prefix_lookup(ChunkID{3}, "delta1"), _pos_list({2}));
+  EXPECT_EQ(_string_index->prefix_lookup(ChunkID{3}, "e"), _pos_list({}));
+  EXPECT_EQ(_string_index->prefix_lookup(ChunkID{3}, ""), _pos_list({0, 1, 2, 3, 4, 5, 6, 7, 8}));
+  EXPECT_EQ(_string_index->prefix_lookup(ChunkID{3}, "\xff"), _pos_list({}));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, PrefixLookupRequiresStringColumn) {
+  const auto int_index = AdaptiveRadixTreeIndex(_columns(_int_column(10, 5)));
+  EXPECT_THROW(int_index.prefix_lookup(ChunkID{0}, "1"), std::exception);
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, UnreferencedDictionaryValues) {
+  // the dictionary is shared with other columns, this one only references 1 and 7
+  const auto dictionary = std::make_shared<pmr_vector<int32_t>>(pmr_vector<int32_t>{1, 3, 5, 7});
+  auto attribute_vector = std::make_shared<FittedAttributeVector<uint8_t>>(pmr_vector<uint8_t>{3, 0, 3});
+  const auto column = std::make_shared<DictionaryColumn<int32_t>>(dictionary, attribute_vector);
+  const auto index = AdaptiveRadixTreeIndex(_columns(column));
+
+  EXPECT_EQ(index.point_lookup(ChunkID{3}, 3), _pos_list({}));
+  EXPECT_EQ(index.range_lookup(ChunkID{3}, 2, 6), _pos_list({}));
+  EXPECT_EQ(index.range_lookup(ChunkID{3}, 2, 7), _pos_list({0, 2}));
+  EXPECT_EQ(index.point_lookup(ChunkID{3}, 1), _pos_list({1}));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, EmptyColumn) {
+  const auto index = AdaptiveRadixTreeIndex(_columns(_int_column(0, 1)));
+  EXPECT_EQ(index.cbegin(), index.cend());
+  EXPECT_EQ(index.lower_bound({0}), index.cend());
+  EXPECT_EQ(index.point_lookup(ChunkID{0}, 0), _pos_list({}));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, EstimatesMemoryUsage) {
+  const auto small_index = AdaptiveRadixTreeIndex(_columns(_int_column(1'000, 10)));
+  const auto large_index = AdaptiveRadixTreeIndex(_columns(_int_column(1'000, 1'000)));
+  EXPECT_GE(small_index.estimate_memory_usage(), 1'000 * sizeof(ChunkOffset));
+  EXPECT_GT(large_index.estimate_memory_usage(), small_index.estimate_memory_usage());
+}
+
+}  // namespace opossum
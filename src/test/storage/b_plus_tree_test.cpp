@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/index/b_plus_tree/b_plus_tree.hpp"
+
+namespace opossum {
+
+class StorageBPlusTreeTest : public BaseTest {
+ protected:
+  // a small capacity leads to deep trees with few keys
+  using Tree = BPlusTree<int32_t, 4>;
+
+  static std::vector<int32_t> _keys(const Tree& tree) { return std::vector<int32_t>(tree.begin(), tree.end()); }
+};
+
+TEST_F(StorageBPlusTreeTest, EmptyTree) {
+  const auto tree = Tree{};
+  EXPECT_EQ(tree.size(), 0u);
+  EXPECT_EQ(tree.height(), 1u);
+  EXPECT_EQ(tree.begin(), tree.end());
+  EXPECT_EQ(tree.lower_bound(0), tree.end());
+}
+
+TEST_F(StorageBPlusTreeTest, InsertsInRandomOrder) {
+  auto keys = std::vector<int32_t>(1'000);
+  std::iota(keys.begin(), keys.end(), 0);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937{42});
+
+  auto tree = Tree{};
+  for (const auto key : keys) EXPECT_TRUE(tree.insert(key * 2));
+
+  auto expected_keys = std::vector<int32_t>(1'000);
+  std::generate(expected_keys.begin(), expected_keys.end(), [key = 0]() mutable { return (key++) * 2; });
+  EXPECT_EQ(_keys(tree), expected_keys);
+  EXPECT_EQ(tree.size(), 1'000u);
+  EXPECT_GT(tree.height(), 4u);
+}
+
+TEST_F(StorageBPlusTreeTest, RejectsDuplicates) {
+  auto tree = Tree{};
+  EXPECT_TRUE(tree.insert(3));
+  EXPECT_TRUE(tree.insert(1));
+  EXPECT_FALSE(tree.insert(3));
+  EXPECT_EQ(tree.size(), 2u);
+  EXPECT_EQ(_keys(tree), (std::vector<int32_t>{1, 3}));
+}
+
+TEST_F(StorageBPlusTreeTest, LowerBound) {
+  auto tree = Tree{};
+  for (auto key = 0; key < 100; ++key) tree.insert(key * 2);
+
+  for (auto key = -1; key < 200; ++key) {
+    const auto it = tree.lower_bound(key);
+    if (key > 198) {
+      EXPECT_EQ(it, tree.end());
+    } else {
+      EXPECT_EQ(*it, key <= 0 ? 0 : (key + 1) / 2 * 2);
+    }
+  }
+}
+
+TEST_F(StorageBPlusTreeTest, AscendingInsertsFillLeaves) {
+  auto ascending_tree = Tree{};
+  auto descending_tree = Tree{};
+  for (auto key = 0; key < 1'000; ++key) {
+    ascending_tree.insert(key);
+    descending_tree.insert(1'000 - key);
+  }
+
+  // appending at the end of the rightmost leaf does not leave half-empty leaves behind
+  EXPECT_LT(ascending_tree.height(), descending_tree.height());
+  EXPECT_LT(ascending_tree.estimate_memory_usage(), descending_tree.estimate_memory_usage());
+  EXPECT_EQ(_keys(ascending_tree).size(), 1'000u);
+}
+
+TEST_F(StorageBPlusTreeTest, EraseIf) {
+  auto tree = Tree{};
+  for (auto key = 0; key < 1'000; ++key) tree.insert(key);
+  const auto height = tree.height();
+
+  // removes whole leaves and subtrees as well as single keys
+  const auto is_removed = [](const int32_t key) { return (key >= 100 && key < 900) || key % 3 == 0; };
+  EXPECT_EQ(tree.erase_if(is_removed), 868u);
+
+  auto expected_keys = std::vector<int32_t>{};
+  for (auto key = 0; key < 1'000; ++key) {
+    if (!is_removed(key)) expected_keys.emplace_back(key);
+  }
+  EXPECT_EQ(_keys(tree), expected_keys);
+  EXPECT_EQ(tree.size(), expected_keys.size());
+  EXPECT_LE(tree.height(), height);
+  EXPECT_EQ(*tree.lower_bound(99), 901);
+  EXPECT_EQ(*tree.lower_bound(98), 98);
+
+  // the tree stays usable for insertions
+  for (auto key = 100; key < 900; ++key) tree.insert(key);
+  EXPECT_EQ(tree.size(), expected_keys.size() + 800u);
+  EXPECT_EQ(*tree.lower_bound(500), 500);
+}
+
+TEST_F(StorageBPlusTreeTest, EraseAll) {
+  auto tree = Tree{};
+  for (auto key = 0; key < 100; ++key) tree.insert(key);
+
+  EXPECT_EQ(tree.erase_if([](const int32_t) { return true; }), 100u);
+  EXPECT_EQ(tree.size(), 0u);
+  EXPECT_EQ(tree.height(), 1u);
+  EXPECT_EQ(tree.begin(), tree.end());
+  EXPECT_EQ(tree.lower_bound(0), tree.end());
+
+  tree.insert(3);
+  EXPECT_EQ(_keys(tree), std::vector<int32_t>{3});
+}
+
+}  // namespace opossum
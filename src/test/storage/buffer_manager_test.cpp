@@ -0,0 +1,114 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/buffer_manager.hpp"
+#include "../lib/storage/chunk.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StorageBufferManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    t = std::make_shared<Table>(10);
+    t->add_column("col_1", "int");
+    t->add_column("col_2", "string");
+    for (int i = 0; i < 30; ++i) t->append({i, "value_" + std::to_string(i % 7)});
+
+    for (ChunkID chunk_id{0}; chunk_id < t->chunk_count(); ++chunk_id) t->compress_chunk(chunk_id);
+  }
+
+  std::shared_ptr<Table> t = nullptr;
+};
+
+TEST_F(StorageBufferManagerTest, TracksCompressedChunks) {
+  auto& bm = BufferManager::get();
+  EXPECT_EQ(bm.memory_budget(), 0u);
+  EXPECT_GT(bm.memory_usage(), 0u);
+
+  // without a budget nothing is spilled
+  for (ChunkID chunk_id{0}; chunk_id < t->chunk_count(); ++chunk_id) {
+    EXPECT_FALSE(t->get_chunk(chunk_id)->is_spilled());
+  }
+}
+
+TEST_F(StorageBufferManagerTest, SpillsLeastRecentlyUsedChunks) {
+  auto& bm = BufferManager::get();
+
+  // chunk 1 is the most recently used one, chunk 0 the least recently used one
+  t->get_chunk(ChunkID{2});
+  t->get_chunk(ChunkID{1});
+
+  const auto chunk_memory_usage = t->get_chunk(ChunkID{1})->estimate_memory_usage();
+  bm.set_memory_budget(chunk_memory_usage + 1);
+
+  // only chunk 1 fits into the budget, the other two are spilled
+  EXPECT_EQ(bm.memory_usage(), chunk_memory_usage);
+  EXPECT_EQ(t->row_count(), 30u);
+}
+
+TEST_F(StorageBufferManagerTest, ReloadsSpilledChunks) {
+  auto& bm = BufferManager::get();
+  bm.set_memory_budget(1);
+
+  // the budget is too small for even a single chunk, so every chunk that is not pinned is spilled
+  auto chunk = t->get_chunk(ChunkID{0});
+  const auto unpinned_chunk = chunk.get();
+  EXPECT_FALSE(chunk->is_spilled());
+  EXPECT_EQ(chunk->size(), 10u);
+  EXPECT_EQ(chunk->col_count(), 2u);
+
+  chunk = nullptr;
+  EXPECT_TRUE(unpinned_chunk->is_spilled());
+  EXPECT_EQ(unpinned_chunk->size(), 10u);
+  EXPECT_EQ(t->row_count(), 30u);
+
+  const auto other_chunk = t->get_chunk(ChunkID{2});
+  const auto int_column = std::dynamic_pointer_cast<DictionaryColumn<int>>(other_chunk->get_column(ColumnID{0}));
+  ASSERT_NE(int_column, nullptr);
+  EXPECT_EQ(int_column->get(3), 23);
+
+  const auto reloaded_chunk = t->get_chunk(ChunkID{0});
+  EXPECT_FALSE(reloaded_chunk->is_spilled());
+  const auto string_column =
+      std::dynamic_pointer_cast<DictionaryColumn<std::string>>(reloaded_chunk->get_column(ColumnID{1}));
+  ASSERT_NE(string_column, nullptr);
+  EXPECT_EQ(string_column->get(8), "value_1");
+  EXPECT_EQ(string_column->unique_values_count(), 7u);
+}
+
+TEST_F(StorageBufferManagerTest, DoesNotSpillPinnedChunks) {
+  auto& bm = BufferManager::get();
+  bm.set_memory_budget(1);
+
+  // all three chunks stay in memory while they are pinned, even though they exceed the budget
+  const auto chunk_0 = t->get_chunk(ChunkID{0});
+  const auto chunk_1 = t->get_chunk(ChunkID{1});
+  auto chunk_2 = t->get_chunk(ChunkID{2});
+  auto copy_of_chunk_2 = chunk_2;
+  EXPECT_NE(chunk_0->get_column(ColumnID{0}), nullptr);
+  EXPECT_NE(chunk_1->get_column(ColumnID{1}), nullptr);
+  EXPECT_GT(bm.memory_usage(), 1u);
+
+  // the chunk is unpinned once the last copy of the handle is gone
+  const auto unpinned_chunk = chunk_2.get();
+  chunk_2 = nullptr;
+  EXPECT_FALSE(unpinned_chunk->is_spilled());
+  copy_of_chunk_2 = nullptr;
+  EXPECT_TRUE(unpinned_chunk->is_spilled());
+  EXPECT_FALSE(chunk_0->is_spilled());
+  EXPECT_FALSE(chunk_1->is_spilled());
+}
+
+TEST_F(StorageBufferManagerTest, IgnoresDeletedChunks) {
+  auto& bm = BufferManager::get();
+  t = nullptr;
+
+  EXPECT_EQ(bm.memory_usage(), 0u);
+}
+
+}  // namespace opossum
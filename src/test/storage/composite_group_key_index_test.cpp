@@ -0,0 +1,79 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "resolve_type.hpp"
+#include "storage/base_column.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageCompositeGroupKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // offset:              0  1  2  3  4  5  6  7
+    const auto a_values = {3, 1, 2, 1, 3, 1, 2, 3};
+    const auto b_values = {"y", "x", "z", "z", "x", "x", "x", "y"};
+
+    auto a_column = make_shared_by_column_type<BaseColumn, ValueColumn>("int");
+    for (const auto value : a_values) a_column->append(value);
+    auto b_column = make_shared_by_column_type<BaseColumn, ValueColumn>("string");
+    for (const auto value : b_values) b_column->append(value);
+
+    _index = std::make_shared<CompositeGroupKeyIndex>(std::vector<std::shared_ptr<const BaseColumn>>{
+        make_shared_by_column_type<BaseColumn, DictionaryColumn>("int", a_column),
+        make_shared_by_column_type<BaseColumn, DictionaryColumn>("string", b_column)});
+  }
+
+  std::vector<ChunkOffset> _offsets(BaseIndex::Iterator begin, BaseIndex::Iterator end) {
+    return std::vector<ChunkOffset>(begin, end);
+  }
+
+  std::shared_ptr<CompositeGroupKeyIndex> _index;
+};
+
+TEST_F(StorageCompositeGroupKeyIndexTest, IteratesInLexicographicalOrder) {
+  EXPECT_EQ(_index->type(), ColumnIndexType::CompositeGroupKey);
+  // (1,x) (1,x) (1,z) (2,x) (2,z) (3,x) (3,y) (3,y)
+  EXPECT_EQ(_offsets(_index->cbegin(), _index->cend()), (std::vector<ChunkOffset>{1, 5, 3, 6, 2, 4, 0, 7}));
+}
+
+TEST_F(StorageCompositeGroupKeyIndexTest, FullKeyBounds) {
+  EXPECT_EQ(_offsets(_index->lower_bound({1, "x"}), _index->upper_bound({1, "x"})), (std::vector<ChunkOffset>{1, 5}));
+  EXPECT_EQ(_offsets(_index->lower_bound({3, "y"}), _index->upper_bound({3, "y"})), (std::vector<ChunkOffset>{0, 7}));
+  EXPECT_EQ(_index->upper_bound({3, "y"}), _index->cend());
+}
+
+TEST_F(StorageCompositeGroupKeyIndexTest, PrefixBounds) {
+  EXPECT_EQ(_offsets(_index->lower_bound({2}), _index->upper_bound({2})), (std::vector<ChunkOffset>{6, 2}));
+  EXPECT_EQ(_offsets(_index->lower_bound({3}), _index->upper_bound({3})), (std::vector<ChunkOffset>{4, 0, 7}));
+}
+
+TEST_F(StorageCompositeGroupKeyIndexTest, BoundsOfMissingValues) {
+  // "y" is in the dictionary of b, but not combined with a = 1
+  EXPECT_EQ(_index->lower_bound({1, "y"}), _index->upper_bound({1, "y"}));
+  EXPECT_EQ(_offsets(_index->cbegin(), _index->lower_bound({1, "y"})), (std::vector<ChunkOffset>{1, 5}));
+
+  // "w" and "zz" are not in the dictionary of b
+  EXPECT_EQ(_index->lower_bound({2, "w"}), _index->lower_bound({2}));
+  EXPECT_EQ(_index->upper_bound({2, "zz"}), _index->upper_bound({2}));
+
+  // 0 and 4 are not in the dictionary of a
+  EXPECT_EQ(_index->lower_bound({0, "x"}), _index->cbegin());
+  EXPECT_EQ(_index->upper_bound({0, "z"}), _index->cbegin());
+  EXPECT_EQ(_index->lower_bound({4, "x"}), _index->cend());
+  EXPECT_EQ(_index->lower_bound({4}), _index->cend());
+}
+
+TEST_F(StorageCompositeGroupKeyIndexTest, RequiresDictionaryColumns) {
+  auto value_column = make_shared_by_column_type<BaseColumn, ValueColumn>("int");
+  value_column->append(1);
+  EXPECT_THROW(CompositeGroupKeyIndex(std::vector<std::shared_ptr<const BaseColumn>>{value_column}), std::exception);
+}
+
+}  // namespace opossum
@@ -8,50 +8,85 @@
 #include "../../lib/storage/dictionary_column.hpp"
 #include "../../lib/storage/value_column.hpp"
 
-// class StorageDictionaryColumnTest : public ::testing::Test {
-//  protected:
-//   std::shared_ptr<opossum::ValueColumn<int>> vc_int = std::make_shared<opossum::ValueColumn<int>>();
-//   std::shared_ptr<opossum::ValueColumn<std::string>> vc_str = std::make_shared<opossum::ValueColumn<std::string>>();
-// };
-
-// TEST_F(StorageDictionaryColumnTest, CompressColumnString) {
-//   vc_str->append("Bill");
-//   vc_str->append("Steve");
-//   vc_str->append("Alexander");
-//   vc_str->append("Steve");
-//   vc_str->append("Hasso");
-//   vc_str->append("Bill");
-
-//   auto col = opossum::make_shared_by_column_type<opossum::BaseColumn, opossum::DictionaryColumn>("string", vc_str);
-//   auto dict_col = std::dynamic_pointer_cast<opossum::DictionaryColumn<std::string>>(col);
-
-//   // Test attribute_vector size
-//   EXPECT_EQ(dict_col->size(), 6u);
-
-//   // Test dictionary size (uniqueness)
-//   EXPECT_EQ(dict_col->unique_values_count(), 4u);
-
-//   // Test sorting
-//   auto dict = dict_col->dictionary();
-//   EXPECT_EQ((*dict)[0], "Alexander");
-//   EXPECT_EQ((*dict)[1], "Bill");
-//   EXPECT_EQ((*dict)[2], "Hasso");
-//   EXPECT_EQ((*dict)[3], "Steve");
-// }
-
-// TEST_F(StorageDictionaryColumnTest, LowerUpperBound) {
-//   for (int i = 0; i <= 10; i += 2) vc_int->append(i);
-//   auto col = opossum::make_shared_by_column_type<opossum::BaseColumn, opossum::DictionaryColumn>("int", vc_int);
-//   auto dict_col = std::dynamic_pointer_cast<opossum::DictionaryColumn<int>>(col);
-
-//   EXPECT_EQ(dict_col->lower_bound(4), (opossum::ValueID)2);
-//   EXPECT_EQ(dict_col->upper_bound(4), (opossum::ValueID)3);
-
-//   EXPECT_EQ(dict_col->lower_bound(5), (opossum::ValueID)3);
-//   EXPECT_EQ(dict_col->upper_bound(5), (opossum::ValueID)3);
-
-//   EXPECT_EQ(dict_col->lower_bound(15), opossum::INVALID_VALUE_ID);
-//   EXPECT_EQ(dict_col->upper_bound(15), opossum::INVALID_VALUE_ID);
-// }
+class StorageDictionaryColumnTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<opossum::ValueColumn<int>> vc_int = std::make_shared<opossum::ValueColumn<int>>();
+  std::shared_ptr<opossum::ValueColumn<std::string>> vc_str = std::make_shared<opossum::ValueColumn<std::string>>();
+};
+
+TEST_F(StorageDictionaryColumnTest, CompressColumnString) {
+  vc_str->append("Bill");
+  vc_str->append("Steve");
+  vc_str->append("Alexander");
+  vc_str->append("Steve");
+  vc_str->append("Hasso");
+  vc_str->append("Bill");
+
+  auto col = opossum::make_shared_by_column_type<opossum::BaseColumn, opossum::DictionaryColumn>("string", vc_str);
+  auto dict_col = std::dynamic_pointer_cast<opossum::DictionaryColumn<std::string>>(col);
+
+  // Test attribute_vector size
+  EXPECT_EQ(dict_col->size(), 6u);
+
+  // Test dictionary size (uniqueness)
+  EXPECT_EQ(dict_col->unique_values_count(), 4u);
+
+  // Test sorting
+  auto dict = dict_col->dictionary();
+  EXPECT_EQ((*dict)[0], "Alexander");
+  EXPECT_EQ((*dict)[1], "Bill");
+  EXPECT_EQ((*dict)[2], "Hasso");
+  EXPECT_EQ((*dict)[3], "Steve");
+}
+
+TEST_F(StorageDictionaryColumnTest, LowerUpperBound) {
+  for (int i = 0; i <= 10; i += 2) vc_int->append(i);
+  auto col = opossum::make_shared_by_column_type<opossum::BaseColumn, opossum::DictionaryColumn>("int", vc_int);
+  auto dict_col = std::dynamic_pointer_cast<opossum::DictionaryColumn<int>>(col);
+
+  EXPECT_EQ(dict_col->lower_bound(4), (opossum::ValueID)2);
+  EXPECT_EQ(dict_col->upper_bound(4), (opossum::ValueID)3);
+
+  EXPECT_EQ(dict_col->lower_bound(5), (opossum::ValueID)3);
+  EXPECT_EQ(dict_col->upper_bound(5), (opossum::ValueID)3);
+
+  EXPECT_EQ(dict_col->lower_bound(15), opossum::INVALID_VALUE_ID);
+  EXPECT_EQ(dict_col->upper_bound(15), opossum::INVALID_VALUE_ID);
+}
+
+TEST_F(StorageDictionaryColumnTest, CompressColumnWithNulls) {
+  auto vc_nullable = std::make_shared<opossum::ValueColumn<int>>(true, opossum::PolymorphicAllocator<int>{});
+  vc_nullable->append(7);
+  vc_nullable->append(opossum::NULL_VALUE);
+  vc_nullable->append(3);
+  vc_nullable->append(opossum::NULL_VALUE);
+
+  auto col = opossum::make_shared_by_column_type<opossum::BaseColumn, opossum::DictionaryColumn>("int", vc_nullable);
+  auto dict_col = std::dynamic_pointer_cast<opossum::DictionaryColumn<int>>(col);
+
+  // NULL is not part of the dictionary, but referenced by the ValueID behind it
+  EXPECT_EQ(dict_col->unique_values_count(), 2u);
+  EXPECT_EQ(dict_col->null_value_id(), opossum::ValueID{2});
+  EXPECT_EQ(dict_col->attribute_vector()->get(1), opossum::ValueID{2});
+  EXPECT_FALSE(dict_col->is_null(0));
+  EXPECT_TRUE(dict_col->is_null(1));
+  EXPECT_EQ(dict_col->get(2), 3);
+  EXPECT_TRUE(opossum::variant_is_null((*dict_col)[3]));
+}
+
+TEST_F(StorageDictionaryColumnTest, FrontCodedStringDictionary) {
+  for (auto i = 0; i < 50; ++i) vc_str->append("/usr/local/share/doc/file_" + std::to_string(100 + (i % 25) * 2));
+  auto col = opossum::make_shared_by_column_type<opossum::BaseColumn, opossum::DictionaryColumn>("string", vc_str);
+  auto dict_col = std::dynamic_pointer_cast<opossum::DictionaryColumn<std::string>>(col);
+
+  EXPECT_EQ(dict_col->dictionary()->layout(), opossum::StringVector::Layout::FrontCoded);
+  EXPECT_EQ(dict_col->unique_values_count(), 25u);
+  EXPECT_EQ(dict_col->get(30), "/usr/local/share/doc/file_110");
+
+  EXPECT_EQ(dict_col->lower_bound(std::string{"/usr/local/share/doc/file_134"}), (opossum::ValueID)17);
+  EXPECT_EQ(dict_col->upper_bound(std::string{"/usr/local/share/doc/file_134"}), (opossum::ValueID)18);
+  EXPECT_EQ(dict_col->lower_bound(std::string{"/usr/local/share/doc/file_135"}), (opossum::ValueID)18);
+  EXPECT_EQ(dict_col->lower_bound(std::string{"/usr/local/share/doc/file_2"}), opossum::INVALID_VALUE_ID);
+}
 
 // TODO(student): You should add some more tests here (full coverage would be appreciated) and possibly in other files.
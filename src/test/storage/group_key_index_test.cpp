@@ -0,0 +1,86 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "resolve_type.hpp"
+#include "storage/base_column.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageGroupKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto value_column = make_shared_by_column_type<BaseColumn, ValueColumn>("string");
+    for (const auto& value : {"hotel", "delta", "frank", "delta", "apple", "hotel", "delta", "golf"}) {
+      value_column->append(value);
+    }
+    _column = make_shared_by_column_type<BaseColumn, DictionaryColumn>("string", value_column);
+    _index = std::make_shared<GroupKeyIndex>(std::vector<std::shared_ptr<const BaseColumn>>{_column});
+  }
+
+  std::vector<ChunkOffset> _offsets(BaseIndex::Iterator begin, BaseIndex::Iterator end) {
+    return std::vector<ChunkOffset>(begin, end);
+  }
+
+  std::shared_ptr<BaseColumn> _column;
+  std::shared_ptr<GroupKeyIndex> _index;
+};
+
+TEST_F(StorageGroupKeyIndexTest, IteratesInValueOrder) {
+  EXPECT_EQ(_index->type(), ColumnIndexType::GroupKey);
+  EXPECT_EQ(_offsets(_index->cbegin(), _index->cend()), (std::vector<ChunkOffset>{4, 1, 3, 6, 2, 7, 0, 5}));
+}
+
+TEST_F(StorageGroupKeyIndexTest, BoundsOfContainedValues) {
+  EXPECT_EQ(_offsets(_index->lower_bound({"delta"}), _index->upper_bound({"delta"})),
+            (std::vector<ChunkOffset>{1, 3, 6}));
+  EXPECT_EQ(_offsets(_index->lower_bound({"hotel"}), _index->upper_bound({"hotel"})), (std::vector<ChunkOffset>{0, 5}));
+  EXPECT_EQ(_index->lower_bound({"apple"}), _index->cbegin());
+  EXPECT_EQ(_index->upper_bound({"hotel"}), _index->cend());
+}
+
+TEST_F(StorageGroupKeyIndexTest, BoundsOfMissingValues) {
+  EXPECT_EQ(_index->lower_bound({"echo"}), _index->upper_bound({"echo"}));
+  EXPECT_EQ(_offsets(_index->lower_bound({"echo"}), _index->cend()), (std::vector<ChunkOffset>{2, 7, 0, 5}));
+  EXPECT_EQ(_index->lower_bound({"aaa"}), _index->cbegin());
+  EXPECT_EQ(_index->lower_bound({"zulu"}), _index->cend());
+  EXPECT_EQ(_index->upper_bound({"zulu"}), _index->cend());
+}
+
+TEST_F(StorageGroupKeyIndexTest, EmptySearchValues) {
+  EXPECT_EQ(_index->lower_bound({}), _index->cbegin());
+  EXPECT_EQ(_index->upper_bound({}), _index->cend());
+}
+
+TEST_F(StorageGroupKeyIndexTest, EstimatesMemoryUsage) {
+  // 6 offsets for 5 distinct values plus 8 postings
+  EXPECT_GE(_index->estimate_memory_usage(), 6 * sizeof(size_t) + 8 * sizeof(ChunkOffset));
+}
+
+TEST_F(StorageGroupKeyIndexTest, RequiresDictionaryColumn) {
+  auto value_column = make_shared_by_column_type<BaseColumn, ValueColumn>("int");
+  value_column->append(1);
+  EXPECT_THROW(GroupKeyIndex(std::vector<std::shared_ptr<const BaseColumn>>{value_column}), std::exception);
+}
+
+TEST_F(StorageGroupKeyIndexTest, CreatedByChunk) {
+  auto chunk = Chunk{};
+  chunk.add_column(_column);
+
+  EXPECT_EQ(chunk.get_index(ColumnIndexType::GroupKey, {ColumnID{0}}), nullptr);
+
+  const auto index = chunk.create_index<GroupKeyIndex>({ColumnID{0}});
+  EXPECT_EQ(chunk.get_index(ColumnIndexType::GroupKey, {ColumnID{0}}), index);
+  EXPECT_EQ(chunk.get_index(ColumnIndexType::CompositeGroupKey, {ColumnID{0}}), nullptr);
+  EXPECT_EQ(chunk.get_indices({ColumnID{0}}).size(), 1u);
+  EXPECT_EQ(chunk.get_indices({ColumnID{1}}).size(), 0u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#include <cstdint>
+#include <memory>
+#include <numeric>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/huge_page_memory_resource.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageHugePageMemoryResourceTest : public BaseTest {};
+
+TEST_F(StorageHugePageMemoryResourceTest, AlignsLargeAllocationsToHugePages) {
+  for (const auto mode : {HugePageMode::Transparent, HugePageMode::Explicit}) {
+    auto memory_resource = HugePageMemoryResource::get(mode);
+
+    pmr_vector<int64_t> values(HugePageMemoryResource::HUGE_PAGE_SIZE, PolymorphicAllocator<int64_t>(memory_resource));
+    std::iota(values.begin(), values.end(), 0);
+
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(values.data()) % HugePageMemoryResource::HUGE_PAGE_SIZE, 0u);
+    EXPECT_EQ(values.back(), static_cast<int64_t>(HugePageMemoryResource::HUGE_PAGE_SIZE - 1));
+  }
+}
+
+TEST_F(StorageHugePageMemoryResourceTest, PassesSmallAllocationsUpstream) {
+  HugePageMemoryResource memory_resource(HugePageMode::Transparent);
+
+  pmr_vector<int32_t> values(100, 7, PolymorphicAllocator<int32_t>(&memory_resource));
+  values.resize(HugePageMemoryResource::HUGE_PAGE_SIZE, 3);
+  EXPECT_EQ(values.front(), 7);
+  EXPECT_EQ(values.back(), 3);
+}
+
+TEST_F(StorageHugePageMemoryResourceTest, BacksTable) {
+  HugePageMemoryResource memory_resource(HugePageMode::Transparent, 1024);
+
+  Table table{0, &memory_resource};
+  table.add_column("col_1", "int");
+  for (int i = 0; i < 1000; ++i) table.append({i});
+
+  const auto column = std::dynamic_pointer_cast<ValueColumn<int>>(table.get_chunk(ChunkID{0})->get_column(ColumnID{0}));
+  EXPECT_EQ(column->values().get_allocator().resource(), &memory_resource);
+  EXPECT_EQ(column->values()[999], 999);
+}
+
+}  // namespace opossum
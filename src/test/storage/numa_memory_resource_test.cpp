@@ -0,0 +1,53 @@
+#include <cstdint>
+#include <memory>
+#include <numeric>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/scheduler/topology.hpp"
+#include "../lib/storage/huge_page_memory_resource.hpp"
+#include "../lib/storage/numa_memory_resource.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageNumaMemoryResourceTest : public BaseTest {};
+
+TEST_F(StorageNumaMemoryResourceTest, AllocatesOnEveryNode) {
+  for (NodeID node_id{0}; node_id < Topology::get().node_count(); ++node_id) {
+    auto memory_resource = NumaMemoryResource::get(node_id);
+    EXPECT_EQ(memory_resource->node_id(), node_id);
+
+    pmr_vector<int64_t> values(100, 7, PolymorphicAllocator<int64_t>(memory_resource));
+    values.resize(NumaMemoryResource::DEFAULT_MIN_ALLOCATION_SIZE, 3);
+    EXPECT_EQ(values.front(), 7);
+    EXPECT_EQ(values.back(), 3);
+  }
+}
+
+TEST_F(StorageNumaMemoryResourceTest, BacksChunksOfDefaultTables) {
+  Table table{2};
+  table.add_column("col_1", "int");
+  for (int i = 0; i < 5; ++i) table.append({i});
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    const auto column = std::dynamic_pointer_cast<ValueColumn<int>>(chunk->get_column(ColumnID{0}));
+    EXPECT_EQ(column->values().get_allocator().resource(), NumaMemoryResource::get(chunk->numa_node()));
+  }
+}
+
+TEST_F(StorageNumaMemoryResourceTest, KeepsCustomAllocators) {
+  HugePageMemoryResource memory_resource(HugePageMode::Transparent);
+
+  Table table{2, &memory_resource};
+  table.add_column("col_1", "int");
+  for (int i = 0; i < 5; ++i) table.append({i});
+
+  const auto column = std::dynamic_pointer_cast<ValueColumn<int>>(table.get_chunk(ChunkID{2})->get_column(ColumnID{0}));
+  EXPECT_EQ(column->values().get_allocator().resource(), &memory_resource);
+}
+
+}  // namespace opossum
@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/string_vector.hpp"
+
+namespace opossum {
+
+class StorageStringVectorTest : public BaseTest {
+ protected:
+  // checks every string and the bounds of every string and of the strings in between against the input
+  void _expect_strings(const StringVector& string_vector, const std::vector<std::string>& strings) {
+    ASSERT_EQ(string_vector.size(), strings.size());
+    for (size_t i = 0; i < strings.size(); ++i) {
+      EXPECT_EQ(string_vector[i], strings[i]);
+    }
+
+    string_vector.for_each([&](const size_t i, const auto string) { EXPECT_EQ(string, strings[i]); });
+
+    auto search_values = strings;
+    for (const auto& string : strings) search_values.push_back(string + "!");
+    search_values.emplace_back("");
+    search_values.emplace_back("~");
+    for (const auto& value : search_values) {
+      EXPECT_EQ(string_vector.lower_bound(value),
+                static_cast<size_t>(std::lower_bound(strings.cbegin(), strings.cend(), value) - strings.cbegin()));
+      EXPECT_EQ(string_vector.upper_bound(value),
+                static_cast<size_t>(std::upper_bound(strings.cbegin(), strings.cend(), value) - strings.cbegin()));
+    }
+  }
+};
+
+TEST_F(StorageStringVectorTest, VariableLength) {
+  const auto strings = std::vector<std::string>{"", "Alexander", "Bill", "Hasso Plattner Institute"};
+  const auto string_vector = StringVector{strings.cbegin(), strings.cend()};
+
+  EXPECT_EQ(string_vector.layout(), StringVector::Layout::VariableLength);
+  EXPECT_EQ(string_vector.chars().size(), 37u);
+  EXPECT_EQ(string_vector.offsets().size(), 5u);
+  EXPECT_EQ(string_vector.back(), "Hasso Plattner Institute");
+  EXPECT_THROW(string_vector.at(4), std::out_of_range);
+  _expect_strings(string_vector, strings);
+}
+
+TEST_F(StorageStringVectorTest, FixedLength) {
+  // short codes of similar length are padded instead of addressed by offsets
+  const auto strings = std::vector<std::string>{"AIR", "MAIL", "RAIL", "SHIP", "TRUCK"};
+  const auto string_vector = StringVector{strings.cbegin(), strings.cend()};
+
+  EXPECT_EQ(string_vector.layout(), StringVector::Layout::FixedLength);
+  EXPECT_EQ(string_vector.fixed_length(), 5u);
+  EXPECT_TRUE(string_vector.offsets().empty());
+  EXPECT_EQ(string_vector.chars().size(), 25u);
+  EXPECT_EQ(string_vector.front(), "AIR");
+  _expect_strings(string_vector, strings);
+}
+
+TEST_F(StorageStringVectorTest, FrontCoded) {
+  // URLs share long prefixes, so that only their suffixes are stored. 40 strings span three blocks.
+  auto strings = std::vector<std::string>{};
+  for (auto i = 0; i < 40; ++i) {
+    strings.emplace_back("https://www.example.com/products/item_" + std::to_string(1000 + i * 7));
+  }
+  const auto string_vector = StringVector{strings.cbegin(), strings.cend()};
+
+  EXPECT_EQ(string_vector.layout(), StringVector::Layout::FrontCoded);
+  EXPECT_EQ(string_vector.offsets().size(), 3u);
+  EXPECT_LT(string_vector.chars().size(), 300u);
+  EXPECT_EQ(string_vector.at(39), "https://www.example.com/products/item_1273");
+  _expect_strings(string_vector, strings);
+}
+
+TEST_F(StorageStringVectorTest, NullCharactersPreventFixedLength) {
+  const auto strings = std::vector<std::string>{std::string{"a\0b", 3}, "abc"};
+  const auto string_vector = StringVector{strings.cbegin(), strings.cend()};
+
+  EXPECT_NE(string_vector.layout(), StringVector::Layout::FixedLength);
+  _expect_strings(string_vector, strings);
+}
+
+TEST_F(StorageStringVectorTest, Empty) {
+  const auto strings = std::vector<std::string>{};
+  const auto string_vector = StringVector{strings.cbegin(), strings.cend()};
+  EXPECT_TRUE(string_vector.empty());
+  EXPECT_EQ(string_vector.begin(), string_vector.end());
+  EXPECT_EQ(string_vector.lower_bound("a"), 0u);
+
+  const auto empty_strings = std::vector<std::string>{"", ""};
+  _expect_strings(StringVector{empty_strings.cbegin(), empty_strings.cend()}, empty_strings);
+}
+
+}  // namespace opossum
@@ -0,0 +1,126 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/index/table_index.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class StorageTableIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto row = 0; row < 10; ++row) _table->append({row % 5, std::to_string(row)});
+  }
+
+  static PosList _row_ids(const std::vector<std::pair<uint32_t, uint32_t>>& chunk_ids_and_offsets) {
+    auto row_ids = PosList{};
+    for (const auto& chunk_id_and_offset : chunk_ids_and_offsets) {
+      row_ids.emplace_back(RowID{ChunkID{chunk_id_and_offset.first}, chunk_id_and_offset.second});
+    }
+    return row_ids;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StorageTableIndexTest, IndexesExistingRows) {
+  EXPECT_EQ(_table->get_table_index(ColumnID{0}), nullptr);
+
+  const auto index = _table->create_table_index(ColumnID{0});
+  EXPECT_EQ(_table->get_table_index(ColumnID{0}), index);
+  EXPECT_EQ(_table->get_table_index(ColumnID{1}), nullptr);
+  EXPECT_EQ(index->size(), 10u);
+
+  // a = row % 5, i.e., rows 2 and 7
+  EXPECT_EQ(index->point_lookup(2), _row_ids({{0, 2}, {1, 3}}));
+  EXPECT_EQ(index->point_lookup(5), _row_ids({}));
+}
+
+TEST_F(StorageTableIndexTest, Lookups) {
+  const auto index = _table->create_table_index(ColumnID{0});
+
+  EXPECT_EQ(index->lookup(ScanType::OpLessThan, 1), _row_ids({{0, 0}, {1, 1}}));
+  EXPECT_EQ(index->lookup(ScanType::OpLessThanEquals, 1), _row_ids({{0, 0}, {0, 1}, {1, 1}, {1, 2}}));
+  EXPECT_EQ(index->lookup(ScanType::OpGreaterThan, 3), _row_ids({{1, 0}, {2, 1}}));
+  EXPECT_EQ(index->lookup(ScanType::OpGreaterThanEquals, 4), _row_ids({{1, 0}, {2, 1}}));
+  EXPECT_EQ(index->lookup(ScanType::OpNotEquals, 0).size(), 8u);
+  EXPECT_EQ(index->range_lookup(1, 2), _row_ids({{0, 1}, {0, 2}, {1, 2}, {1, 3}}));
+  EXPECT_EQ(index->range_lookup(2, 1), _row_ids({}));
+}
+
+TEST_F(StorageTableIndexTest, RemovesChunks) {
+  auto index = TableIndex<int32_t>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < 100; ++chunk_id) {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 10; ++chunk_offset) {
+      index.insert(static_cast<int32_t>(chunk_offset), RowID{chunk_id, chunk_offset});
+    }
+  }
+
+  index.remove_chunks({ChunkID{3}, ChunkID{1}});
+  index.remove_chunks({});
+  EXPECT_EQ(index.size(), 980u);
+
+  auto expected_row_ids = PosList{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < 100; ++chunk_id) {
+    if (chunk_id != ChunkID{1} && chunk_id != ChunkID{3}) expected_row_ids.emplace_back(RowID{chunk_id, 7});
+  }
+  EXPECT_EQ(index.point_lookup(7), expected_row_ids);
+
+  // chunk ids beyond the removed ones are kept
+  index.remove_chunks({ChunkID{0}});
+  EXPECT_EQ(index.size(), 970u);
+  EXPECT_EQ(index.range_lookup(0, 9).front(), (RowID{ChunkID{2}, 0}));
+}
+
+TEST_F(StorageTableIndexTest, MaintainedOnAppend) {
+  const auto index = _table->create_table_index(ColumnID{1});
+
+  // rows 10 to 12 fill the third chunk and start a fourth one
+  for (auto row = 10; row < 13; ++row) _table->append({0, std::string{"new"}});
+  EXPECT_EQ(index->size(), 13u);
+  EXPECT_EQ(index->point_lookup("new"), _row_ids({{2, 2}, {2, 3}, {3, 0}}));
+  EXPECT_EQ(index->point_lookup("9"), _row_ids({{2, 1}}));
+}
+
+TEST_F(StorageTableIndexTest, MaintainedOnEmplaceChunk) {
+  const auto index = _table->create_table_index(ColumnID{0});
+
+  auto other_table = Table{4};
+  other_table.add_column("a", "int");
+  other_table.add_column("b", "string");
+  other_table.append({7, std::string{"x"}});
+  other_table.append({2, std::string{"y"}});
+  other_table.compress_chunk(ChunkID{0});
+
+  _table->emplace_chunk(std::move(*other_table.get_chunk(ChunkID{0})));
+  EXPECT_EQ(index->point_lookup(7), _row_ids({{3, 0}}));
+  EXPECT_EQ(index->point_lookup(2), _row_ids({{0, 2}, {1, 3}, {3, 1}}));
+}
+
+TEST_F(StorageTableIndexTest, ValidAfterCompression) {
+  const auto index = _table->create_table_index(ColumnID{0});
+  _table->compress_chunk(ChunkID{0});
+  _table->compress_chunk(ChunkID{1});
+
+  EXPECT_EQ(index->point_lookup(2), _row_ids({{0, 2}, {1, 3}}));
+
+  // indexes can also be created on compressed chunks
+  const auto string_index = _table->create_table_index(ColumnID{1});
+  EXPECT_EQ(string_index->point_lookup("5"), _row_ids({{1, 1}}));
+}
+
+TEST_F(StorageTableIndexTest, EstimatesMemoryUsage) {
+  const auto index = _table->create_table_index(ColumnID{1});
+  EXPECT_GE(index->estimate_memory_usage(), 10 * (sizeof(std::string) + sizeof(RowID)));
+}
+
+}  // namespace opossum
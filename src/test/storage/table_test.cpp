@@ -1,3 +1,5 @@
+#include <boost/container/pmr/monotonic_buffer_resource.hpp>
+
 #include <limits>
 #include <memory>
 #include <string>
@@ -8,67 +10,128 @@
 #include "gtest/gtest.h"
 
 #include "../lib/resolve_type.hpp"
+#include "../lib/storage/dictionary_column.hpp"
 #include "../lib/storage/table.hpp"
 
 namespace opossum {
 
-// class StorageTableTest : public BaseTest {
-//  protected:
-//   void SetUp() override {
-//     t.add_column("col_1", "int");
-//     t.add_column("col_2", "string");
-//   }
-
-//   Table t{2};
-// };
-
-// TEST_F(StorageTableTest, ChunkCount) {
-//   EXPECT_EQ(t.chunk_count(), 1u);
-//   t.append({4, "Hello,"});
-//   t.append({6, "world"});
-//   t.append({3, "!"});
-//   EXPECT_EQ(t.chunk_count(), 2u);
-// }
-
-// TEST_F(StorageTableTest, GetChunk) {
-//   t.get_chunk(ChunkID{0});
-//   // TODO(anyone): Do we want checks here?
-//   // EXPECT_THROW(t.get_chunk(ChunkID{q}), std::exception);
-//   t.append({4, "Hello,"});
-//   t.append({6, "world"});
-//   t.append({3, "!"});
-//   t.get_chunk(ChunkID{1});
-// }
-
-// TEST_F(StorageTableTest, ColCount) { EXPECT_EQ(t.col_count(), 2u); }
-
-// TEST_F(StorageTableTest, RowCount) {
-//   EXPECT_EQ(t.row_count(), 0u);
-//   t.append({4, "Hello,"});
-//   t.append({6, "world"});
-//   t.append({3, "!"});
-//   EXPECT_EQ(t.row_count(), 3u);
-// }
-
-// TEST_F(StorageTableTest, GetColumnName) {
-//   EXPECT_EQ(t.column_name(ColumnID{0}), "col_1");
-//   EXPECT_EQ(t.column_name(ColumnID{1}), "col_2");
-//   // TODO(anyone): Do we want checks here?
-//   // EXPECT_THROW(t.column_name(ColumnID{2}), std::exception);
-// }
-
-// TEST_F(StorageTableTest, GetColumnType) {
-//   EXPECT_EQ(t.column_type(ColumnID{0}), "int");
-//   EXPECT_EQ(t.column_type(ColumnID{1}), "string");
-//   // TODO(anyone): Do we want checks here?
-//   // EXPECT_THROW(t.column_type(ColumnID{2}), std::exception);
-// }
-
-// TEST_F(StorageTableTest, GetColumnIdByName) {
-//   EXPECT_EQ(t.column_id_by_name("col_2"), 1u);
-//   EXPECT_THROW(t.column_id_by_name("no_column_name"), std::exception);
-// }
-
-// TEST_F(StorageTableTest, GetChunkSize) { EXPECT_EQ(t.chunk_size(), 2u); }
+class StorageTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    t.add_column("col_1", "int");
+    t.add_column("col_2", "string");
+  }
+
+  Table t{2};
+};
+
+TEST_F(StorageTableTest, ChunkCount) {
+  EXPECT_EQ(t.chunk_count(), 1u);
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  EXPECT_EQ(t.chunk_count(), 2u);
+}
+
+TEST_F(StorageTableTest, GetChunk) {
+  t.get_chunk(ChunkID{0});
+  // TODO(anyone): Do we want checks here?
+  // EXPECT_THROW(t.get_chunk(ChunkID{q}), std::exception);
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  t.get_chunk(ChunkID{1});
+}
+
+TEST_F(StorageTableTest, ColCount) { EXPECT_EQ(t.col_count(), 2u); }
+
+TEST_F(StorageTableTest, RowCount) {
+  EXPECT_EQ(t.row_count(), 0u);
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  EXPECT_EQ(t.row_count(), 3u);
+}
+
+TEST_F(StorageTableTest, GetColumnName) {
+  EXPECT_EQ(t.column_name(ColumnID{0}), "col_1");
+  EXPECT_EQ(t.column_name(ColumnID{1}), "col_2");
+  // TODO(anyone): Do we want checks here?
+  // EXPECT_THROW(t.column_name(ColumnID{2}), std::exception);
+}
+
+TEST_F(StorageTableTest, GetColumnType) {
+  EXPECT_EQ(t.column_type(ColumnID{0}), "int");
+  EXPECT_EQ(t.column_type(ColumnID{1}), "string");
+  // TODO(anyone): Do we want checks here?
+  // EXPECT_THROW(t.column_type(ColumnID{2}), std::exception);
+}
+
+TEST_F(StorageTableTest, GetColumnIdByName) {
+  EXPECT_EQ(t.column_id_by_name("col_2"), 1u);
+  EXPECT_THROW(t.column_id_by_name("no_column_name"), std::exception);
+}
+
+TEST_F(StorageTableTest, GetChunkSize) { EXPECT_EQ(t.chunk_size(), 2u); }
+
+TEST_F(StorageTableTest, AllocatesFromMemoryResource) {
+  boost::container::pmr::monotonic_buffer_resource memory_resource;
+
+  Table table{2, &memory_resource};
+  table.add_column("col_1", "int");
+  table.append({4});
+  table.append({6});
+  table.append({3});
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto column = std::dynamic_pointer_cast<ValueColumn<int>>(table.get_chunk(chunk_id)->get_column(ColumnID{0}));
+    EXPECT_EQ(column->values().get_allocator().resource(), &memory_resource);
+  }
+
+  table.compress_chunk(ChunkID{0});
+  const auto dictionary_column =
+      std::dynamic_pointer_cast<DictionaryColumn<int>>(table.get_chunk(ChunkID{0})->get_column(ColumnID{0}));
+  EXPECT_EQ(dictionary_column->dictionary()->get_allocator().resource(), &memory_resource);
+}
+
+TEST_F(StorageTableTest, MvccColumns) {
+  Table table{2, {}, UseMvcc::Yes};
+  table.add_column("col_1", "int");
+  EXPECT_TRUE(table.uses_mvcc());
+  EXPECT_FALSE(t.uses_mvcc());
+  EXPECT_THROW(Table(0, {}, UseMvcc::Yes), std::exception);
+
+  table.append({4});
+  table.append({6});
+  table.append({3});
+  const auto transaction_row_ids = table.append_uncommitted({{5}}, TransactionID{7});
+  EXPECT_EQ(transaction_row_ids, (PosList{RowID{ChunkID{1}, 1}}));
+
+  // appended rows are committed, the transaction's row is not
+  const auto mvcc_columns = table.get_chunk(ChunkID{1})->mvcc_columns();
+  EXPECT_EQ(mvcc_columns->capacity(), 2u);
+  EXPECT_EQ(mvcc_columns->begin_cids[0], 0u);
+  EXPECT_EQ(mvcc_columns->tids[0], INVALID_TRANSACTION_ID);
+  EXPECT_EQ(mvcc_columns->begin_cids[1], MAX_COMMIT_ID);
+  EXPECT_EQ(mvcc_columns->tids[1], 7u);
+  EXPECT_EQ(mvcc_columns->end_cids[1], MAX_COMMIT_ID);
+
+  // the mutable chunk's columns are allocated upfront, so that appends do not move the values
+  const auto column = std::dynamic_pointer_cast<ValueColumn<int>>(table.get_chunk(ChunkID{1})->get_column(ColumnID{0}));
+  EXPECT_EQ(column->values().capacity(), 2u);
+
+  // compression keeps the MVCC columns, emplaced chunks get ones in which all rows are visible
+  table.compress_chunk(ChunkID{0});
+  EXPECT_TRUE(table.get_chunk(ChunkID{0})->has_mvcc_columns());
+
+  Chunk chunk;
+  chunk.add_column(std::make_shared<ValueColumn<int>>(pmr_vector<int>{1, 2, 3}));
+  table.emplace_chunk(std::move(chunk));
+  const auto emplaced_mvcc_columns = table.get_chunk(ChunkID{2})->mvcc_columns();
+  EXPECT_EQ(emplaced_mvcc_columns->capacity(), 3u);
+  EXPECT_EQ(emplaced_mvcc_columns->begin_cids[2], 0u);
+
+  EXPECT_THROW(t.append_uncommitted({{1, "a"}}, TransactionID{1}), std::exception);
+}
 
 }  // namespace opossum
@@ -9,42 +9,74 @@
 
 namespace opossum {
 
-// class StorageValueColumnTest : public BaseTest {
-//  protected:
-//   ValueColumn<int> vc_int;
-//   ValueColumn<std::string> vc_str;
-//   ValueColumn<double> vc_double;
-// };
-
-// TEST_F(StorageValueColumnTest, GetSize) {
-//   EXPECT_EQ(vc_int.size(), 0u);
-//   EXPECT_EQ(vc_str.size(), 0u);
-//   EXPECT_EQ(vc_double.size(), 0u);
-// }
-
-// TEST_F(StorageValueColumnTest, AddValueOfSameType) {
-//   vc_int.append(3);
-//   EXPECT_EQ(vc_int.size(), 1u);
-
-//   vc_str.append("Hello");
-//   EXPECT_EQ(vc_str.size(), 1u);
-
-//   vc_double.append(3.14);
-//   EXPECT_EQ(vc_double.size(), 1u);
-// }
-
-// TEST_F(StorageValueColumnTest, AddValueOfDifferentType) {
-//   vc_int.append(3.14);
-//   EXPECT_EQ(vc_int.size(), 1u);
-//   EXPECT_THROW(vc_int.append("Hi"), std::exception);
-
-//   vc_str.append(3);
-//   vc_str.append(4.44);
-//   EXPECT_EQ(vc_str.size(), 2u);
-
-//   vc_double.append(4);
-//   EXPECT_EQ(vc_double.size(), 1u);
-//   EXPECT_THROW(vc_double.append("Hi"), std::exception);
-// }
+class StorageValueColumnTest : public BaseTest {
+ protected:
+  ValueColumn<int> vc_int;
+  ValueColumn<std::string> vc_str;
+  ValueColumn<double> vc_double;
+};
+
+TEST_F(StorageValueColumnTest, GetSize) {
+  EXPECT_EQ(vc_int.size(), 0u);
+  EXPECT_EQ(vc_str.size(), 0u);
+  EXPECT_EQ(vc_double.size(), 0u);
+}
+
+TEST_F(StorageValueColumnTest, AddValueOfSameType) {
+  vc_int.append(3);
+  EXPECT_EQ(vc_int.size(), 1u);
+
+  vc_str.append("Hello");
+  EXPECT_EQ(vc_str.size(), 1u);
+
+  vc_double.append(3.14);
+  EXPECT_EQ(vc_double.size(), 1u);
+}
+
+TEST_F(StorageValueColumnTest, AddValueOfDifferentType) {
+  vc_int.append(3.14);
+  EXPECT_EQ(vc_int.size(), 1u);
+  EXPECT_THROW(vc_int.append("Hi"), std::exception);
+
+  vc_str.append(3);
+  vc_str.append(4.44);
+  EXPECT_EQ(vc_str.size(), 2u);
+
+  vc_double.append(4);
+  EXPECT_EQ(vc_double.size(), 1u);
+  EXPECT_THROW(vc_double.append("Hi"), std::exception);
+}
+
+TEST_F(StorageValueColumnTest, AppendNullValue) {
+  ValueColumn<int> vc_nullable{true, {}};
+  vc_nullable.append(3);
+  vc_nullable.append(NULL_VALUE);
+  EXPECT_EQ(vc_nullable.size(), 2u);
+  EXPECT_FALSE(vc_nullable.is_null(0));
+  EXPECT_TRUE(vc_nullable.is_null(1));
+  EXPECT_EQ(vc_nullable[0], AllTypeVariant{3});
+  EXPECT_TRUE(variant_is_null(vc_nullable[1]));
+
+  EXPECT_FALSE(vc_int.is_nullable());
+  EXPECT_THROW(vc_int.append(NULL_VALUE), std::exception);
+}
+
+TEST_F(StorageValueColumnTest, NullBitmap) {
+  // the bitmap grows across several words
+  ValueColumn<int> vc_nullable{true, {}};
+  for (auto i = 0; i < 200; ++i) vc_nullable.append(i % 3 == 0 ? NULL_VALUE : AllTypeVariant{i});
+  for (auto i = 0; i < 200; ++i) EXPECT_EQ(vc_nullable.is_null(i), i % 3 == 0) << i;
+
+  pmr_vector<bool> null_values{false, true, true};
+  ValueColumn<int> vc_from_vectors{pmr_vector<int>{1, 2, 3}, null_values};
+  EXPECT_FALSE(vc_from_vectors.is_null(0));
+  EXPECT_TRUE(vc_from_vectors.is_null(1));
+  EXPECT_TRUE(vc_from_vectors.is_null(2));
+
+  // columns with a capacity reserve one bit per value
+  const ValueColumn<int> vc_with_capacity{1'000, {}, true};
+  const ValueColumn<int> vc_without_nulls{1'000, {}, false};
+  EXPECT_EQ(vc_with_capacity.estimate_memory_usage(), vc_without_nulls.estimate_memory_usage() + 16 * sizeof(uint64_t));
+}
 
 }  // namespace opossum
@@ -0,0 +1,85 @@
+#include <optional>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "utils/like_matcher.hpp"
+
+namespace opossum {
+
+class UtilsLikeMatcherTest : public BaseTest {};
+
+TEST_F(UtilsLikeMatcherTest, MatchesWithoutWildcards) {
+  const auto matcher = LikeMatcher{"abc"};
+  EXPECT_TRUE(matcher.matches("abc"));
+  EXPECT_FALSE(matcher.matches("ab"));
+  EXPECT_FALSE(matcher.matches("abcd"));
+  EXPECT_FALSE(matcher.matches(""));
+  EXPECT_TRUE(LikeMatcher{""}.matches(""));
+}
+
+TEST_F(UtilsLikeMatcherTest, MatchesPrefixSuffixAndContains) {
+  const auto prefix = LikeMatcher{"ab%"};
+  EXPECT_TRUE(prefix.matches("ab"));
+  EXPECT_TRUE(prefix.matches("abc"));
+  EXPECT_FALSE(prefix.matches("cab"));
+
+  const auto suffix = LikeMatcher{"%ab"};
+  EXPECT_TRUE(suffix.matches("ab"));
+  EXPECT_TRUE(suffix.matches("cab"));
+  EXPECT_FALSE(suffix.matches("abc"));
+
+  const auto contains = LikeMatcher{"%ab%"};
+  EXPECT_TRUE(contains.matches("ab"));
+  EXPECT_TRUE(contains.matches("xxabxx"));
+  EXPECT_FALSE(contains.matches("a_b"));
+
+  EXPECT_TRUE(LikeMatcher{"%"}.matches(""));
+  EXPECT_TRUE(LikeMatcher{"%"}.matches("anything"));
+}
+
+TEST_F(UtilsLikeMatcherTest, MatchesSegmentsInOrder) {
+  const auto matcher = LikeMatcher{"a%b%c%d"};
+  EXPECT_TRUE(matcher.matches("abcd"));
+  EXPECT_TRUE(matcher.matches("axxbxxcxxd"));
+  EXPECT_FALSE(matcher.matches("acbd"));
+
+  // the prefix and the suffix must not overlap
+  EXPECT_FALSE(LikeMatcher{"ab%ba"}.matches("aba"));
+  EXPECT_TRUE(LikeMatcher{"ab%ba"}.matches("abba"));
+  EXPECT_FALSE(LikeMatcher{"%aa%aa%"}.matches("aaa"));
+}
+
+TEST_F(UtilsLikeMatcherTest, MatchesSingleCharacterWildcards) {
+  const auto matcher = LikeMatcher{"a_c"};
+  EXPECT_TRUE(matcher.matches("abc"));
+  EXPECT_TRUE(matcher.matches("a_c"));
+  EXPECT_FALSE(matcher.matches("ac"));
+  EXPECT_FALSE(matcher.matches("abbc"));
+
+  const auto mixed = LikeMatcher{"%a_c%"};
+  EXPECT_TRUE(mixed.matches("aabcc"));
+  EXPECT_TRUE(mixed.matches("xxaxc"));
+  EXPECT_FALSE(mixed.matches("xxacx"));
+  EXPECT_TRUE(LikeMatcher{"_%_"}.matches("ab"));
+  EXPECT_FALSE(LikeMatcher{"_%_"}.matches("a"));
+}
+
+TEST_F(UtilsLikeMatcherTest, ExposesPrefixes) {
+  EXPECT_EQ(LikeMatcher{"abc%"}.prefix(), std::optional<std::string>{"abc"});
+  EXPECT_EQ(LikeMatcher{"abc%%"}.prefix(), std::optional<std::string>{"abc"});
+  EXPECT_EQ(LikeMatcher{"%"}.prefix(), std::optional<std::string>{""});
+  EXPECT_EQ(LikeMatcher{"abc"}.prefix(), std::nullopt);
+  EXPECT_EQ(LikeMatcher{"a%c"}.prefix(), std::nullopt);
+  EXPECT_EQ(LikeMatcher{"a_%"}.prefix(), std::nullopt);
+}
+
+TEST_F(UtilsLikeMatcherTest, PrefixUpperBound) {
+  EXPECT_EQ(LikeMatcher::prefix_upper_bound("abc"), std::optional<std::string>{"abd"});
+  EXPECT_EQ(LikeMatcher::prefix_upper_bound("ab\xff"), std::optional<std::string>{"ac"});
+  EXPECT_EQ(LikeMatcher::prefix_upper_bound("\xff\xff"), std::nullopt);
+  EXPECT_EQ(LikeMatcher::prefix_upper_bound(""), std::nullopt);
+}
+
+}  // namespace opossum
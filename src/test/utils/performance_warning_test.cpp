@@ -0,0 +1,53 @@
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/value_column.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+class UtilsPerformanceWarningTest : public BaseTest {
+ protected:
+  void SetUp() override { PerformanceWarningRegistry::get().reset_counts(); }
+
+  // the registry reports the file and line of the PerformanceWarning as its site
+  static constexpr auto WARNING_LINE = __LINE__ + 1;
+  static void _issue_warning() { PerformanceWarning("test warning"); }
+
+  static std::string _warning_site() { return std::string(__FILENAME__) + ":" + std::to_string(WARNING_LINE); }
+};
+
+TEST_F(UtilsPerformanceWarningTest, CountsEveryWarning) {
+  for (int i = 0; i < 5; ++i) _issue_warning();
+  EXPECT_EQ(PerformanceWarningRegistry::get().count("test warning"), 5u);
+
+  PerformanceWarningRegistry::get().reset_counts();
+  EXPECT_EQ(PerformanceWarningRegistry::get().count("test warning"), 0u);
+}
+
+TEST_F(UtilsPerformanceWarningTest, CountsColumnAccessesByOperator) {
+  ValueColumn<int> column;
+  column.append(1);
+  column.append(2);
+
+  for (int i = 0; i < 10; ++i) column[i % 2];
+  EXPECT_EQ(PerformanceWarningRegistry::get().count("operator[] used"), 10u);
+}
+
+TEST_F(UtilsPerformanceWarningTest, DumpsCountsAndSites) {
+  for (int i = 0; i < 3; ++i) _issue_warning();
+
+  std::ostringstream out;
+  PerformanceWarningRegistry::get().dump(out);
+  EXPECT_EQ(out.str(), "test warning: 3\n  " + _warning_site() + ": 3\n");
+
+  const auto sites = PerformanceWarningRegistry::get().fired_sites();
+  ASSERT_EQ(sites.size(), 1u);
+  EXPECT_EQ(sites.front()->count(), 3u);
+}
+
+}  // namespace opossum
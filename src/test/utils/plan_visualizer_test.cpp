@@ -0,0 +1,64 @@
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/limit.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+#include "utils/plan_visualizer.hpp"
+
+namespace opossum {
+
+class UtilsPlanVisualizerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    _scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+    _limit = std::make_shared<Limit>(_scan, 1);
+
+    _table_wrapper->execute();
+    _scan->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<TableScan> _scan;
+  std::shared_ptr<Limit> _limit;
+};
+
+TEST_F(UtilsPlanVisualizerTest, PrintsText) {
+  std::ostringstream out;
+  PlanVisualizer::print_text(_limit, out);
+
+  std::string line;
+  std::istringstream lines(out.str());
+  std::getline(lines, line);
+  EXPECT_EQ(line, "Limit (1): not executed");
+  std::getline(lines, line);
+  EXPECT_EQ(line.find("  TableScan (#0 >= 1234): "), 0u);
+  EXPECT_NE(line.find("3 rows in 2 chunks -> 2 rows in 2 chunks"), std::string::npos);
+  std::getline(lines, line);
+  EXPECT_EQ(line.find("    TableWrapper: "), 0u);
+  EXPECT_FALSE(std::getline(lines, line));
+}
+
+TEST_F(UtilsPlanVisualizerTest, PrintsDot) {
+  _limit->execute();
+
+  std::ostringstream out;
+  PlanVisualizer::print_dot(_limit, out);
+  const auto dot = out.str();
+
+  EXPECT_EQ(dot.find("digraph {"), 0u);
+  EXPECT_NE(dot.find("operator0 [label=\"Limit (1)\\n"), std::string::npos);
+  EXPECT_NE(dot.find("operator1 [label=\"TableScan (#0 >= 1234)\\n"), std::string::npos);
+  EXPECT_NE(dot.find("operator1 -> operator0 [label=\"2 rows\"];"), std::string::npos);
+  EXPECT_NE(dot.find("operator2 -> operator1 [label=\"3 rows\"];"), std::string::npos);
+  EXPECT_NE(dot.find("fillcolor"), std::string::npos);
+}
+
+}  // namespace opossum
@@ -0,0 +1,195 @@
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/dictionary_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/table_generator.hpp"
+
+namespace opossum {
+
+class UtilsTableGeneratorTest : public BaseTest {
+ protected:
+  // returns the values of an int column of a table that was generated without compression
+  std::vector<int32_t> _values(const Table& table, const ChunkID chunk_id, const ColumnID column_id = ColumnID{0}) {
+    const auto column =
+        std::dynamic_pointer_cast<ValueColumn<int32_t>>(table.get_chunk(chunk_id)->get_column(column_id));
+    EXPECT_NE(column, nullptr);
+    return std::vector<int32_t>(column->values().cbegin(), column->values().cend());
+  }
+
+  TableGenerator _table_generator;
+};
+
+TEST_F(UtilsTableGeneratorTest, GeneratesColumnsAndChunks) {
+  const auto table = _table_generator.generate_table(
+      {{"a", "int"}, {"b", "long"}, {"c", "float"}, {"d", "double"}, {"e", "string"}}, 1'050, 100);
+
+  EXPECT_EQ(table->col_count(), 5u);
+  EXPECT_EQ(table->column_names(), (std::vector<std::string>{"a", "b", "c", "d", "e"}));
+  EXPECT_EQ(table->column_type(ColumnID{4}), "string");
+  EXPECT_EQ(table->row_count(), 1'050u);
+  EXPECT_EQ(table->chunk_count(), ChunkID{11});
+  EXPECT_EQ(table->chunk_size(), 100u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 100u);
+  EXPECT_EQ(table->get_chunk(ChunkID{10})->size(), 50u);
+}
+
+TEST_F(UtilsTableGeneratorTest, GeneratesEmptyTable) {
+  const auto table = _table_generator.generate_table({{"a", "int"}, {"b", "string"}}, 0, 100);
+
+  EXPECT_EQ(table->col_count(), 2u);
+  EXPECT_EQ(table->row_count(), 0u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->col_count(), 2u);
+}
+
+TEST_F(UtilsTableGeneratorTest, GeneratesSingleChunkWithoutChunkSize) {
+  const auto table = _table_generator.generate_table({{"a", "int"}}, 1'000, 0);
+
+  EXPECT_EQ(table->chunk_count(), ChunkID{1});
+  EXPECT_EQ(table->row_count(), 1'000u);
+}
+
+TEST_F(UtilsTableGeneratorTest, IsDeterministic) {
+  const auto specification = std::vector<ColumnSpecification>{{"a", "int"}, {"b", "string"}};
+
+  const auto table = _table_generator.generate_table(specification, 1'000, 100);
+  EXPECT_TABLE_EQ(table, TableGenerator{}.generate_table(specification, 1'000, 100), true);
+  EXPECT_NE(_values(*table, ChunkID{0}), _values(*TableGenerator{7}.generate_table(specification, 1'000, 100),
+                                                 ChunkID{0}));
+}
+
+TEST_F(UtilsTableGeneratorTest, CompressesChunks) {
+  const auto table = _table_generator.generate_table({{"a", "int"}, {"b", "string"}}, 250, 100, true);
+
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    EXPECT_NE(std::dynamic_pointer_cast<DictionaryColumn<int32_t>>(chunk->get_column(ColumnID{0})), nullptr);
+    EXPECT_NE(std::dynamic_pointer_cast<DictionaryColumn<std::string>>(chunk->get_column(ColumnID{1})), nullptr);
+  }
+  EXPECT_EQ(table->row_count(), 250u);
+}
+
+TEST_F(UtilsTableGeneratorTest, UniformDistribution) {
+  const auto table = _table_generator.generate_table(
+      {{"a", "int", ColumnDataDistribution::make_uniform_config(10)}}, 10'000, 1'000);
+
+  std::map<int32_t, size_t> counts;
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    for (const auto value : _values(*table, chunk_id)) ++counts[value];
+  }
+
+  ASSERT_EQ(counts.size(), 10u);
+  EXPECT_EQ(counts.cbegin()->first, 0);
+  EXPECT_EQ(counts.crbegin()->first, 9);
+  for (const auto& [value, count] : counts) {
+    EXPECT_GT(count, 800u) << value;
+    EXPECT_LT(count, 1'200u) << value;
+  }
+}
+
+TEST_F(UtilsTableGeneratorTest, ZipfDistribution) {
+  const auto table = _table_generator.generate_table(
+      {{"a", "int", ColumnDataDistribution::make_zipf_config(1'000, 1.2)}}, 10'000, 1'000);
+
+  std::vector<size_t> counts(1'000);
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    for (const auto value : _values(*table, chunk_id)) {
+      ASSERT_GE(value, 0);
+      ASSERT_LT(value, 1'000);
+      ++counts[value];
+    }
+  }
+
+  EXPECT_GT(counts[0], counts[1]);
+  EXPECT_GT(counts[1], counts[10]);
+  EXPECT_GT(counts[10], counts[500]);
+  // with a skew of 1.2, more than a third of the values have the ranks 0 to 3
+  EXPECT_GT(counts[0] + counts[1] + counts[2] + counts[3], 3'300u);
+  EXPECT_LT(counts[0] + counts[1] + counts[2] + counts[3], 4'000u);
+}
+
+TEST_F(UtilsTableGeneratorTest, SortedDistribution) {
+  const auto table = _table_generator.generate_table(
+      {{"a", "int", ColumnDataDistribution::make_sorted_config(100)}}, 1'000, 64);
+
+  std::vector<int32_t> values;
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk_values = _values(*table, chunk_id);
+    values.insert(values.end(), chunk_values.cbegin(), chunk_values.cend());
+  }
+
+  EXPECT_TRUE(std::is_sorted(values.cbegin(), values.cend()));
+  EXPECT_EQ(values.front(), 0);
+  EXPECT_EQ(values.back(), 99);
+  EXPECT_EQ(std::count(values.cbegin(), values.cend(), 42), 10);
+}
+
+TEST_F(UtilsTableGeneratorTest, ClusteredDistribution) {
+  const auto table = _table_generator.generate_table(
+      {{"a", "int", ColumnDataDistribution::make_clustered_config(1'000)}}, 1'000, 100);
+
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto values = _values(*table, chunk_id);
+    const auto min_max = std::minmax_element(values.cbegin(), values.cend());
+    EXPECT_GE(*min_max.first, static_cast<int32_t>(chunk_id.t * 100));
+    EXPECT_LT(*min_max.second, static_cast<int32_t>((chunk_id.t + 1) * 100));
+  }
+}
+
+TEST_F(UtilsTableGeneratorTest, GeneratedValues) {
+  EXPECT_EQ(TableGenerator::generated_value<int32_t>(17), 17);
+  EXPECT_EQ(TableGenerator::generated_value<double>(17), 17.0);
+  EXPECT_EQ(TableGenerator::generated_value<std::string>(0, 4), "aaaa");
+  EXPECT_EQ(TableGenerator::generated_value<std::string>(27, 4), "aabb");
+  EXPECT_LT(TableGenerator::generated_value<std::string>(25, 4), TableGenerator::generated_value<std::string>(26, 4));
+  EXPECT_THROW(TableGenerator::generated_value<std::string>(26, 1), std::logic_error);
+}
+
+TEST_F(UtilsTableGeneratorTest, StringLength) {
+  const auto table = _table_generator.generate_table({{"a", "string", {}, 3}}, 100, 50);
+
+  const auto column =
+      std::dynamic_pointer_cast<ValueColumn<std::string>>(table->get_chunk(ChunkID{1})->get_column(ColumnID{0}));
+  ASSERT_NE(column, nullptr);
+  for (const auto& value : column->values()) EXPECT_EQ(value.size(), 3u);
+}
+
+TEST_F(UtilsTableGeneratorTest, StringLengthDistribution) {
+  auto column_specification = ColumnSpecification{"a", "string", ColumnDataDistribution::make_uniform_config(500), 3};
+  column_specification.max_string_length = 6;
+  const auto table = _table_generator.generate_table({column_specification}, 2'000, 1'000);
+
+  std::set<std::string> values;
+  std::vector<size_t> length_counts(7, 0);
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto column =
+        std::dynamic_pointer_cast<ValueColumn<std::string>>(table->get_chunk(chunk_id)->get_column(ColumnID{0}));
+    ASSERT_NE(column, nullptr);
+    for (const auto& value : column->values()) {
+      ASSERT_GE(value.size(), 3u);
+      ASSERT_LE(value.size(), 6u);
+      if (values.insert(value).second) ++length_counts[value.size()];
+    }
+  }
+
+  // every length occurs among the distinct values, and the lengths do not add distinct values
+  EXPECT_LE(values.size(), 500u);
+  for (size_t length = 3; length <= 6; ++length) EXPECT_GT(length_counts[length], 50u);
+
+  // the order of the ranks is preserved
+  for (size_t rank = 0; rank < 100; ++rank) {
+    EXPECT_LT(TableGenerator::generated_value<std::string>(rank, 3, 6),
+              TableGenerator::generated_value<std::string>(rank + 1, 3, 6));
+  }
+  EXPECT_THROW(TableGenerator::generated_value<std::string>(0, 3, 2), std::logic_error);
+}
+
+}  // namespace opossum